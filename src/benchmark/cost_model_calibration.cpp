@@ -0,0 +1,305 @@
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cost_model/cost_model_physical.hpp"
+#include "cxxopts.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "json.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/limit.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "table_generator.hpp"
+#include "utils/assert.hpp"
+
+/**
+ * This binary calibrates the coefficients of CostModelPhysical for the hardware it runs on. It executes micro-queries
+ * (single operators on generated tables of varying sizes, encodings and selectivities), records the walltimes that
+ * the operators report in their OperatorPerformanceData and fits the linear per-operator models of CostModelPhysical
+ * to these measurements using least squares.
+ *
+ * The resulting coefficients are written as JSON and can be loaded into a CostModelPhysicalCoefficients object:
+ *
+ *   CostModelPhysicalCoefficients coefficients = nlohmann::json::parse(std::ifstream{"cost_model_coefficients.json"});
+ *   const auto cost_model = std::make_shared<CostModelPhysical>(coefficients);
+ */
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Features (in the order of the coefficients of the respective model) and the measured walltime in microseconds
+struct CalibrationSample {
+  std::vector<float> features;
+  float walltime;
+};
+
+using CalibrationSamples = std::vector<CalibrationSample>;
+
+float n_log_n(const float row_count) { return row_count * std::log2(std::max(row_count, 1.0f)); }
+
+/**
+ * Ordinary least squares via the normal equations (X^T * X) * b = X^T * y, solved with Gaussian elimination. The
+ * number of features per model is tiny, so numerical sophistication is not required. Negative coefficients do not make
+ * sense for a cost model and are clamped to zero.
+ */
+std::vector<float> fit_coefficients(const CalibrationSamples& samples) {
+  Assert(!samples.empty(), "Cannot fit coefficients without samples");
+  const auto feature_count = samples.front().features.size();
+
+  auto matrix = std::vector<std::vector<double>>(feature_count, std::vector<double>(feature_count + 1, 0.0));
+  for (const auto& sample : samples) {
+    for (auto row = size_t{0}; row < feature_count; ++row) {
+      for (auto column = size_t{0}; column < feature_count; ++column) {
+        matrix[row][column] += static_cast<double>(sample.features[row]) * sample.features[column];
+      }
+      matrix[row][feature_count] += static_cast<double>(sample.features[row]) * sample.walltime;
+    }
+  }
+
+  for (auto pivot = size_t{0}; pivot < feature_count; ++pivot) {
+    auto max_row = pivot;
+    for (auto row = pivot + 1; row < feature_count; ++row) {
+      if (std::abs(matrix[row][pivot]) > std::abs(matrix[max_row][pivot])) max_row = row;
+    }
+    std::swap(matrix[pivot], matrix[max_row]);
+    if (matrix[pivot][pivot] == 0.0) continue;
+
+    for (auto row = size_t{0}; row < feature_count; ++row) {
+      if (row == pivot) continue;
+      const auto factor = matrix[row][pivot] / matrix[pivot][pivot];
+      for (auto column = pivot; column <= feature_count; ++column) {
+        matrix[row][column] -= factor * matrix[pivot][column];
+      }
+    }
+  }
+
+  auto coefficients = std::vector<float>(feature_count, 0.0f);
+  for (auto row = size_t{0}; row < feature_count; ++row) {
+    if (matrix[row][row] == 0.0) continue;
+    coefficients[row] = std::max(0.0f, static_cast<float>(matrix[row][feature_count] / matrix[row][row]));
+  }
+
+  return coefficients;
+}
+
+std::shared_ptr<TableWrapper> create_table(const size_t row_count, const int distinct_value_count,
+                                           const size_t chunk_size, const EncodingType encoding_type) {
+  const auto column_data_distribution = ColumnDataDistribution::make_uniform_config(0.0, distinct_value_count);
+  auto table = TableGenerator{}.generate_table({column_data_distribution, column_data_distribution}, row_count,
+                                               chunk_size, encoding_type);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+// Executes the operator and returns the walltime it recorded in its OperatorPerformanceData
+float execute_and_measure(const std::shared_ptr<AbstractOperator>& op) {
+  op->execute();
+  return static_cast<float>(op->performance_data().walltime.count());
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"./hyriseCostModelCalibration", "Calibrate the coefficients of CostModelPhysical"};
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "print this help message")
+    ("o,output", "File to write the calibrated coefficients to", cxxopts::value<std::string>()->default_value("cost_model_coefficients.json"))  // NOLINT
+    ("rows", "Row counts of the generated tables", cxxopts::value<std::vector<size_t>>()->default_value("10000,100000,1000000"))  // NOLINT
+    ("c,chunk_size", "Chunk size of the generated tables", cxxopts::value<size_t>()->default_value("100000"))  // NOLINT
+    ("r,runs", "Number of executions per micro-query", cxxopts::value<size_t>()->default_value("3"));  // NOLINT
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+  if (cli_parse_result.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto output_file_path = cli_parse_result["output"].as<std::string>();
+  const auto row_counts = cli_parse_result["rows"].as<std::vector<size_t>>();
+  const auto chunk_size = cli_parse_result["chunk_size"].as<size_t>();
+  const auto run_count = cli_parse_result["runs"].as<size_t>();
+
+  const auto encoding_types = std::vector<EncodingType>{EncodingType::Unencoded, EncodingType::Dictionary,
+                                                        EncodingType::RunLength, EncodingType::FrameOfReference};
+  const auto selectivities = std::vector<float>{0.01f, 0.1f, 0.5f, 1.0f};
+  const auto distinct_value_count = 1'000;
+
+  auto table_scan_data_samples = std::map<EncodingType, CalibrationSamples>{};
+  auto table_scan_references_samples = CalibrationSamples{};
+  auto join_hash_samples = CalibrationSamples{};
+  auto join_sort_merge_samples = CalibrationSamples{};
+  auto join_index_samples = CalibrationSamples{};
+  auto aggregate_samples = CalibrationSamples{};
+  auto sort_samples = CalibrationSamples{};
+  auto other_samples = CalibrationSamples{};
+
+  for (const auto row_count : row_counts) {
+    std::cout << "- Calibrating with " << row_count << " rows" << std::endl;
+
+    // TableScan on data and on reference tables
+    for (const auto encoding_type : encoding_types) {
+      const auto table_wrapper = create_table(row_count, distinct_value_count, chunk_size, encoding_type);
+      const auto& table = *table_wrapper->get_output();
+      const auto projection_expressions = std::vector<std::shared_ptr<AbstractExpression>>{
+          PQPColumnExpression::from_table(table, table.column_name(ColumnID{0})),
+          PQPColumnExpression::from_table(table, table.column_name(ColumnID{1}))};
+
+      for (const auto selectivity : selectivities) {
+        const auto scan_value = static_cast<int32_t>(selectivity * distinct_value_count);
+        const auto predicate = OperatorScanPredicate{ColumnID{0}, PredicateCondition::LessThan, scan_value};
+
+        for (auto run = size_t{0}; run < run_count; ++run) {
+          const auto data_scan = std::make_shared<TableScan>(table_wrapper, predicate);
+          const auto walltime = execute_and_measure(data_scan);
+          const auto output_row_count = static_cast<float>(data_scan->get_output()->row_count());
+          table_scan_data_samples[encoding_type].push_back(
+              {{static_cast<float>(row_count), output_row_count}, walltime});
+
+          const auto references_scan = std::make_shared<TableScan>(
+              data_scan, OperatorScanPredicate{ColumnID{1}, PredicateCondition::LessThan, distinct_value_count / 2});
+          const auto references_walltime = execute_and_measure(references_scan);
+          const auto references_output_row_count = static_cast<float>(references_scan->get_output()->row_count());
+          table_scan_references_samples.push_back(
+              {{output_row_count, references_output_row_count}, references_walltime});
+
+          // Projection and Limit represent the other operators (see CostModelPhysical::estimate_other_cost()). While a
+          // Projection has as many output rows as input rows, a Limit separates the costs per input and output row.
+          const auto projection = std::make_shared<Projection>(data_scan, projection_expressions);
+          other_samples.push_back({{output_row_count, output_row_count}, execute_and_measure(projection)});
+
+          const auto limit_row_count = static_cast<int64_t>(selectivity * static_cast<float>(row_count));
+          const auto limit = std::make_shared<Limit>(table_wrapper, expression_functional::value_(limit_row_count));
+          const auto limit_walltime = execute_and_measure(limit);
+          other_samples.push_back(
+              {{static_cast<float>(row_count), static_cast<float>(limit->get_output()->row_count())}, limit_walltime});
+        }
+      }
+    }
+
+    // Joins. The right input is always the table with row_count rows, the left one varies in size.
+    const auto right_table_wrapper =
+        create_table(row_count, distinct_value_count, chunk_size, EncodingType::Dictionary);
+    const auto right_table = std::const_pointer_cast<Table>(right_table_wrapper->get_output());
+    for (ChunkID chunk_id{0}; chunk_id < right_table->chunk_count(); ++chunk_id) {
+      right_table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+    }
+
+    for (const auto left_row_count : row_counts) {
+      // JoinIndex probes the index once per left row, do not let it dominate the calibration runtime
+      if (left_row_count > row_count) continue;
+
+      const auto left_table_wrapper =
+          create_table(left_row_count, distinct_value_count, chunk_size, EncodingType::Dictionary);
+      const auto left_row_count_f = static_cast<float>(left_row_count);
+      const auto right_row_count_f = static_cast<float>(row_count);
+      const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+
+      for (auto run = size_t{0}; run < run_count; ++run) {
+        const auto join_hash = std::make_shared<JoinHash>(left_table_wrapper, right_table_wrapper, JoinMode::Inner,
+                                                          column_ids, PredicateCondition::Equals);
+        auto walltime = execute_and_measure(join_hash);
+        const auto output_row_count = static_cast<float>(join_hash->get_output()->row_count());
+        // JoinHash builds on the smaller input for inner joins
+        join_hash_samples.push_back({{left_row_count_f, right_row_count_f, output_row_count}, walltime});
+
+        const auto join_sort_merge = std::make_shared<JoinSortMerge>(
+            left_table_wrapper, right_table_wrapper, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+        walltime = execute_and_measure(join_sort_merge);
+        join_sort_merge_samples.push_back(
+            {{n_log_n(left_row_count_f) + n_log_n(right_row_count_f), output_row_count}, walltime});
+
+        const auto join_index = std::make_shared<JoinIndex>(left_table_wrapper, right_table_wrapper, JoinMode::Inner,
+                                                            column_ids, PredicateCondition::Equals);
+        walltime = execute_and_measure(join_index);
+        join_index_samples.push_back({{left_row_count_f, output_row_count}, walltime});
+      }
+    }
+
+    // Aggregate with a varying number of groups, and Sort
+    for (const auto group_count : {10, 1'000, 100'000}) {
+      const auto table_wrapper = create_table(row_count, group_count, chunk_size, EncodingType::Dictionary);
+
+      for (auto run = size_t{0}; run < run_count; ++run) {
+        const auto aggregate = std::make_shared<Aggregate>(
+            table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}},
+            std::vector<ColumnID>{ColumnID{0}});
+        const auto walltime = execute_and_measure(aggregate);
+        aggregate_samples.push_back(
+            {{static_cast<float>(row_count), static_cast<float>(aggregate->get_output()->row_count())}, walltime});
+
+        const auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0});
+        sort_samples.push_back({{n_log_n(static_cast<float>(row_count))}, execute_and_measure(sort)});
+      }
+    }
+  }
+
+  std::cout << "- Fitting coefficients" << std::endl;
+
+  auto coefficients = CostModelPhysicalCoefficients{};
+
+  // All TableScan models share the coefficient per output row, use the average of the individual fits
+  auto table_scan_output_row_sum = 0.0f;
+  for (const auto& [encoding_type, samples] : table_scan_data_samples) {
+    const auto fitted = fit_coefficients(samples);
+    coefficients.table_scan_data_input_row[encoding_type] = fitted[0];
+    table_scan_output_row_sum += fitted[1];
+  }
+  const auto table_scan_references_fitted = fit_coefficients(table_scan_references_samples);
+  coefficients.table_scan_references_input_row = table_scan_references_fitted[0];
+  coefficients.table_scan_output_row =
+      (table_scan_output_row_sum + table_scan_references_fitted[1]) / (table_scan_data_samples.size() + 1);
+
+  const auto join_hash_fitted = fit_coefficients(join_hash_samples);
+  coefficients.join_hash_build_row = join_hash_fitted[0];
+  coefficients.join_hash_probe_row = join_hash_fitted[1];
+  coefficients.join_hash_output_row = join_hash_fitted[2];
+
+  const auto join_sort_merge_fitted = fit_coefficients(join_sort_merge_samples);
+  coefficients.join_sort_merge_sort_row = join_sort_merge_fitted[0];
+  coefficients.join_sort_merge_output_row = join_sort_merge_fitted[1];
+
+  const auto join_index_fitted = fit_coefficients(join_index_samples);
+  coefficients.join_index_probe_row = join_index_fitted[0];
+  coefficients.join_index_output_row = join_index_fitted[1];
+
+  const auto aggregate_fitted = fit_coefficients(aggregate_samples);
+  coefficients.aggregate_input_row = aggregate_fitted[0];
+  coefficients.aggregate_group_row = aggregate_fitted[1];
+
+  coefficients.sort_row = fit_coefficients(sort_samples)[0];
+
+  const auto other_fitted = fit_coefficients(other_samples);
+  coefficients.other_input_row = other_fitted[0];
+  coefficients.other_output_row = other_fitted[1];
+
+  const nlohmann::json coefficients_json = coefficients;
+  std::ofstream output_file(output_file_path);
+  output_file << std::setw(2) << coefficients_json << std::endl;
+
+  std::cout << "- Coefficients written to " << output_file_path << std::endl;
+  std::cout << std::setw(2) << coefficients_json << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,122 @@
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+
+#include "benchmark_utils.hpp"
+#include "cxxopts.hpp"
+#include "json.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/storage_manager.hpp"
+#include "tpcc/tpcc_driver.hpp"
+#include "tpcc/tpcc_table_generator.hpp"
+#include "utils/performance_warning.hpp"
+#include "version.hpp"
+
+/**
+ * This benchmark runs the TPC-C transaction mix (NewOrder, Payment, OrderStatus, Delivery, StockLevel) against the
+ * generated TPC-C tables with a configurable number of warehouses and concurrent terminals. It reports throughput,
+ * abort rates and latency percentiles per transaction type as well as tpmC.
+ *
+ * As there are no keying and think times and aborted transactions are not retried (see TpccDriver), the results are
+ * not comparable to audited TPC-C results. They are meant to evaluate Hyrise's transactional (MVCC) performance under
+ * concurrent, write-heavy workloads.
+ */
+
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"./hyriseBenchmarkTPCC", "TPCC Benchmark"};
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "print this help message")
+    ("v,verbose", "Print log messages", cxxopts::value<bool>()->default_value("false"))
+    ("w,warehouses", "Number of warehouses", cxxopts::value<size_t>()->default_value("1"))
+    ("terminals", "Number of terminals that concurrently issue transactions", cxxopts::value<size_t>()->default_value("10"))  // NOLINT
+    ("t,time", "Maximum seconds that the transactions are run", cxxopts::value<size_t>()->default_value("60"))  // NOLINT
+    ("r,transactions", "Maximum number of transactions issued by all terminals together", cxxopts::value<size_t>()->default_value("100000"))  // NOLINT
+    ("c,chunk_size", "ChunkSize, default is 100000", cxxopts::value<opossum::ChunkOffset>()->default_value("100000"))  // NOLINT
+    ("e,encoding", "Specify Chunk encoding as a string", cxxopts::value<std::string>()->default_value("Dictionary"))  // NOLINT
+    ("compression", "Specify vector compression as a string", cxxopts::value<std::string>()->default_value(""))  // NOLINT
+    ("scheduler", "Enable or disable the scheduler", cxxopts::value<bool>()->default_value("false"))  // NOLINT
+    ("o,output", "File to output results to, don't specify for stdout", cxxopts::value<std::string>()->default_value(""));  // NOLINT
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+  if (cli_parse_result.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto verbose = cli_parse_result["verbose"].as<bool>();
+  const auto num_warehouses = cli_parse_result["warehouses"].as<size_t>();
+  const auto num_terminals = cli_parse_result["terminals"].as<size_t>();
+  const auto max_duration = std::chrono::seconds{cli_parse_result["time"].as<size_t>()};
+  const auto max_num_transactions = cli_parse_result["transactions"].as<size_t>();
+  const auto chunk_size = cli_parse_result["chunk_size"].as<opossum::ChunkOffset>();
+  const auto encoding = cli_parse_result["encoding"].as<std::string>();
+  const auto compression = cli_parse_result["compression"].as<std::string>();
+  const auto enable_scheduler = cli_parse_result["scheduler"].as<bool>();
+  const auto output_file_path = cli_parse_result["output"].as<std::string>();
+
+  auto& out = opossum::get_out_stream(verbose);
+
+  // In non-verbose mode, disable performance warnings
+  auto performance_warning_disabler = std::optional<opossum::PerformanceWarningDisabler>{};
+  if (!verbose) performance_warning_disabler.emplace();
+
+  const auto encoding_config =
+      opossum::EncodingConfig{opossum::EncodingConfig::encoding_spec_from_strings(encoding, compression)};
+
+  std::cout << "- Generating TPCC Tables with " << num_warehouses << " warehouse(s) ..." << std::endl;
+  const auto tables = opossum::TpccTableGenerator(chunk_size, num_warehouses, encoding_config).generate_all_tables();
+  for (const auto& [table_name, table] : tables) {
+    opossum::StorageManager::get().add_table(table_name, table);
+  }
+  std::cout << "- ... done." << std::endl;
+
+  if (enable_scheduler) {
+    out << "- Multi-threaded Topology:" << std::endl;
+    opossum::Topology::get().print(out);
+    opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>());
+  }
+
+  std::cout << "- Running transactions on " << num_terminals << " terminal(s) ..." << std::endl;
+  auto driver = opossum::TpccDriver{num_warehouses, num_terminals};
+  driver.run(max_duration, max_num_transactions);
+  std::cout << "- ... done. tpmC: " << driver.tpmc() << std::endl;
+
+  if (enable_scheduler) {
+    opossum::CurrentScheduler::get()->finish();
+  }
+
+  // Generate YY-MM-DD hh:mm::ss
+  auto current_time = std::time(nullptr);
+  auto local_time = *std::localtime(&current_time);
+  std::stringstream timestamp_stream;
+  timestamp_stream << std::put_time(&local_time, "%Y-%m-%d %H:%M:%S");
+
+  const auto context = nlohmann::json{
+      {"date", timestamp_stream.str()},
+      {"chunk_size", chunk_size},
+      {"build_type", IS_DEBUG ? "debug" : "release"},
+      {"encoding", encoding_config.to_json()},
+      {"max_transactions", max_num_transactions},
+      {"max_duration (s)", max_duration.count()},
+      {"using_scheduler", enable_scheduler},
+      {"GIT-HASH", GIT_HEAD_SHA1 + std::string(GIT_IS_DIRTY ? "-dirty" : "")}};
+
+  auto report = driver.report();
+  report["context"] = context;
+
+  if (!output_file_path.empty()) {
+    std::ofstream output_file(output_file_path);
+    output_file << std::setw(2) << report << std::endl;
+  } else {
+    std::cout << std::setw(2) << report << std::endl;
+  }
+}
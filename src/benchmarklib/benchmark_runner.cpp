@@ -1,6 +1,10 @@
 #include <json.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <numeric>
 #include <random>
+#include <thread>
 
 #include "benchmark_runner.hpp"
 #include "constant_mappings.hpp"
@@ -42,14 +46,27 @@ void BenchmarkRunner::run() {
 
   auto benchmark_start = std::chrono::steady_clock::now();
 
+  const auto run_concurrently = _config.clients > 1 || _config.target_query_rate > 0.0f;
+
   // Run the queries in the selected mode
   switch (_config.benchmark_mode) {
     case BenchmarkMode::IndividualQueries: {
-      _benchmark_individual_queries();
+      if (run_concurrently) {
+        for (const auto& named_query : _queries) {
+          _config.out << "- Benchmarking Query " << named_query.first << std::endl;
+          _benchmark_concurrently({named_query}, _config.max_num_query_runs, false);
+        }
+      } else {
+        _benchmark_individual_queries();
+      }
       break;
     }
     case BenchmarkMode::PermutedQuerySets: {
-      _benchmark_permuted_query_sets();
+      if (run_concurrently) {
+        _benchmark_concurrently(_queries, _config.max_num_query_runs * _queries.size(), true);
+      } else {
+        _benchmark_permuted_query_sets();
+      }
       break;
     }
   }
@@ -118,6 +135,7 @@ void BenchmarkRunner::_benchmark_permuted_query_sets() {
       auto& query_benchmark_result = _query_results_by_query_name[named_query.first];
       query_benchmark_result.duration += query_benchmark_end - query_benchmark_begin;
       query_benchmark_result.num_iterations++;
+      query_benchmark_result.iteration_durations.emplace_back(query_benchmark_end - query_benchmark_begin);
     }
   }
 }
@@ -148,6 +166,88 @@ void BenchmarkRunner::_benchmark_individual_queries() {
   }
 }
 
+void BenchmarkRunner::_benchmark_concurrently(const NamedQueries& queries, const size_t max_num_queries,
+                                              const bool shuffle) {
+  // Index of the next query to be issued by any client. With a target query rate, it determines the point in time at
+  // which the query arrives.
+  auto next_query_idx = std::atomic<size_t>{0};
+
+  // Per client: (index into queries, latency) of each executed query. Merged after all clients finished.
+  auto latencies_by_client = std::vector<std::vector<std::pair<size_t, Duration>>>(_config.clients);
+
+  const auto benchmark_begin = std::chrono::high_resolution_clock::now();
+
+  const auto run_client = [&](const size_t client_id) {
+    auto& latencies = latencies_by_client[client_id];
+
+    std::random_device random_device;
+    std::mt19937 random_generator(random_device());
+    auto query_order = std::vector<size_t>(queries.size());
+    std::iota(query_order.begin(), query_order.end(), size_t{0});
+
+    for (auto position = size_t{0};; ++position) {
+      const auto query_idx = next_query_idx++;
+      if (query_idx >= max_num_queries) break;
+
+      // In the open loop, the latency of a query starts at its arrival, so that time spent waiting for a free client
+      // is included. Otherwise, a slow query would delay the following ones without them being reported as slow.
+      auto query_begin = std::chrono::high_resolution_clock::now();
+      if (_config.target_query_rate > 0.0f) {
+        const auto arrival_offset = std::chrono::duration<double>{static_cast<double>(query_idx) /
+                                                                  static_cast<double>(_config.target_query_rate)};
+        query_begin = benchmark_begin + std::chrono::duration_cast<Duration>(arrival_offset);
+        if (query_begin - benchmark_begin >= _config.max_duration) break;
+        std::this_thread::sleep_until(query_begin);
+      } else if (query_begin - benchmark_begin >= _config.max_duration) {
+        break;
+      }
+
+      if (shuffle && position % queries.size() == 0) {
+        std::shuffle(query_order.begin(), query_order.end(), random_generator);
+      }
+      const auto query_order_idx = query_order[position % queries.size()];
+
+      _execute_query(queries[query_order_idx]);
+
+      latencies.emplace_back(query_order_idx, std::chrono::high_resolution_clock::now() - query_begin);
+    }
+  };
+
+  auto clients = std::vector<std::thread>{};
+  clients.reserve(_config.clients);
+  for (auto client_id = size_t{0}; client_id < _config.clients; ++client_id) {
+    clients.emplace_back(run_client, client_id);
+  }
+  for (auto& client : clients) {
+    client.join();
+  }
+
+  const auto benchmark_end = std::chrono::high_resolution_clock::now();
+
+  // The duration of each query is the duration of the entire run, so that items_per_second reflects the throughput
+  for (const auto& named_query : queries) {
+    auto& result = _query_results_by_query_name[named_query.first];
+    result.duration = benchmark_end - benchmark_begin;
+  }
+
+  auto num_queries = size_t{0};
+  for (const auto& latencies : latencies_by_client) {
+    for (const auto& [query_order_idx, latency] : latencies) {
+      auto& result = _query_results_by_query_name[queries[query_order_idx].first];
+      result.iteration_durations.emplace_back(latency);
+      ++result.num_iterations;
+    }
+    num_queries += latencies.size();
+  }
+
+  const auto duration_ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(benchmark_end - benchmark_begin).count();
+  const auto duration_seconds = static_cast<float>(duration_ns) / 1'000'000'000;
+  _config.out << "  -> Executed " << num_queries << " queries with " << _config.clients << " client(s) in "
+              << duration_seconds << " seconds (" << static_cast<float>(num_queries) / duration_seconds << " queries/s)"
+              << std::endl;
+}
+
 void BenchmarkRunner::_execute_query(const NamedQuery& named_query) {
   const auto& name = named_query.first;
   const auto& sql = named_query.second;
@@ -160,6 +260,7 @@ void BenchmarkRunner::_execute_query(const NamedQuery& named_query) {
 
   // If necessary, keep plans for visualization
   if (_config.enable_visualization) {
+    std::lock_guard<std::mutex> lock(_query_plans_mutex);
     const auto query_plans_iter = _query_plans.find(name);
     if (query_plans_iter == _query_plans.end()) {
       QueryPlans plans{pipeline.get_optimized_logical_plans(), pipeline.get_query_plans()};
@@ -170,6 +271,8 @@ void BenchmarkRunner::_execute_query(const NamedQuery& named_query) {
 
 void BenchmarkRunner::_create_report(std::ostream& stream) const {
   nlohmann::json benchmarks;
+  auto all_iteration_durations = std::vector<Duration>{};
+  auto total_num_iterations = size_t{0};
 
   for (const auto& named_query : _queries) {
     const auto& name = named_query.first;
@@ -177,10 +280,13 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
     DebugAssert(query_result.iteration_durations.size() == query_result.num_iterations,
                 "number of iterations and number of iteration durations does not match");
 
+    // In concurrent runs, a query may not have been executed at all before the time limit was reached
     const auto duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(query_result.duration).count();
     const auto duration_seconds = static_cast<float>(duration_ns) / 1'000'000'000;
-    const auto items_per_second = static_cast<float>(query_result.num_iterations) / duration_seconds;
-    const auto time_per_query = duration_ns / query_result.num_iterations;
+    const auto items_per_second =
+        duration_ns > 0 ? static_cast<float>(query_result.num_iterations) / duration_seconds : 0.0f;
+    const auto time_per_query =
+        query_result.num_iterations > 0 ? duration_ns / static_cast<int64_t>(query_result.num_iterations) : int64_t{0};
 
     // Transform iteration Durations into numerical representation
     auto iteration_durations = std::vector<double>();
@@ -196,15 +302,29 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
         {"iteration_durations", iteration_durations},
         {"avg_real_time_per_iteration", time_per_query},
         {"items_per_second", items_per_second},
+        {"latency_percentiles", latency_percentiles(query_result.iteration_durations)},
         {"time_unit", "ns"},
     };
 
     benchmarks.push_back(benchmark);
+
+    all_iteration_durations.insert(all_iteration_durations.end(), query_result.iteration_durations.begin(),
+                                   query_result.iteration_durations.end());
+    total_num_iterations += query_result.num_iterations;
   }
 
   const auto total_run_duration_seconds = std::chrono::duration_cast<std::chrono::seconds>(_total_run_duration).count();
-  nlohmann::json report{
-      {"context", _context}, {"benchmarks", benchmarks}, {"total_run_duration (s)", total_run_duration_seconds}};
+  const auto total_run_duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(_total_run_duration).count();
+  const auto throughput =
+      total_run_duration_ns > 0
+          ? static_cast<float>(total_num_iterations) / (static_cast<float>(total_run_duration_ns) / 1'000'000'000)
+          : 0.0f;
+
+  nlohmann::json report{{"context", _context},
+                        {"benchmarks", benchmarks},
+                        {"total_run_duration (s)", total_run_duration_seconds},
+                        {"throughput (queries/s)", throughput},
+                        {"latency_percentiles", latency_percentiles(std::move(all_iteration_durations))}};
 
   stream << std::setw(2) << report << std::endl;
 }
@@ -348,7 +468,9 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("compression", "Specify vector compression as a string. Options: " + compression_strings_option, cxxopts::value<std::string>()->default_value(""))  // NOLINT
     ("scheduler", "Enable or disable the scheduler", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("mvcc", "Enable MVCC", cxxopts::value<bool>()->default_value("false")) // NOLINT
-    ("visualize", "Create a visualization image of one LQP and PQP for each query", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("visualize", "Create a visualization image of one LQP and PQP for each query", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("clients", "Number of clients that concurrently issue queries", cxxopts::value<size_t>()->default_value("1")) // NOLINT
+    ("rate", "Queries per second issued by all clients together, 0 (default) issues queries in a closed loop", cxxopts::value<float>()->default_value("0")); // NOLINT
   // clang-format on
 
   return cli_options;
@@ -374,6 +496,8 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
       {"using_visualization", config.enable_visualization},
       {"output_file_path", config.output_file_path ? *(config.output_file_path) : "stdout"},
       {"using_scheduler", config.enable_scheduler},
+      {"clients", config.clients},
+      {"target_query_rate", config.target_query_rate},
       {"verbose", config.verbose},
       {"GIT-HASH", GIT_HEAD_SHA1 + std::string(GIT_IS_DIRTY ? "-dirty" : "")}};
 }
@@ -4,6 +4,7 @@
 
 #include <chrono>
 #include <iostream>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -38,6 +39,11 @@ class BenchmarkRunner {
   // Run benchmark in BenchmarkMode::IndividualQueries mode
   void _benchmark_individual_queries();
 
+  // Run benchmark with multiple concurrent clients and/or a target query rate. Each client repeatedly issues the
+  // queries in @param queries (in a random order if @param shuffle is set) until @param max_num_queries queries were
+  // issued by all clients together or the time limit is reached.
+  void _benchmark_concurrently(const NamedQueries& queries, const size_t max_num_queries, const bool shuffle);
+
   void _execute_query(const NamedQuery& named_query);
   // Create a report in roughly the same format as google benchmarks do when run with --benchmark_format=json
   void _create_report(std::ostream& stream) const;
@@ -55,6 +61,7 @@ class BenchmarkRunner {
   };
 
   std::unordered_map<std::string, QueryPlans> _query_plans;
+  std::mutex _query_plans_mutex;
 
   const BenchmarkConfig _config;
 
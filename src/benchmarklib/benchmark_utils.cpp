@@ -1,5 +1,7 @@
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 
 #include "benchmark_utils.hpp"
@@ -30,6 +32,21 @@ std::ostream& get_out_stream(const bool verbose) {
   return null_stream;
 }
 
+nlohmann::json latency_percentiles(std::vector<Duration> durations) {
+  if (durations.empty()) return nlohmann::json::object();
+
+  std::sort(durations.begin(), durations.end());
+
+  const auto percentile = [&](const double fraction) {
+    const auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(durations.size())));
+    const auto& duration = durations[std::max(rank, size_t{1}) - 1];
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+  };
+
+  return nlohmann::json{{"p50", percentile(0.5)}, {"p95", percentile(0.95)}, {"p99", percentile(0.99)},
+                        {"max", percentile(1.0)}};
+}
+
 BenchmarkState::BenchmarkState(const size_t max_num_iterations, const opossum::Duration max_duration)
     : max_num_iterations(max_num_iterations), max_duration(max_duration) {
   iteration_durations.reserve(max_num_iterations);
@@ -83,7 +100,8 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode benchmark_mode, const bool
                                  const EncodingConfig& encoding_config, const size_t max_num_query_runs,
                                  const Duration& max_duration, const UseMvcc use_mvcc,
                                  const std::optional<std::string>& output_file_path, const bool enable_scheduler,
-                                 const bool enable_visualization, std::ostream& out)
+                                 const bool enable_visualization, const size_t clients,
+                                 const float target_query_rate, std::ostream& out)
     : benchmark_mode(benchmark_mode),
       verbose(verbose),
       chunk_size(chunk_size),
@@ -94,6 +112,8 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode benchmark_mode, const bool
       output_file_path(output_file_path),
       enable_scheduler(enable_scheduler),
       enable_visualization(enable_visualization),
+      clients(clients),
+      target_query_rate(target_query_rate),
       out(out) {}
 
 BenchmarkConfig BenchmarkConfig::get_default_config() { return BenchmarkConfig(); }
@@ -157,6 +177,17 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
   const auto enable_visualization = json_config.value("visualize", default_config.enable_visualization);
   out << "- Visualization is " << (enable_visualization ? "on" : "off") << std::endl;
 
+  const auto clients = json_config.value("clients", default_config.clients);
+  Assert(clients > 0, "Need at least one client");
+  const auto target_query_rate = json_config.value("rate", default_config.target_query_rate);
+  Assert(target_query_rate >= 0.0f, "Target query rate must not be negative");
+  out << "- Running " << clients << " client(s)";
+  if (target_query_rate > 0.0f) {
+    out << " issuing " << target_query_rate << " queries per second" << std::endl;
+  } else {
+    out << " in a closed loop" << std::endl;
+  }
+
   // Get the specified encoding type
   std::unique_ptr<EncodingConfig> encoding_config{};
   const auto encoding_type_str = json_config.value("encoding", "Dictionary");
@@ -187,7 +218,8 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
 
   return BenchmarkConfig{
       benchmark_mode, verbose,          chunk_size,       *encoding_config,     max_runs, timeout_duration,
-      use_mvcc,       output_file_path, enable_scheduler, enable_visualization, out};
+      use_mvcc,       output_file_path, enable_scheduler, enable_visualization, clients,  target_query_rate,
+      out};
 }
 
 BenchmarkConfig CLIConfigParser::parse_basic_cli_options(const cxxopts::ParseResult& parse_result) {
@@ -208,6 +240,8 @@ nlohmann::json CLIConfigParser::basic_cli_options_to_json(const cxxopts::ParseRe
   json_config.emplace("mvcc", parse_result["mvcc"].as<bool>());
   json_config.emplace("visualize", parse_result["visualize"].as<bool>());
   json_config.emplace("output", parse_result["output"].as<std::string>());
+  json_config.emplace("clients", parse_result["clients"].as<size_t>());
+  json_config.emplace("rate", parse_result["rate"].as<float>());
 
   return json_config;
 }
@@ -406,6 +440,13 @@ Example:
   "time": 5
 }
 
+By default, queries are issued by a single client. With "clients", multiple
+client threads issue queries concurrently, each as soon as its previous query
+finished. With "rate", queries arrive at a fixed rate (queries per second,
+across all clients) and their latency includes the time they waited for a free
+client. In both cases, "runs" limits the number of queries (sets) issued by all
+clients together.
+
 The JSON config can also include benchmark-specific options (e.g. TPCH's scale
 option). They will be parsed like the
 CLI options.
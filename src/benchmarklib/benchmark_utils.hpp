@@ -67,6 +67,11 @@ struct BenchmarkState {
   std::vector<Duration> iteration_durations;
 };
 
+/**
+ * @return the p50, p95, p99 and max latencies (nearest rank) of @param durations in ns
+ */
+nlohmann::json latency_percentiles(std::vector<Duration> durations);
+
 // View EncodingConfig::description to see format of encoding JSON
 struct EncodingConfig {
   EncodingConfig();
@@ -100,7 +105,8 @@ struct BenchmarkConfig {
   BenchmarkConfig(const BenchmarkMode benchmark_mode, const bool verbose, const ChunkOffset chunk_size,
                   const EncodingConfig& encoding_config, const size_t max_num_query_runs, const Duration& max_duration,
                   const UseMvcc use_mvcc, const std::optional<std::string>& output_file_path,
-                  const bool enable_scheduler, const bool enable_visualization, std::ostream& out);
+                  const bool enable_scheduler, const bool enable_visualization, const size_t clients,
+                  const float target_query_rate, std::ostream& out);
 
   static BenchmarkConfig get_default_config();
 
@@ -114,6 +120,11 @@ struct BenchmarkConfig {
   const std::optional<std::string> output_file_path = std::nullopt;
   const bool enable_scheduler = false;
   const bool enable_visualization = false;
+  // Number of client threads that concurrently issue queries
+  const size_t clients = 1;
+  // Queries per second issued by all clients together (open loop). If 0, each client issues its next query as soon as
+  // the previous one finished (closed loop).
+  const float target_query_rate = 0.0f;
   std::ostream& out;
 
   static const char* description;
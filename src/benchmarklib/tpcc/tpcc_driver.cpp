@@ -0,0 +1,148 @@
+#include "tpcc_driver.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const std::map<TpccTransactionType, std::string> transaction_type_names{
+    {TpccTransactionType::NewOrder, "NewOrder"},       {TpccTransactionType::Payment, "Payment"},
+    {TpccTransactionType::OrderStatus, "OrderStatus"}, {TpccTransactionType::Delivery, "Delivery"},
+    {TpccTransactionType::StockLevel, "StockLevel"}};
+
+// Chooses the type of the next transaction according to the mix of TPC-C 5.2.3
+TpccTransactionType random_transaction_type(TpccRandomGenerator& random_generator) {
+  const auto value = random_generator.random_number(1, 100);
+  if (value <= 45) return TpccTransactionType::NewOrder;
+  if (value <= 88) return TpccTransactionType::Payment;
+  if (value <= 92) return TpccTransactionType::OrderStatus;
+  if (value <= 96) return TpccTransactionType::Delivery;
+  return TpccTransactionType::StockLevel;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TpccDriver::TpccDriver(const size_t num_warehouses, const size_t num_terminals)
+    : _num_warehouses(num_warehouses), _num_terminals(num_terminals) {
+  Assert(num_warehouses > 0, "Need at least one warehouse");
+  Assert(num_terminals > 0, "Need at least one terminal");
+}
+
+void TpccDriver::run(const Duration max_duration, const size_t max_num_transactions) {
+  const auto begin = std::chrono::high_resolution_clock::now();
+  const auto end = begin + max_duration;
+
+  // Transactions are claimed from this counter, so that max_num_transactions is not exceeded by all terminals together
+  auto next_transaction = std::atomic<size_t>{0};
+
+  // Each terminal collects its own statistics, they are merged after all terminals finished
+  auto terminal_statistics = std::vector<std::map<TpccTransactionType, TpccTransactionStatistics>>(_num_terminals);
+
+  auto terminals = std::vector<std::thread>{};
+  terminals.reserve(_num_terminals);
+
+  for (auto terminal_id = size_t{0}; terminal_id < _num_terminals; ++terminal_id) {
+    terminals.emplace_back([&, terminal_id]() {
+      auto random_generator = TpccRandomGenerator{static_cast<uint32_t>(terminal_id)};
+      const auto warehouse_id = terminal_id % _num_warehouses;
+      auto& statistics = terminal_statistics[terminal_id];
+
+      while (std::chrono::high_resolution_clock::now() < end && next_transaction++ < max_num_transactions) {
+        auto transaction =
+            make_tpcc_transaction(random_transaction_type(random_generator), random_generator, _num_warehouses,
+                                  warehouse_id);
+
+        const auto transaction_begin = std::chrono::high_resolution_clock::now();
+        const auto result = transaction->execute();
+        const auto transaction_end = std::chrono::high_resolution_clock::now();
+
+        auto& transaction_statistics = statistics[transaction->type()];
+        transaction_statistics.latencies.emplace_back(transaction_end - transaction_begin);
+        switch (result) {
+          case TpccTransactionResult::Committed:
+            ++transaction_statistics.committed;
+            break;
+          case TpccTransactionResult::RolledBack:
+            ++transaction_statistics.rolled_back;
+            break;
+          case TpccTransactionResult::Aborted:
+            ++transaction_statistics.aborted;
+            break;
+        }
+      }
+    });
+  }
+
+  for (auto& terminal : terminals) {
+    terminal.join();
+  }
+
+  _run_duration = std::chrono::high_resolution_clock::now() - begin;
+
+  _statistics.clear();
+  for (const auto& statistics : terminal_statistics) {
+    for (const auto& [type, transaction_statistics] : statistics) {
+      auto& merged_statistics = _statistics[type];
+      merged_statistics.committed += transaction_statistics.committed;
+      merged_statistics.rolled_back += transaction_statistics.rolled_back;
+      merged_statistics.aborted += transaction_statistics.aborted;
+      merged_statistics.latencies.insert(merged_statistics.latencies.end(), transaction_statistics.latencies.begin(),
+                                         transaction_statistics.latencies.end());
+    }
+  }
+}
+
+const std::map<TpccTransactionType, TpccTransactionStatistics>& TpccDriver::statistics() const { return _statistics; }
+
+double TpccDriver::tpmc() const {
+  const auto new_order_iter = _statistics.find(TpccTransactionType::NewOrder);
+  if (new_order_iter == _statistics.end()) return 0.0;
+
+  const auto minutes = std::chrono::duration<double, std::ratio<60>>(_run_duration).count();
+  if (minutes == 0.0) return 0.0;
+
+  return static_cast<double>(new_order_iter->second.committed + new_order_iter->second.rolled_back) / minutes;
+}
+
+nlohmann::json TpccDriver::report() const {
+  auto transactions = nlohmann::json::object();
+  auto total_count = size_t{0};
+  auto total_aborted = size_t{0};
+
+  for (const auto& [type, statistics] : _statistics) {
+    const auto count = statistics.committed + statistics.rolled_back + statistics.aborted;
+    total_count += count;
+    total_aborted += statistics.aborted;
+
+    transactions[transaction_type_names.at(type)] = nlohmann::json{
+        {"committed", statistics.committed},
+        {"rolled_back", statistics.rolled_back},
+        {"aborted", statistics.aborted},
+        {"abort_rate", count > 0 ? static_cast<double>(statistics.aborted) / static_cast<double>(count) : 0.0},
+        {"latency_percentiles", latency_percentiles(statistics.latencies)},
+    };
+  }
+
+  const auto seconds = std::chrono::duration<double>(_run_duration).count();
+
+  return nlohmann::json{
+      {"warehouses", _num_warehouses},
+      {"terminals", _num_terminals},
+      {"duration (s)", seconds},
+      {"transactions", transactions},
+      {"throughput (transactions/s)", seconds > 0.0 ? static_cast<double>(total_count) / seconds : 0.0},
+      {"abort_rate", total_count > 0 ? static_cast<double>(total_aborted) / static_cast<double>(total_count) : 0.0},
+      {"tpmC", tpmc()},
+      {"time_unit", "ns"},
+  };
+}
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <json.hpp>
+
+#include <map>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+#include "tpcc_transactions.hpp"
+
+namespace opossum {
+
+struct TpccTransactionStatistics {
+  size_t committed{0};
+  size_t rolled_back{0};
+  size_t aborted{0};
+
+  // Latencies of all executions, including the aborted ones
+  std::vector<Duration> latencies;
+};
+
+/**
+ * Runs the TPC-C transaction mix against the TPC-C tables in the StorageManager (see TpccTableGenerator).
+ *
+ * Each terminal is a thread that executes transactions in a closed loop. As in TPC-C 4.2.2, every terminal is bound to
+ * a home warehouse (terminal_id % num_warehouses). The transaction types are chosen with the minimum percentages of
+ * TPC-C 5.2.3 (45% NewOrder, 43% Payment, 4% OrderStatus, 4% Delivery, 4% StockLevel).
+ *
+ * Deviations from the specification:
+ *    - There are no keying and think times, i.e., the terminals issue transactions as fast as possible.
+ *    - Transactions that are aborted because of a conflict with a concurrent transaction (Hyrise's MVCC uses
+ *      first-writer-wins) are counted, but not retried.
+ *    - Delivery is executed as a single transaction for all ten districts and is not deferred.
+ */
+class TpccDriver {
+ public:
+  TpccDriver(const size_t num_warehouses, const size_t num_terminals);
+
+  /**
+   * Executes transactions until @param max_duration has passed or @param max_num_transactions transactions were
+   * executed by all terminals together, whichever comes first.
+   */
+  void run(const Duration max_duration, const size_t max_num_transactions);
+
+  const std::map<TpccTransactionType, TpccTransactionStatistics>& statistics() const;
+
+  // Completed (i.e., committed or rolled back) NewOrder transactions per minute of the last run()
+  double tpmc() const;
+
+  // Throughput, abort rates and latency percentiles per transaction type
+  nlohmann::json report() const;
+
+ protected:
+  const size_t _num_warehouses;
+  const size_t _num_terminals;
+
+  std::map<TpccTransactionType, TpccTransactionStatistics> _statistics;
+  Duration _run_duration{};
+};
+
+}  // namespace opossum
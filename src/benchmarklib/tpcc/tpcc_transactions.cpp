@@ -0,0 +1,455 @@
+#include "tpcc_transactions.hpp"
+
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "constants.hpp"
+#include "sql/sql_pipeline.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Maximum length of C_DATA, see TPC-C 1.3.1
+constexpr auto MAX_CUSTOMER_DATA_LENGTH = size_t{500};
+
+template <typename T>
+T get_value(const std::shared_ptr<const Table>& table, const ColumnID column_id, const size_t row_idx) {
+  auto chunk_offset = row_idx;
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (chunk_offset < chunk->size()) return type_cast<T>((*chunk->get_segment(column_id))[chunk_offset]);
+    chunk_offset -= chunk->size();
+  }
+  Fail("Row does not exist");
+}
+
+// Picks a warehouse other than @param warehouse_id (for remote order lines and payments)
+int32_t remote_warehouse_id(TpccRandomGenerator& random_generator, const size_t num_warehouses,
+                            const size_t warehouse_id) {
+  DebugAssert(num_warehouses > 1, "Need multiple warehouses to pick a remote one");
+  const auto remote_id = random_generator.random_number(size_t{0}, num_warehouses - 2);
+  return static_cast<int32_t>(remote_id >= warehouse_id ? remote_id + 1 : remote_id);
+}
+
+}  // namespace
+
+namespace opossum {
+
+AbstractTpccTransaction::AbstractTpccTransaction(TpccRandomGenerator& random_generator, const size_t num_warehouses,
+                                                 const size_t warehouse_id)
+    : num_warehouses(num_warehouses), w_id(static_cast<int32_t>(warehouse_id)) {
+  Assert(warehouse_id < num_warehouses, "Invalid warehouse id");
+}
+
+TpccTransactionResult AbstractTpccTransaction::execute() {
+  Assert(!_transaction_context, "Transaction was already executed");
+  _transaction_context = TransactionManager::get().new_transaction_context();
+
+  // _on_execute() returns Committed if all statements succeeded and the transaction can be committed
+  const auto result = _on_execute();
+  if (result == TpccTransactionResult::Committed) {
+    _transaction_context->commit();
+  }
+
+  return result;
+}
+
+std::optional<std::shared_ptr<const Table>> AbstractTpccTransaction::_execute_sql(const std::string& sql) {
+  auto sql_pipeline = SQLPipelineBuilder{sql}.with_transaction_context(_transaction_context).create_pipeline();
+  const auto& result_tables = sql_pipeline.get_result_tables();
+  if (sql_pipeline.failed_pipeline_statement()) return std::nullopt;
+
+  DebugAssert(result_tables.size() == 1, "Expected exactly one statement");
+  return result_tables.front();
+}
+
+std::optional<int32_t> AbstractTpccTransaction::_select_customer_id_by_last_name(const int32_t customer_w_id,
+                                                                                const int32_t customer_d_id,
+                                                                                const std::string& customer_last_name) {
+  const auto customers = _execute_sql("SELECT C_ID FROM CUSTOMER WHERE C_W_ID = " + std::to_string(customer_w_id) +
+                                      " AND C_D_ID = " + std::to_string(customer_d_id) + " AND C_LAST = '" +
+                                      customer_last_name + "' ORDER BY C_FIRST");
+  if (!customers) return std::nullopt;
+
+  // The generated data contains every possible last name in each district
+  const auto customer_count = (*customers)->row_count();
+  Assert(customer_count > 0, "No customer with last name " + customer_last_name);
+
+  return get_value<int32_t>(*customers, ColumnID{0}, (customer_count + 1) / 2 - 1);
+}
+
+TpccNewOrder::TpccNewOrder(TpccRandomGenerator& random_generator, const size_t num_warehouses,
+                           const size_t warehouse_id)
+    : AbstractTpccTransaction(random_generator, num_warehouses, warehouse_id) {
+  // TPC-C 2.4.1
+  d_id = random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1);
+  c_id = random_generator.nurand(1023, 1, NUM_CUSTOMERS_PER_DISTRICT) - 1;
+  o_entry_d = static_cast<int32_t>(std::time(nullptr));
+
+  const auto ol_cnt = random_generator.random_number(MIN_ORDER_LINE_COUNT, MAX_ORDER_LINE_COUNT);
+  order_lines.resize(ol_cnt);
+  for (auto& order_line : order_lines) {
+    order_line.ol_i_id = random_generator.nurand(8191, 1, NUM_ITEMS) - 1;
+    order_line.ol_supply_w_id = w_id;
+    if (num_warehouses > 1 && random_generator.random_number(1, 100) == 1) {
+      order_line.ol_supply_w_id = remote_warehouse_id(random_generator, num_warehouses, warehouse_id);
+    }
+    order_line.ol_quantity = random_generator.random_number(1, MAX_ORDER_LINE_QUANTITY);
+  }
+
+  // 1% of the orders contain an unused item id and are rolled back
+  if (random_generator.random_number(1, 100) == 1) {
+    order_lines.back().ol_i_id = NUM_ITEMS;
+  }
+}
+
+TpccTransactionType TpccNewOrder::type() const { return TpccTransactionType::NewOrder; }
+
+TpccTransactionResult TpccNewOrder::_on_execute() {
+  const auto w_id_str = std::to_string(w_id);
+  const auto d_id_str = std::to_string(d_id);
+
+  const auto warehouse = _execute_sql("SELECT W_TAX FROM WAREHOUSE WHERE W_ID = " + w_id_str);
+  if (!warehouse) return TpccTransactionResult::Aborted;
+
+  const auto district = _execute_sql("SELECT D_TAX, D_NEXT_O_ID FROM DISTRICT WHERE D_W_ID = " + w_id_str +
+                                     " AND D_ID = " + d_id_str);
+  if (!district) return TpccTransactionResult::Aborted;
+  const auto o_id = get_value<int32_t>(*district, ColumnID{1}, 0);
+
+  // Concurrent NewOrders for the same district conflict here
+  if (!_execute_sql("UPDATE DISTRICT SET D_NEXT_O_ID = " + std::to_string(o_id + 1) + " WHERE D_W_ID = " + w_id_str +
+                    " AND D_ID = " + d_id_str)) {
+    return TpccTransactionResult::Aborted;
+  }
+
+  const auto customer = _execute_sql("SELECT C_DISCOUNT, C_LAST, C_CREDIT FROM CUSTOMER WHERE C_W_ID = " + w_id_str +
+                                     " AND C_D_ID = " + d_id_str + " AND C_ID = " + std::to_string(c_id));
+  if (!customer) return TpccTransactionResult::Aborted;
+
+  auto all_local = true;
+  for (const auto& order_line : order_lines) {
+    all_local &= order_line.ol_supply_w_id == w_id;
+  }
+
+  const auto o_id_str = std::to_string(o_id);
+  if (!_execute_sql("INSERT INTO \"ORDER\" (O_ID, O_D_ID, O_W_ID, O_C_ID, O_ENTRY_D, O_CARRIER_ID, O_OL_CNT, "
+                    "O_ALL_LOCAL) VALUES (" +
+                    o_id_str + ", " + d_id_str + ", " + w_id_str + ", " + std::to_string(c_id) + ", " +
+                    std::to_string(o_entry_d) + ", -1, " + std::to_string(order_lines.size()) + ", " +
+                    std::to_string(all_local ? 1 : 0) + ")")) {
+    return TpccTransactionResult::Aborted;
+  }
+
+  if (!_execute_sql("INSERT INTO NEW_ORDER (NO_O_ID, NO_D_ID, NO_W_ID) VALUES (" + o_id_str + ", " + d_id_str + ", " +
+                    w_id_str + ")")) {
+    return TpccTransactionResult::Aborted;
+  }
+
+  // The S_DIST_xx column holding the district information
+  std::stringstream dist_column_stream;
+  dist_column_stream << "S_DIST_" << std::setw(2) << std::setfill('0') << (d_id + 1);
+  const auto dist_column = dist_column_stream.str();
+
+  for (auto ol_number = size_t{0}; ol_number < order_lines.size(); ++ol_number) {
+    const auto& order_line = order_lines[ol_number];
+    const auto ol_i_id_str = std::to_string(order_line.ol_i_id);
+    const auto ol_supply_w_id_str = std::to_string(order_line.ol_supply_w_id);
+
+    const auto item = _execute_sql("SELECT I_PRICE, I_NAME, I_DATA FROM ITEM WHERE I_ID = " + ol_i_id_str);
+    if (!item) return TpccTransactionResult::Aborted;
+    if ((*item)->row_count() == 0) {
+      // Unused item id, TPC-C 2.4.2.3
+      _transaction_context->rollback();
+      return TpccTransactionResult::RolledBack;
+    }
+    const auto i_price = get_value<float>(*item, ColumnID{0}, 0);
+
+    const auto stock = _execute_sql("SELECT S_QUANTITY, " + dist_column + " FROM STOCK WHERE S_I_ID = " +
+                                    ol_i_id_str + " AND S_W_ID = " + ol_supply_w_id_str);
+    if (!stock) return TpccTransactionResult::Aborted;
+    const auto s_quantity = get_value<int32_t>(*stock, ColumnID{0}, 0);
+    const auto s_dist_info = get_value<std::string>(*stock, ColumnID{1}, 0);
+
+    const auto new_s_quantity = s_quantity >= order_line.ol_quantity + 10 ? s_quantity - order_line.ol_quantity
+                                                                         : s_quantity - order_line.ol_quantity + 91;
+    const auto is_remote = order_line.ol_supply_w_id != w_id;
+    if (!_execute_sql("UPDATE STOCK SET S_QUANTITY = " + std::to_string(new_s_quantity) +
+                      ", S_YTD = S_YTD + " + std::to_string(order_line.ol_quantity) +
+                      ", S_ORDER_CNT = S_ORDER_CNT + 1, S_REMOTE_CNT = S_REMOTE_CNT + " +
+                      std::to_string(is_remote ? 1 : 0) + " WHERE S_I_ID = " + ol_i_id_str +
+                      " AND S_W_ID = " + ol_supply_w_id_str)) {
+      return TpccTransactionResult::Aborted;
+    }
+
+    const auto ol_amount = static_cast<float>(order_line.ol_quantity) * i_price;
+    if (!_execute_sql("INSERT INTO ORDER_LINE (OL_O_ID, OL_D_ID, OL_W_ID, OL_NUMBER, OL_I_ID, OL_SUPPLY_W_ID, "
+                      "OL_DELIVERY_D, OL_QUANTITY, OL_AMOUNT, OL_DIST_INFO) VALUES (" +
+                      o_id_str + ", " + d_id_str + ", " + w_id_str + ", " + std::to_string(ol_number) + ", " +
+                      ol_i_id_str + ", " + ol_supply_w_id_str + ", -1, " + std::to_string(order_line.ol_quantity) +
+                      ", " + std::to_string(ol_amount) + ", '" + s_dist_info + "')")) {
+      return TpccTransactionResult::Aborted;
+    }
+  }
+
+  return TpccTransactionResult::Committed;
+}
+
+TpccPayment::TpccPayment(TpccRandomGenerator& random_generator, const size_t num_warehouses,
+                         const size_t warehouse_id)
+    : AbstractTpccTransaction(random_generator, num_warehouses, warehouse_id) {
+  // TPC-C 2.5.1
+  d_id = random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1);
+
+  // 85% of the payments are made at the home warehouse of the customer
+  if (num_warehouses == 1 || random_generator.random_number(1, 100) <= 85) {
+    c_w_id = w_id;
+    c_d_id = d_id;
+  } else {
+    c_w_id = remote_warehouse_id(random_generator, num_warehouses, warehouse_id);
+    c_d_id = random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1);
+  }
+
+  // 60% of the customers are selected by their last name
+  if (random_generator.random_number(1, 100) <= 60) {
+    c_last = random_generator.last_name(random_generator.nurand(255, 0, 999));
+  } else {
+    c_id = random_generator.nurand(1023, 1, NUM_CUSTOMERS_PER_DISTRICT) - 1;
+  }
+
+  h_amount = random_generator.random_number(100, 500'000) / 100.0f;
+  h_date = static_cast<int32_t>(std::time(nullptr));
+}
+
+TpccTransactionType TpccPayment::type() const { return TpccTransactionType::Payment; }
+
+TpccTransactionResult TpccPayment::_on_execute() {
+  const auto w_id_str = std::to_string(w_id);
+  const auto d_id_str = std::to_string(d_id);
+  const auto h_amount_str = std::to_string(h_amount);
+
+  // Concurrent Payments for the same warehouse conflict here
+  if (!_execute_sql("UPDATE WAREHOUSE SET W_YTD = W_YTD + " + h_amount_str + " WHERE W_ID = " + w_id_str)) {
+    return TpccTransactionResult::Aborted;
+  }
+
+  const auto warehouse = _execute_sql(
+      "SELECT W_NAME, W_STREET_1, W_STREET_2, W_CITY, W_STATE, W_ZIP FROM WAREHOUSE WHERE W_ID = " + w_id_str);
+  if (!warehouse) return TpccTransactionResult::Aborted;
+
+  if (!_execute_sql("UPDATE DISTRICT SET D_YTD = D_YTD + " + h_amount_str + " WHERE D_W_ID = " + w_id_str +
+                    " AND D_ID = " + d_id_str)) {
+    return TpccTransactionResult::Aborted;
+  }
+
+  const auto district = _execute_sql(
+      "SELECT D_NAME, D_STREET_1, D_STREET_2, D_CITY, D_STATE, D_ZIP FROM DISTRICT WHERE D_W_ID = " + w_id_str +
+      " AND D_ID = " + d_id_str);
+  if (!district) return TpccTransactionResult::Aborted;
+
+  auto customer_id = c_id;
+  if (!customer_id) {
+    customer_id = _select_customer_id_by_last_name(c_w_id, c_d_id, c_last);
+    if (!customer_id) return TpccTransactionResult::Aborted;
+  }
+
+  const auto customer_predicate = " WHERE C_W_ID = " + std::to_string(c_w_id) + " AND C_D_ID = " +
+                                  std::to_string(c_d_id) + " AND C_ID = " + std::to_string(*customer_id);
+
+  const auto customer = _execute_sql("SELECT C_CREDIT, C_DATA FROM CUSTOMER" + customer_predicate);
+  if (!customer) return TpccTransactionResult::Aborted;
+
+  // Customers with bad credit get the payment prepended to their C_DATA, TPC-C 2.5.2.2
+  auto c_data_update = std::string{};
+  if (get_value<std::string>(*customer, ColumnID{0}, 0) == "BC") {
+    auto c_data = std::to_string(*customer_id) + " " + std::to_string(c_d_id) + " " + std::to_string(c_w_id) + " " +
+                  d_id_str + " " + w_id_str + " " + h_amount_str + " " +
+                  get_value<std::string>(*customer, ColumnID{1}, 0);
+    c_data.resize(std::min(c_data.size(), MAX_CUSTOMER_DATA_LENGTH));
+    c_data_update = ", C_DATA = '" + c_data + "'";
+  }
+
+  if (!_execute_sql("UPDATE CUSTOMER SET C_BALANCE = C_BALANCE - " + h_amount_str +
+                    ", C_YTD_PAYMENT = C_YTD_PAYMENT + " + h_amount_str + ", C_PAYMENT_CNT = C_PAYMENT_CNT + 1" +
+                    c_data_update + customer_predicate)) {
+    return TpccTransactionResult::Aborted;
+  }
+
+  const auto h_data = get_value<std::string>(*warehouse, ColumnID{0}, 0) + "    " +
+                      get_value<std::string>(*district, ColumnID{0}, 0);
+  if (!_execute_sql("INSERT INTO HISTORY (H_C_ID, H_C_D_ID, H_C_W_ID, H_DATE, H_AMOUNT, H_DATA) VALUES (" +
+                    std::to_string(*customer_id) + ", " + std::to_string(c_d_id) + ", " + std::to_string(c_w_id) +
+                    ", " + std::to_string(h_date) + ", " + h_amount_str + ", '" + h_data + "')")) {
+    return TpccTransactionResult::Aborted;
+  }
+
+  return TpccTransactionResult::Committed;
+}
+
+TpccOrderStatus::TpccOrderStatus(TpccRandomGenerator& random_generator, const size_t num_warehouses,
+                                 const size_t warehouse_id)
+    : AbstractTpccTransaction(random_generator, num_warehouses, warehouse_id) {
+  // TPC-C 2.6.1
+  d_id = random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1);
+
+  // 60% of the customers are selected by their last name
+  if (random_generator.random_number(1, 100) <= 60) {
+    c_last = random_generator.last_name(random_generator.nurand(255, 0, 999));
+  } else {
+    c_id = random_generator.nurand(1023, 1, NUM_CUSTOMERS_PER_DISTRICT) - 1;
+  }
+}
+
+TpccTransactionType TpccOrderStatus::type() const { return TpccTransactionType::OrderStatus; }
+
+TpccTransactionResult TpccOrderStatus::_on_execute() {
+  const auto w_id_str = std::to_string(w_id);
+  const auto d_id_str = std::to_string(d_id);
+
+  auto customer_id = c_id;
+  if (!customer_id) {
+    customer_id = _select_customer_id_by_last_name(w_id, d_id, c_last);
+    if (!customer_id) return TpccTransactionResult::Aborted;
+  }
+  const auto customer_id_str = std::to_string(*customer_id);
+
+  const auto customer = _execute_sql("SELECT C_BALANCE, C_FIRST, C_MIDDLE, C_LAST FROM CUSTOMER WHERE C_W_ID = " +
+                                     w_id_str + " AND C_D_ID = " + d_id_str + " AND C_ID = " + customer_id_str);
+  if (!customer) return TpccTransactionResult::Aborted;
+
+  const auto order = _execute_sql("SELECT O_ID, O_ENTRY_D, O_CARRIER_ID FROM \"ORDER\" WHERE O_W_ID = " + w_id_str +
+                                  " AND O_D_ID = " + d_id_str + " AND O_C_ID = " + customer_id_str +
+                                  " ORDER BY O_ID DESC LIMIT 1");
+  if (!order) return TpccTransactionResult::Aborted;
+
+  if ((*order)->row_count() > 0) {
+    const auto o_id = get_value<int32_t>(*order, ColumnID{0}, 0);
+    const auto order_lines = _execute_sql(
+        "SELECT OL_I_ID, OL_SUPPLY_W_ID, OL_QUANTITY, OL_AMOUNT, OL_DELIVERY_D FROM ORDER_LINE WHERE OL_W_ID = " +
+        w_id_str + " AND OL_D_ID = " + d_id_str + " AND OL_O_ID = " + std::to_string(o_id));
+    if (!order_lines) return TpccTransactionResult::Aborted;
+  }
+
+  return TpccTransactionResult::Committed;
+}
+
+TpccDelivery::TpccDelivery(TpccRandomGenerator& random_generator, const size_t num_warehouses,
+                           const size_t warehouse_id)
+    : AbstractTpccTransaction(random_generator, num_warehouses, warehouse_id) {
+  // TPC-C 2.7.1
+  o_carrier_id = random_generator.random_number(MIN_CARRIER_ID, MAX_CARRIER_ID);
+  ol_delivery_d = static_cast<int32_t>(std::time(nullptr));
+}
+
+TpccTransactionType TpccDelivery::type() const { return TpccTransactionType::Delivery; }
+
+TpccTransactionResult TpccDelivery::_on_execute() {
+  const auto w_id_str = std::to_string(w_id);
+
+  // Deliver the oldest undelivered order of each district. Unlike in TPC-C 2.7.2, this is executed as one transaction
+  // instead of one per district.
+  for (auto d_id = 0; d_id < NUM_DISTRICTS_PER_WAREHOUSE; ++d_id) {
+    const auto d_id_str = std::to_string(d_id);
+
+    const auto new_order = _execute_sql("SELECT NO_O_ID FROM NEW_ORDER WHERE NO_W_ID = " + w_id_str +
+                                        " AND NO_D_ID = " + d_id_str + " ORDER BY NO_O_ID LIMIT 1");
+    if (!new_order) return TpccTransactionResult::Aborted;
+    if ((*new_order)->row_count() == 0) continue;
+
+    const auto o_id_str = std::to_string(get_value<int32_t>(*new_order, ColumnID{0}, 0));
+
+    // Concurrent Deliveries for the same warehouse conflict here
+    if (!_execute_sql("DELETE FROM NEW_ORDER WHERE NO_W_ID = " + w_id_str + " AND NO_D_ID = " + d_id_str +
+                      " AND NO_O_ID = " + o_id_str)) {
+      return TpccTransactionResult::Aborted;
+    }
+
+    const auto order_predicate =
+        " WHERE O_W_ID = " + w_id_str + " AND O_D_ID = " + d_id_str + " AND O_ID = " + o_id_str;
+    const auto order = _execute_sql("SELECT O_C_ID FROM \"ORDER\"" + order_predicate);
+    if (!order) return TpccTransactionResult::Aborted;
+    const auto c_id = get_value<int32_t>(*order, ColumnID{0}, 0);
+
+    if (!_execute_sql("UPDATE \"ORDER\" SET O_CARRIER_ID = " + std::to_string(o_carrier_id) + order_predicate)) {
+      return TpccTransactionResult::Aborted;
+    }
+
+    const auto order_line_predicate =
+        " WHERE OL_W_ID = " + w_id_str + " AND OL_D_ID = " + d_id_str + " AND OL_O_ID = " + o_id_str;
+    if (!_execute_sql("UPDATE ORDER_LINE SET OL_DELIVERY_D = " + std::to_string(ol_delivery_d) +
+                      order_line_predicate)) {
+      return TpccTransactionResult::Aborted;
+    }
+
+    const auto amount = _execute_sql("SELECT SUM(OL_AMOUNT) FROM ORDER_LINE" + order_line_predicate);
+    if (!amount) return TpccTransactionResult::Aborted;
+
+    if (!_execute_sql("UPDATE CUSTOMER SET C_BALANCE = C_BALANCE + " +
+                      std::to_string(get_value<double>(*amount, ColumnID{0}, 0)) +
+                      ", C_DELIVERY_CNT = C_DELIVERY_CNT + 1 WHERE C_W_ID = " + w_id_str + " AND C_D_ID = " +
+                      d_id_str + " AND C_ID = " + std::to_string(c_id))) {
+      return TpccTransactionResult::Aborted;
+    }
+  }
+
+  return TpccTransactionResult::Committed;
+}
+
+TpccStockLevel::TpccStockLevel(TpccRandomGenerator& random_generator, const size_t num_warehouses,
+                               const size_t warehouse_id)
+    : AbstractTpccTransaction(random_generator, num_warehouses, warehouse_id) {
+  // TPC-C 2.8.1
+  d_id = random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1);
+  threshold = random_generator.random_number(10, 20);
+}
+
+TpccTransactionType TpccStockLevel::type() const { return TpccTransactionType::StockLevel; }
+
+TpccTransactionResult TpccStockLevel::_on_execute() {
+  const auto w_id_str = std::to_string(w_id);
+  const auto d_id_str = std::to_string(d_id);
+
+  const auto district =
+      _execute_sql("SELECT D_NEXT_O_ID FROM DISTRICT WHERE D_W_ID = " + w_id_str + " AND D_ID = " + d_id_str);
+  if (!district) return TpccTransactionResult::Aborted;
+  const auto next_o_id = get_value<int32_t>(*district, ColumnID{0}, 0);
+
+  // Items of the last 20 orders of the district whose stock is below the threshold
+  const auto low_stock = _execute_sql(
+      "SELECT COUNT(DISTINCT S_I_ID) FROM ORDER_LINE, STOCK WHERE OL_W_ID = " + w_id_str + " AND OL_D_ID = " +
+      d_id_str + " AND OL_O_ID < " + std::to_string(next_o_id) + " AND OL_O_ID >= " + std::to_string(next_o_id - 20) +
+      " AND S_W_ID = " + w_id_str + " AND S_I_ID = OL_I_ID AND S_QUANTITY < " + std::to_string(threshold));
+  if (!low_stock) return TpccTransactionResult::Aborted;
+  low_stock_count = get_value<int64_t>(*low_stock, ColumnID{0}, 0);
+
+  return TpccTransactionResult::Committed;
+}
+
+std::unique_ptr<AbstractTpccTransaction> make_tpcc_transaction(const TpccTransactionType type,
+                                                               TpccRandomGenerator& random_generator,
+                                                               const size_t num_warehouses, const size_t warehouse_id) {
+  switch (type) {
+    case TpccTransactionType::NewOrder:
+      return std::make_unique<TpccNewOrder>(random_generator, num_warehouses, warehouse_id);
+    case TpccTransactionType::Payment:
+      return std::make_unique<TpccPayment>(random_generator, num_warehouses, warehouse_id);
+    case TpccTransactionType::OrderStatus:
+      return std::make_unique<TpccOrderStatus>(random_generator, num_warehouses, warehouse_id);
+    case TpccTransactionType::Delivery:
+      return std::make_unique<TpccDelivery>(random_generator, num_warehouses, warehouse_id);
+    case TpccTransactionType::StockLevel:
+      return std::make_unique<TpccStockLevel>(random_generator, num_warehouses, warehouse_id);
+  }
+  Fail("Invalid TpccTransactionType");
+}
+
+}  // namespace opossum
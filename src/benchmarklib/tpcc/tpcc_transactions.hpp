@@ -0,0 +1,151 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "tpcc_random_generator.hpp"
+
+namespace opossum {
+
+class Table;
+class TransactionContext;
+
+enum class TpccTransactionType { NewOrder, Payment, OrderStatus, Delivery, StockLevel };
+
+/**
+ * Committed:  The transaction was committed
+ * RolledBack: The transaction rolled itself back as demanded by the specification (1% of the NewOrder transactions
+ *             use an unused item id). According to TPC-C, these still count as completed transactions.
+ * Aborted:    The transaction was aborted because of a conflict with a concurrent transaction
+ */
+enum class TpccTransactionResult { Committed, RolledBack, Aborted };
+
+/**
+ * The five TPC-C transactions (TPC-C v5.11.0, Clause 2), executed as SQL statements through the SQLPipeline within
+ * one TransactionContext each.
+ *
+ * The input data of a transaction is generated in its constructor as specified in TPC-C, based on the home warehouse
+ * of the terminal that executes it. The inputs are public so that they can be inspected (and modified) by tests.
+ *
+ * IDs are zero-based, matching the data generated by the TpccTableGenerator.
+ */
+class AbstractTpccTransaction {
+ public:
+  AbstractTpccTransaction(TpccRandomGenerator& random_generator, const size_t num_warehouses,
+                          const size_t warehouse_id);
+  virtual ~AbstractTpccTransaction() = default;
+
+  virtual TpccTransactionType type() const = 0;
+
+  // Runs the transaction in a new TransactionContext. Can only be called once.
+  TpccTransactionResult execute();
+
+  const size_t num_warehouses;
+  int32_t w_id;
+
+ protected:
+  virtual TpccTransactionResult _on_execute() = 0;
+
+  // Executes a single SQL statement within the transaction. Returns std::nullopt if it caused the transaction to abort,
+  // otherwise the result table (which is nullptr for statements without a result, e.g., UPDATE).
+  std::optional<std::shared_ptr<const Table>> _execute_sql(const std::string& sql);
+
+  // Selects a customer by last name as described in TPC-C 2.5.2.2: the row at position ceil(n/2) of all matching
+  // customers sorted by C_FIRST is used. @return the C_ID or std::nullopt if the transaction was aborted.
+  std::optional<int32_t> _select_customer_id_by_last_name(const int32_t customer_w_id, const int32_t customer_d_id,
+                                                          const std::string& customer_last_name);
+
+  std::shared_ptr<TransactionContext> _transaction_context;
+};
+
+class TpccNewOrder : public AbstractTpccTransaction {
+ public:
+  TpccNewOrder(TpccRandomGenerator& random_generator, const size_t num_warehouses, const size_t warehouse_id);
+
+  TpccTransactionType type() const override;
+
+  struct OrderLine {
+    int32_t ol_i_id;
+    int32_t ol_supply_w_id;
+    int32_t ol_quantity;
+  };
+
+  int32_t d_id;
+  int32_t c_id;
+  int32_t o_entry_d;
+  std::vector<OrderLine> order_lines;
+
+ protected:
+  TpccTransactionResult _on_execute() override;
+};
+
+class TpccPayment : public AbstractTpccTransaction {
+ public:
+  TpccPayment(TpccRandomGenerator& random_generator, const size_t num_warehouses, const size_t warehouse_id);
+
+  TpccTransactionType type() const override;
+
+  int32_t d_id;
+  int32_t c_w_id;
+  int32_t c_d_id;
+  // The customer is either selected by its id or by its last name
+  std::optional<int32_t> c_id;
+  std::string c_last;
+  float h_amount;
+  int32_t h_date;
+
+ protected:
+  TpccTransactionResult _on_execute() override;
+};
+
+class TpccOrderStatus : public AbstractTpccTransaction {
+ public:
+  TpccOrderStatus(TpccRandomGenerator& random_generator, const size_t num_warehouses, const size_t warehouse_id);
+
+  TpccTransactionType type() const override;
+
+  int32_t d_id;
+  // The customer is either selected by its id or by its last name
+  std::optional<int32_t> c_id;
+  std::string c_last;
+
+ protected:
+  TpccTransactionResult _on_execute() override;
+};
+
+class TpccDelivery : public AbstractTpccTransaction {
+ public:
+  TpccDelivery(TpccRandomGenerator& random_generator, const size_t num_warehouses, const size_t warehouse_id);
+
+  TpccTransactionType type() const override;
+
+  int32_t o_carrier_id;
+  int32_t ol_delivery_d;
+
+ protected:
+  TpccTransactionResult _on_execute() override;
+};
+
+class TpccStockLevel : public AbstractTpccTransaction {
+ public:
+  TpccStockLevel(TpccRandomGenerator& random_generator, const size_t num_warehouses, const size_t warehouse_id);
+
+  TpccTransactionType type() const override;
+
+  int32_t d_id;
+  int32_t threshold;
+
+  // Number of recently sold items below the threshold, set by execute()
+  int64_t low_stock_count{0};
+
+ protected:
+  TpccTransactionResult _on_execute() override;
+};
+
+std::unique_ptr<AbstractTpccTransaction> make_tpcc_transaction(const TpccTransactionType type,
+                                                               TpccRandomGenerator& random_generator,
+                                                               const size_t num_warehouses, const size_t warehouse_id);
+
+}  // namespace opossum
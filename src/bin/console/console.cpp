@@ -41,6 +41,7 @@
 #include "utils/filesystem.hpp"
 #include "utils/invalid_input_exception.hpp"
 #include "utils/load_table.hpp"
+#include "utils/query_cancelled_exception.hpp"
 
 #define ANSI_COLOR_RED "\x1B[31m"
 #define ANSI_COLOR_GREEN "\x1B[32m"
@@ -238,6 +239,9 @@ bool Console::_initialize_pipeline(const std::string& sql) {
     if (_explicitly_created_transaction_context != nullptr) {
       builder.with_transaction_context(_explicitly_created_transaction_context);
     }
+    if (_statement_timeout) {
+      builder.with_statement_timeout(*_statement_timeout);
+    }
     _sql_pipeline = std::make_unique<SQLPipeline>(builder.create_pipeline());
   } catch (const InvalidInputException& exception) {
     out(std::string(exception.what()) + '\n');
@@ -251,17 +255,24 @@ int Console::_eval_sql(const std::string& sql) {
   if (!_initialize_pipeline(sql)) return ReturnCode::Error;
 
   try {
+    _is_executing_sql_pipeline = true;
     _sql_pipeline->get_result_tables();
+    _is_executing_sql_pipeline = false;
     Assert(!_sql_pipeline->failed_pipeline_statement(),
            "The transaction has failed. This should never happen in the console, where only one statement gets "
            "executed at a time.");
   } catch (const InvalidInputException& exception) {
+    _is_executing_sql_pipeline = false;
     out(std::string(exception.what()) + "\n");
     if (_handle_rollback() && _explicitly_created_transaction_context == nullptr &&
         _sql_pipeline->statement_count() > 1) {
       out("All previous statements have been committed.\n");
     }
     return ReturnCode::Error;
+  } catch (const QueryCancelledException& exception) {
+    _is_executing_sql_pipeline = false;
+    out(std::string(exception.what()) + "\n");
+    return ReturnCode::Error;
   }
 
   const auto& table = _sql_pipeline->get_result_table();
@@ -377,7 +388,8 @@ int Console::_help(const std::string&) {
   out("  quit                             - Exit the HYRISE Console\n");
   out("  help                             - Show this message\n\n");
   out("  setting [property] [value]       - Change a runtime setting\n\n");
-  out("           scheduler (on|off)      - Turn the scheduler on (default) or off\n\n");
+  out("           scheduler (on|off)      - Turn the scheduler on (default) or off\n");
+  out("           statement_timeout (MS|off) - Abort statements after MS milliseconds (default: off)\n\n");
   out("After TPC-C tables are generated, SQL queries can be executed.\n");
   out("Example:\n");
   out("SELECT * FROM DISTRICT\n");
@@ -628,6 +640,29 @@ int Console::_change_runtime_setting(const std::string& input) {
     return 0;
   }
 
+  if (property == "statement_timeout") {
+    if (value == "off") {
+      _statement_timeout.reset();
+      out("Statement timeout turned off\n");
+      return 0;
+    }
+
+    auto statement_timeout_ms = int64_t{0};
+    try {
+      statement_timeout_ms = std::stoll(value);
+    } catch (const std::exception&) {
+      statement_timeout_ms = 0;
+    }
+    if (statement_timeout_ms <= 0) {
+      out("Usage: statement_timeout (MS|off)\n");
+      return 1;
+    }
+
+    _statement_timeout = std::chrono::milliseconds{statement_timeout_ms};
+    out("Statement timeout set to " + std::to_string(statement_timeout_ms) + " ms\n");
+    return 0;
+  }
+
   out("Unknown property\n");
   return 1;
 }
@@ -668,8 +703,16 @@ int Console::_exec_script(const std::string& script_file) {
 
 void Console::handle_signal(int sig) {
   if (sig == SIGINT) {
-    // Reset console state
     auto& console = Console::get();
+
+    // Cancel the running query instead of jumping out of it. Otherwise, the tasks of the query would keep running on
+    // the scheduler. The query is aborted with a QueryCancelledException at its next chunk or partition boundary.
+    if (console._is_executing_sql_pipeline) {
+      console._sql_pipeline->cancellation_token()->cancel();
+      return;
+    }
+
+    // Reset console state
     console._out << "\n";
     console._multiline_input = "";
     console.set_prompt("!> ");
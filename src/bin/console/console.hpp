@@ -1,8 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -80,7 +83,7 @@ class Console {
 
   /*
    * Handler for SIGINT signal (caused by CTRL-C key sequence).
-   * Resets the Console state and clears the current line.
+   * Cancels the running query, if any. Otherwise, resets the Console state and clears the current line.
    */
   static void handle_signal(int sig);
 
@@ -144,6 +147,8 @@ class Console {
   bool _verbose;
 
   std::unique_ptr<SQLPipeline> _sql_pipeline;
+  std::atomic_bool _is_executing_sql_pipeline{false};
+  std::optional<std::chrono::milliseconds> _statement_timeout;
   std::shared_ptr<TransactionContext> _explicitly_created_transaction_context;
   std::shared_ptr<PreparedStatementCache> _prepared_statements;
 };
@@ -4,6 +4,7 @@
 #include <cstdlib>
 #include <iostream>
 
+#include "concurrency/garbage_collector.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/topology.hpp"
@@ -26,6 +27,10 @@ int main(int argc, char* argv[]) {
     // Set scheduler so that the server can execute the tasks on separate threads.
     opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>());
 
+    // All statements of the server are executed within transactions, so that the garbage collector can safely release
+    // chunks that have been compacted.
+    opossum::GarbageCollector::get().resume();
+
     boost::asio::io_service io_service;
 
     // The server registers itself to the boost io_service. The io_service is the main IO control unit here and it lives
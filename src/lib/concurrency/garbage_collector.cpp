@@ -0,0 +1,141 @@
+#include "garbage_collector.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_manager.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "tasks/chunk_compaction_task.hpp"
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+GarbageCollector& GarbageCollector::get() {
+  static GarbageCollector instance;
+  return instance;
+}
+
+GarbageCollector::GarbageCollector() {
+  _loop_thread = std::make_unique<PausableLoopThread>(_options.interval, [this](size_t) { collect(); });
+}
+
+const GarbageCollector::Options& GarbageCollector::options() const { return _options; }
+
+void GarbageCollector::set_options(const Options& options) {
+  Assert(options.invalid_row_ratio_threshold > 0.0 && options.invalid_row_ratio_threshold <= 1.0,
+         "Threshold has to be in (0, 1]");
+
+  std::lock_guard<std::mutex> lock(_collect_mutex);
+  _options = options;
+  _loop_thread->set_loop_sleep_time(_options.interval);
+}
+
+void GarbageCollector::resume() { _loop_thread->resume(); }
+
+void GarbageCollector::pause() { _loop_thread->pause(); }
+
+void GarbageCollector::collect() {
+  std::lock_guard<std::mutex> lock(_collect_mutex);
+
+  auto& storage_manager = StorageManager::get();
+  for (const auto& table_name : storage_manager.table_names()) {
+    if (!storage_manager.has_table(table_name)) continue;
+
+    const auto table = storage_manager.get_table(table_name);
+    if (table->has_mvcc() == UseMvcc::No) continue;
+
+    const auto released_row_count = _collect_table(table_name, table);
+    if (released_row_count == 0) continue;
+
+    // All released rows were invalid. Adjusting the row counts of the statistics suffices, as the distribution of the
+    // valid rows did not change.
+    const auto table_statistics = table->table_statistics();
+    if (!table_statistics) continue;
+
+    const auto invalid_row_count =
+        static_cast<uint64_t>(table_statistics->row_count()) - table_statistics->approx_valid_row_count();
+    auto adjusted_table_statistics =
+        std::make_shared<TableStatistics>(table_statistics->table_type(), static_cast<float>(table->row_count()),
+                                          table_statistics->column_statistics());
+    adjusted_table_statistics->increase_invalid_row_count(
+        invalid_row_count > released_row_count ? invalid_row_count - released_row_count : 0);
+    table->set_table_statistics(adjusted_table_statistics);
+  }
+}
+
+uint64_t GarbageCollector::_collect_table(const std::string& table_name, const std::shared_ptr<Table>& table) {
+  auto released_row_count = uint64_t{0};
+  const auto lowest_snapshot_commit_id = TransactionManager::get().lowest_active_snapshot_commit_id();
+
+  auto chunks_to_compact = std::vector<ChunkID>{};
+
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (chunk->size() == 0) continue;
+
+    // Phase 2: Release the data of chunks that were compacted before the snapshot of all active transactions
+    const auto cleanup_commit_id = chunk->get_cleanup_commit_id();
+    if (cleanup_commit_id) {
+      if (lowest_snapshot_commit_id && *lowest_snapshot_commit_id <= *cleanup_commit_id) continue;
+
+      // Besides the table and this function, the chunk is held by the copies of the table that GetTable created for
+      // transactions, including those that started before the compaction. These copies might still be referenced by
+      // results that outlived their transaction. Operators that are scanning the chunk hold it as well.
+      if (chunk.use_count() > 2) continue;
+
+      released_row_count += chunk->size();
+
+      for (const auto& index_info : table->get_indexes()) {
+        const auto index = chunk->get_index(index_info.type, index_info.column_ids);
+        if (index) chunk->remove_index(index);
+      }
+
+      for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+        resolve_data_type(table->column_data_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          chunk->replace_segment(column_id,
+                                 std::make_shared<ValueSegment<ColumnDataType>>(table->column_is_nullable(column_id)));
+        });
+      }
+      chunk->set_mvcc_data(std::make_shared<MvccData>(0));
+      continue;
+    }
+
+    // Phase 1: Find completed chunks with too many invalid rows
+    if (chunk->is_mutable() && chunk->size() < table->max_chunk_size()) continue;
+
+    auto invalid_row_count = size_t{0};
+    auto has_pending_inserts = false;
+    {
+      const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        if (mvcc_data->begin_cids[chunk_offset] == MvccData::MAX_COMMIT_ID) {
+          has_pending_inserts = true;
+          break;
+        }
+        if (mvcc_data->end_cids[chunk_offset] != MvccData::MAX_COMMIT_ID) ++invalid_row_count;
+      }
+    }
+    if (has_pending_inserts) continue;
+
+    const auto invalid_row_ratio = static_cast<double>(invalid_row_count) / chunk->size();
+    if (invalid_row_ratio > _options.invalid_row_ratio_threshold) chunks_to_compact.emplace_back(chunk_id);
+  }
+
+  if (!chunks_to_compact.empty()) {
+    const auto compaction_task = std::make_shared<ChunkCompactionTask>(table_name, chunks_to_compact);
+    compaction_task->execute();
+  }
+
+  return released_row_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * The GarbageCollector is a singleton that removes rows which are not visible to any transaction anymore. Deleted and
+ * updated rows are only invalidated in the MVCC data, so that without it, tables with frequent updates keep growing
+ * and scans keep touching invalid rows.
+ *
+ * Each run consists of two phases for every table with MVCC data:
+ *  (1) Logical: Completed chunks with a ratio of invalid rows above invalid_row_ratio_threshold are compacted by a
+ *      ChunkCompactionTask, which moves their valid rows to the end of the table and marks the chunks with a cleanup
+ *      commit id. Transactions with a newer snapshot exclude the chunks in GetTable.
+ *  (2) Physical: Once the lowest snapshot commit id of all active transactions is larger than the cleanup commit id
+ *      of a compacted chunk and no copy of the table created by GetTable (e.g., in a result that outlived its
+ *      transaction) references the chunk anymore, its segments, indexes, and MVCC data are
+ *      replaced by empty ones. The chunk itself stays in the table so that ChunkIDs remain stable. The row counts of
+ *      the table statistics are adjusted for the released rows.
+ *
+ * Reading a table without a transaction context while the GarbageCollector is running is not safe, as the rows of
+ * the compacted chunks might be released while being accessed.
+ *
+ * The GarbageCollector is initialized in a paused state and needs to be `resumed` to run periodically. collect() runs
+ * a single pass synchronously.
+ */
+class GarbageCollector : private Noncopyable {
+ public:
+  struct Options {
+    // The time interval between two runs
+    std::chrono::milliseconds interval = std::chrono::seconds(1);
+
+    // Chunks with a larger ratio of invalid rows are compacted
+    double invalid_row_ratio_threshold = 0.5;
+  };
+
+  static GarbageCollector& get();
+
+  const Options& options() const;
+  void set_options(const Options& options);
+
+  void resume();
+  void pause();
+
+  void collect();
+
+ private:
+  GarbageCollector();
+
+  // Returns the number of rows that were released
+  uint64_t _collect_table(const std::string& table_name, const std::shared_ptr<Table>& table);
+
+  Options _options;
+  std::mutex _collect_mutex;
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+};
+
+}  // namespace opossum
@@ -17,6 +17,8 @@ TransactionContext::TransactionContext(const TransactionID transaction_id, const
       _num_active_operators{0} {}
 
 TransactionContext::~TransactionContext() {
+  TransactionManager::get()._deregister_transaction(_transaction_id);
+
   DebugAssert(([this]() {
                 auto an_operator_failed = false;
                 for (const auto& op : _rw_operators) {
@@ -1,5 +1,6 @@
 #include "transaction_manager.hpp"
 
+#include <algorithm>
 #include <memory>
 
 #include "commit_context.hpp"
@@ -18,6 +19,9 @@ void TransactionManager::reset() {
   manager._next_transaction_id = INITIAL_TRANSACTION_ID;
   manager._last_commit_id = INITIAL_COMMIT_ID;
   manager._last_commit_context = std::make_shared<CommitContext>(INITIAL_COMMIT_ID);
+
+  std::lock_guard<std::mutex> lock(manager._active_snapshot_commit_ids_mutex);
+  manager._active_snapshot_commit_ids.clear();
 }
 
 TransactionManager::TransactionManager()
@@ -28,7 +32,30 @@ TransactionManager::TransactionManager()
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
 std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
-  return std::make_shared<TransactionContext>(_next_transaction_id++, _last_commit_id);
+  // Reading the snapshot commit id and registering it happens atomically, so that
+  // lowest_active_snapshot_commit_id() never misses a transaction that is just being started.
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+
+  const auto transaction_id = _next_transaction_id++;
+  const auto snapshot_commit_id = _last_commit_id.load();
+  _active_snapshot_commit_ids.emplace(transaction_id, snapshot_commit_id);
+
+  return std::make_shared<TransactionContext>(transaction_id, snapshot_commit_id);
+}
+
+std::optional<CommitID> TransactionManager::lowest_active_snapshot_commit_id() const {
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+
+  if (_active_snapshot_commit_ids.empty()) return std::nullopt;
+
+  const auto iter = std::min_element(_active_snapshot_commit_ids.cbegin(), _active_snapshot_commit_ids.cend(),
+                                     [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+  return iter->second;
+}
+
+void TransactionManager::_deregister_transaction(const TransactionID transaction_id) {
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+  _active_snapshot_commit_ids.erase(transaction_id);
 }
 
 /**
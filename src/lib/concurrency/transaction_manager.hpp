@@ -3,6 +3,9 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
 
 #include "types.hpp"
 
@@ -57,6 +60,13 @@ class TransactionManager : private Noncopyable {
    */
   std::shared_ptr<TransactionContext> new_transaction_context();
 
+  /**
+   * Returns the lowest snapshot commit id of all TransactionContexts created by new_transaction_context() that are
+   * still alive, std::nullopt if there are none. Rows that were invalidated at or before this commit id are not
+   * visible to any transaction anymore, which is used by the GarbageCollector.
+   */
+  std::optional<CommitID> lowest_active_snapshot_commit_id() const;
+
   // TransactionID = 0 means "not set" in the MVCC data. This is the case if the row has (a) just been reserved, but
   // not yet filled with content, (b) been inserted, committed and not marked for deletion, or (c) inserted but
   // deleted in the same transaction (which has not yet committed)
@@ -74,6 +84,9 @@ class TransactionManager : private Noncopyable {
   std::shared_ptr<CommitContext> _new_commit_context();
   void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
 
+  // Called by the destructor of TransactionContext
+  void _deregister_transaction(const TransactionID transaction_id);
+
  private:
   std::atomic<TransactionID> _next_transaction_id;
 
@@ -83,5 +96,9 @@ class TransactionManager : private Noncopyable {
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
   std::shared_ptr<CommitContext> _last_commit_context;
+
+  // Snapshot commit ids of all active transactions
+  std::unordered_map<TransactionID, CommitID> _active_snapshot_commit_ids;
+  mutable std::mutex _active_snapshot_commit_ids_mutex;
 };
 }  // namespace opossum
@@ -35,6 +35,7 @@ const boost::bimap<PredicateCondition, std::string> predicate_condition_to_strin
         {PredicateCondition::GreaterThan, ">"},
         {PredicateCondition::GreaterThanEquals, ">="},
         {PredicateCondition::Between, "BETWEEN"},
+        {PredicateCondition::In, "IN"},
         {PredicateCondition::Like, "LIKE"},
         {PredicateCondition::NotLike, "NOT LIKE"},
         {PredicateCondition::IsNull, "IS NULL"},
@@ -0,0 +1,256 @@
+#include "cost_model_physical.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <string>
+
+#include "constant_mappings.hpp"
+#include "expression/abstract_predicate_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/operator_join_predicate.hpp"
+#include "operators/operator_scan_predicate.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// n * log2(n), guarded against n < 1 which would yield negative or undefined costs
+float n_log_n(const float row_count) { return row_count * std::log2(std::max(row_count, 1.0f)); }
+
+}  // namespace
+
+namespace opossum {
+
+CostModelPhysical::CostModelPhysical(const CostModelPhysicalCoefficients& coefficients)
+    : _coefficients(coefficients) {}
+
+const CostModelPhysicalCoefficients& CostModelPhysical::coefficients() const { return _coefficients; }
+
+Cost CostModelPhysical::estimate_table_scan_cost(const std::optional<EncodingType>& encoding_type,
+                                                 const float input_row_count, const float output_row_count) const {
+  auto input_row_coefficient = _coefficients.table_scan_references_input_row;
+  if (encoding_type) {
+    const auto iter = _coefficients.table_scan_data_input_row.find(*encoding_type);
+    DebugAssert(iter != _coefficients.table_scan_data_input_row.end(), "No TableScan coefficient for encoding");
+    input_row_coefficient = iter->second;
+  }
+
+  return input_row_count * input_row_coefficient + output_row_count * _coefficients.table_scan_output_row;
+}
+
+Cost CostModelPhysical::estimate_join_hash_cost(const float build_row_count, const float probe_row_count,
+                                                const float output_row_count) const {
+  return build_row_count * _coefficients.join_hash_build_row + probe_row_count * _coefficients.join_hash_probe_row +
+         output_row_count * _coefficients.join_hash_output_row;
+}
+
+Cost CostModelPhysical::estimate_join_sort_merge_cost(const float left_row_count, const float right_row_count,
+                                                      const float output_row_count) const {
+  return (n_log_n(left_row_count) + n_log_n(right_row_count)) * _coefficients.join_sort_merge_sort_row +
+         output_row_count * _coefficients.join_sort_merge_output_row;
+}
+
+Cost CostModelPhysical::estimate_join_index_cost(const float left_row_count, const float output_row_count) const {
+  return left_row_count * _coefficients.join_index_probe_row + output_row_count * _coefficients.join_index_output_row;
+}
+
+Cost CostModelPhysical::estimate_aggregate_cost(const float input_row_count, const float output_row_count) const {
+  return input_row_count * _coefficients.aggregate_input_row + output_row_count * _coefficients.aggregate_group_row;
+}
+
+Cost CostModelPhysical::estimate_sort_cost(const float input_row_count) const {
+  return n_log_n(input_row_count) * _coefficients.sort_row;
+}
+
+Cost CostModelPhysical::estimate_other_cost(const float input_row_count, const float output_row_count) const {
+  return input_row_count * _coefficients.other_input_row + output_row_count * _coefficients.other_output_row;
+}
+
+Cost CostModelPhysical::_estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto output_row_count = node->get_statistics()->row_count();
+  const auto left_input_row_count = node->left_input() ? node->left_input()->get_statistics()->row_count() : 0.0f;
+  const auto right_input_row_count = node->right_input() ? node->right_input()->get_statistics()->row_count() : 0.0f;
+
+  switch (node->type) {
+    case LQPNodeType::StoredTable:
+      // GetTable only forwards the stored table
+      return 0.0f;
+
+    case LQPNodeType::Predicate:
+      return _estimate_predicate_node_cost(std::static_pointer_cast<PredicateNode>(node));
+
+    case LQPNodeType::Join: {
+      // Mirror the choice of the join implementation of LQPTranslator::_translate_join_node()
+      const auto join_node = std::static_pointer_cast<JoinNode>(node);
+      if (join_node->join_mode == JoinMode::Cross) {
+        return estimate_other_cost(left_input_row_count * right_input_row_count, output_row_count);
+      }
+
+      const auto operator_join_predicate =
+          OperatorJoinPredicate::from_expression(*join_node->join_predicate, *node->left_input(), *node->right_input());
+      if (operator_join_predicate && operator_join_predicate->predicate_condition == PredicateCondition::Equals) {
+        // Mirror the choice of the build input of JoinHash::_on_execute(), which builds on the smaller input in all
+        // join modes. Unmatched rows of the build input (outer, semi, and anti joins) are found with a bitmap, whose
+        // costs are covered by the build costs.
+        const auto build_left = left_input_row_count <= right_input_row_count;
+        const auto build_row_count = build_left ? left_input_row_count : right_input_row_count;
+        const auto probe_row_count = build_left ? right_input_row_count : left_input_row_count;
+        return estimate_join_hash_cost(build_row_count, probe_row_count, output_row_count);
+      }
+
+      return estimate_join_sort_merge_cost(left_input_row_count, right_input_row_count, output_row_count);
+    }
+
+    case LQPNodeType::Aggregate:
+      return estimate_aggregate_cost(left_input_row_count, output_row_count);
+
+    case LQPNodeType::Sort: {
+      // Multiple ORDER BY expressions are executed as one Sort operator each
+      const auto sort_node = std::static_pointer_cast<SortNode>(node);
+      return estimate_sort_cost(left_input_row_count) * static_cast<float>(sort_node->expressions.size());
+    }
+
+    default:
+      return estimate_other_cost(left_input_row_count + right_input_row_count, output_row_count);
+  }
+}
+
+Cost CostModelPhysical::_estimate_predicate_node_cost(const std::shared_ptr<PredicateNode>& predicate_node) const {
+  const auto& input_statistics = *predicate_node->left_input()->get_statistics();
+  const auto input_row_count = input_statistics.row_count();
+  const auto output_row_count = predicate_node->get_statistics()->row_count();
+
+  // On a data table, the costs of the scan are weighted by the share of the rows per encoding of the scanned column
+  const auto first_table_scan_cost = [&]() {
+    if (input_statistics.table_type() != TableType::Data) {
+      return estimate_table_scan_cost(std::nullopt, input_row_count, output_row_count);
+    }
+
+    auto cost = Cost{0.0f};
+    for (const auto& [encoding_type, share] : _get_stored_encoding_shares(predicate_node->predicate)) {
+      cost += share * estimate_table_scan_cost(encoding_type, input_row_count, output_row_count);
+    }
+    return cost;
+  };
+
+  // BETWEEN and IN with a value list are translated into a single TableScan, see LQPTranslator
+  if (OperatorScanPredicate::single_pass_from_expression(*predicate_node->predicate, *predicate_node)) {
+    return first_table_scan_cost();
+  }
+
+  const auto operator_scan_predicates =
+      OperatorScanPredicate::from_expression(*predicate_node->predicate, *predicate_node);
+  if (!operator_scan_predicates || operator_scan_predicates->empty()) {
+    return estimate_other_cost(input_row_count, output_row_count);
+  }
+
+  // The first TableScan operates on the input table, all following ones on the reference table produced by their
+  // predecessor. As we have no estimation for the intermediate result, the output row count is used.
+  auto cost = first_table_scan_cost();
+  for (auto predicate_idx = size_t{1}; predicate_idx < operator_scan_predicates->size(); ++predicate_idx) {
+    cost += estimate_table_scan_cost(std::nullopt, output_row_count, output_row_count);
+  }
+
+  return cost;
+}
+
+std::map<EncodingType, float> CostModelPhysical::_get_stored_encoding_shares(
+    const std::shared_ptr<AbstractExpression>& expression) {
+  const auto unencoded = std::map<EncodingType, float>{{EncodingType::Unencoded, 1.0f}};
+
+  const auto predicate_expression = std::dynamic_pointer_cast<AbstractPredicateExpression>(expression);
+  if (!predicate_expression) return unencoded;
+
+  for (const auto& argument : predicate_expression->arguments) {
+    const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(argument);
+    if (!column_expression) continue;
+
+    const auto stored_table_node =
+        std::dynamic_pointer_cast<const StoredTableNode>(column_expression->column_reference.original_node());
+    if (!stored_table_node || !StorageManager::get().has_table(stored_table_node->table_name)) return unencoded;
+
+    const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+    const auto column_id = column_expression->column_reference.original_column_id();
+
+    auto row_counts = std::map<EncodingType, float>{};
+    auto total_row_count = 0.0f;
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(column_id));
+      const auto encoding_type = encoded_segment ? encoded_segment->encoding_type() : EncodingType::Unencoded;
+      row_counts[encoding_type] += static_cast<float>(chunk->size());
+      total_row_count += static_cast<float>(chunk->size());
+    }
+    if (total_row_count == 0.0f) return unencoded;
+
+    for (auto& [encoding_type, row_count] : row_counts) {
+      row_count /= total_row_count;
+    }
+    return row_counts;
+  }
+
+  return unencoded;
+}
+
+void from_json(const nlohmann::json& json, CostModelPhysicalCoefficients& coefficients) {
+  if (json.find("table_scan_data_input_row") != json.end()) {
+    const auto& table_scan_data_input_row = json.at("table_scan_data_input_row");
+    for (auto iter = table_scan_data_input_row.begin(); iter != table_scan_data_input_row.end(); ++iter) {
+      const auto encoding_type = encoding_type_to_string.right.at(iter.key());
+      coefficients.table_scan_data_input_row[encoding_type] = iter.value().get<float>();
+    }
+  }
+
+  coefficients.table_scan_references_input_row =
+      json.value("table_scan_references_input_row", coefficients.table_scan_references_input_row);
+  coefficients.table_scan_output_row = json.value("table_scan_output_row", coefficients.table_scan_output_row);
+  coefficients.join_hash_build_row = json.value("join_hash_build_row", coefficients.join_hash_build_row);
+  coefficients.join_hash_probe_row = json.value("join_hash_probe_row", coefficients.join_hash_probe_row);
+  coefficients.join_hash_output_row = json.value("join_hash_output_row", coefficients.join_hash_output_row);
+  coefficients.join_sort_merge_sort_row =
+      json.value("join_sort_merge_sort_row", coefficients.join_sort_merge_sort_row);
+  coefficients.join_sort_merge_output_row =
+      json.value("join_sort_merge_output_row", coefficients.join_sort_merge_output_row);
+  coefficients.join_index_probe_row = json.value("join_index_probe_row", coefficients.join_index_probe_row);
+  coefficients.join_index_output_row = json.value("join_index_output_row", coefficients.join_index_output_row);
+  coefficients.aggregate_input_row = json.value("aggregate_input_row", coefficients.aggregate_input_row);
+  coefficients.aggregate_group_row = json.value("aggregate_group_row", coefficients.aggregate_group_row);
+  coefficients.sort_row = json.value("sort_row", coefficients.sort_row);
+  coefficients.other_input_row = json.value("other_input_row", coefficients.other_input_row);
+  coefficients.other_output_row = json.value("other_output_row", coefficients.other_output_row);
+}
+
+void to_json(nlohmann::json& json, const CostModelPhysicalCoefficients& coefficients) {
+  auto table_scan_data_input_row = nlohmann::json::object();
+  for (const auto& [encoding_type, coefficient] : coefficients.table_scan_data_input_row) {
+    table_scan_data_input_row[encoding_type_to_string.left.at(encoding_type)] = coefficient;
+  }
+
+  json = {{"table_scan_data_input_row", table_scan_data_input_row},
+          {"table_scan_references_input_row", coefficients.table_scan_references_input_row},
+          {"table_scan_output_row", coefficients.table_scan_output_row},
+          {"join_hash_build_row", coefficients.join_hash_build_row},
+          {"join_hash_probe_row", coefficients.join_hash_probe_row},
+          {"join_hash_output_row", coefficients.join_hash_output_row},
+          {"join_sort_merge_sort_row", coefficients.join_sort_merge_sort_row},
+          {"join_sort_merge_output_row", coefficients.join_sort_merge_output_row},
+          {"join_index_probe_row", coefficients.join_index_probe_row},
+          {"join_index_output_row", coefficients.join_index_output_row},
+          {"aggregate_input_row", coefficients.aggregate_input_row},
+          {"aggregate_group_row", coefficients.aggregate_group_row},
+          {"sort_row", coefficients.sort_row},
+          {"other_input_row", coefficients.other_input_row},
+          {"other_output_row", coefficients.other_output_row}};
+}
+
+}  // namespace opossum
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <map>
+#include <optional>
+
+#include "json.hpp"
+
+#include "abstract_cost_estimator.hpp"
+#include "storage/encoding_type.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+class PredicateNode;
+
+/**
+ * Coefficients of the per-operator models of CostModelPhysical. All coefficients are in microseconds per unit of the
+ * feature they are multiplied with, so that the Cost estimated by CostModelPhysical approximates the walltime
+ * reported in the OperatorPerformanceData.
+ *
+ * The defaults are rough values and only meant as a fallback. Calibrated coefficients for the hardware at hand can be
+ * obtained by running hyriseCostModelCalibration, which writes them as JSON (see to_json()/from_json()).
+ */
+struct CostModelPhysicalCoefficients {
+  // TableScan on a data table, by encoding of the scanned column. Per input row.
+  std::map<EncodingType, float> table_scan_data_input_row = {
+      {EncodingType::Unencoded, 0.002f},         {EncodingType::Dictionary, 0.0015f},
+      {EncodingType::RunLength, 0.003f},         {EncodingType::FixedStringDictionary, 0.002f},
+      {EncodingType::FrameOfReference, 0.003f}};
+  // TableScan on a reference table, i.e., the rows have to be resolved through a PosList first. Per input row.
+  float table_scan_references_input_row = 0.006f;
+  float table_scan_output_row = 0.001f;
+
+  // JoinHash. Which input is the build input is decided as in JoinHash::_on_execute()
+  float join_hash_build_row = 0.04f;
+  float join_hash_probe_row = 0.02f;
+  float join_hash_output_row = 0.01f;
+
+  // JoinSortMerge. Per n * log2(n) of each input, and per output row
+  float join_sort_merge_sort_row = 0.004f;
+  float join_sort_merge_output_row = 0.01f;
+
+  // JoinIndex. Per row of the (probing) left input, and per output row
+  float join_index_probe_row = 0.1f;
+  float join_index_output_row = 0.01f;
+
+  // Aggregate. Per input row and per group (i.e., output row)
+  float aggregate_input_row = 0.03f;
+  float aggregate_group_row = 0.05f;
+
+  // Sort. Per n * log2(n) of the input
+  float sort_row = 0.005f;
+
+  // All other operators (Projection, Validate, Limit, ...)
+  float other_input_row = 0.005f;
+  float other_output_row = 0.005f;
+};
+
+void from_json(const nlohmann::json& json, CostModelPhysicalCoefficients& coefficients);
+void to_json(nlohmann::json& json, const CostModelPhysicalCoefficients& coefficients);
+
+/**
+ * Cost model that predicts the runtime (in microseconds) of the physical operators that the LQPTranslator will create
+ * for each LQP node. In contrast to CostModelLogical, it considers
+ *    - which join implementation will be used (JoinHash for equi joins, JoinSortMerge otherwise)
+ *    - whether a scan operates on a data table or on a reference table
+ *    - the encoding of the column a data table is scanned on
+ *
+ * The per-operator estimation functions are public so that they can be used for operators that the LQPTranslator
+ * does not create on its own (e.g., JoinIndex) and by the calibration.
+ */
+class CostModelPhysical : public AbstractCostEstimator {
+ public:
+  explicit CostModelPhysical(const CostModelPhysicalCoefficients& coefficients = {});
+
+  const CostModelPhysicalCoefficients& coefficients() const;
+
+  // @param encoding_type     std::nullopt if the input is a reference table
+  Cost estimate_table_scan_cost(const std::optional<EncodingType>& encoding_type, const float input_row_count,
+                                const float output_row_count) const;
+  Cost estimate_join_hash_cost(const float build_row_count, const float probe_row_count,
+                               const float output_row_count) const;
+  Cost estimate_join_sort_merge_cost(const float left_row_count, const float right_row_count,
+                                     const float output_row_count) const;
+  Cost estimate_join_index_cost(const float left_row_count, const float output_row_count) const;
+  Cost estimate_aggregate_cost(const float input_row_count, const float output_row_count) const;
+  Cost estimate_sort_cost(const float input_row_count) const;
+  Cost estimate_other_cost(const float input_row_count, const float output_row_count) const;
+
+ protected:
+  Cost _estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+ private:
+  Cost _estimate_predicate_node_cost(const std::shared_ptr<PredicateNode>& predicate_node) const;
+
+  // Returns the share of the rows of the stored table @param expression originates from per EncodingType of the
+  // scanned column. Tables whose chunks are encoded differently (e.g., because only the immutable chunks are encoded)
+  // have several entries. If the encoding cannot be determined, all rows are considered EncodingType::Unencoded.
+  static std::map<EncodingType, float> _get_stored_encoding_shares(
+      const std::shared_ptr<AbstractExpression>& expression);
+
+  const CostModelPhysicalCoefficients _coefficients;
+};
+
+}  // namespace opossum
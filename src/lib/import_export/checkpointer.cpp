@@ -0,0 +1,392 @@
+#include "checkpointer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "json.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "constant_mappings.hpp"
+#include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/filesystem.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Chunk files are named <table name>.<chunk id>.<checkpoint number>.bin
+std::string chunk_file_name(const std::string& table_name, const ChunkID chunk_id, const uint64_t checkpoint_number) {
+  return table_name + "." + std::to_string(chunk_id) + "." + std::to_string(checkpoint_number) + ".bin";
+}
+
+bool is_chunk_file_name(const std::string& file_name) {
+  const auto suffix = std::string{".bin"};
+  if (file_name.size() <= suffix.size() ||
+      file_name.compare(file_name.size() - suffix.size(), suffix.size(), suffix) != 0) {
+    return false;
+  }
+
+  // The chunk id and the checkpoint number precede the suffix, the (non-empty) table name comes first
+  auto end = file_name.size() - suffix.size();
+  for (auto number_index = 0; number_index < 2; ++number_index) {
+    if (end == 0) return false;
+    const auto dot = file_name.rfind('.', end - 1);
+    if (dot == std::string::npos || dot + 1 == end) return false;
+
+    const auto is_digit = [](const char character) { return character >= '0' && character <= '9'; };
+    if (!std::all_of(file_name.begin() + dot + 1, file_name.begin() + end, is_digit)) return false;
+    end = dot;
+  }
+  return end > 0;
+}
+
+}  // namespace
+
+namespace opossum {
+
+Checkpointer::Checkpointer(const std::string& directory) : _directory(directory) {
+  // Continue the numbering of an existing checkpoint, so that its chunk files are not overwritten
+  std::ifstream manifest_file(_directory + "/" + MANIFEST_FILE_NAME);
+  if (manifest_file.is_open()) {
+    nlohmann::json manifest;
+    manifest_file >> manifest;
+    _checkpoint_number = manifest.at("checkpoint_number").get<uint64_t>() + 1;
+  }
+}
+
+Checkpointer::Result Checkpointer::checkpoint() {
+  // The transaction context is never committed. It provides the snapshot and, while it exists, prevents the
+  // GarbageCollector from releasing chunks that contain rows visible to the snapshot.
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+  const auto checkpoint_number = _checkpoint_number++;
+
+  filesystem::create_directories(_directory);
+
+  std::map<std::string, CheckpointedTable> tables;
+  std::atomic<size_t> written_chunk_count{0};
+  std::atomic<size_t> reused_chunk_count{0};
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+
+  auto& storage_manager = StorageManager::get();
+  for (const auto& table_name : storage_manager.table_names()) {
+    if (!storage_manager.has_table(table_name)) continue;
+    const std::shared_ptr<const Table> table = storage_manager.get_table(table_name);
+
+    // Chunks can only be reused if the table has not been replaced since the previous checkpoint
+    const auto previous_table_iter = _tables.find(table_name);
+    const auto table_was_checkpointed =
+        previous_table_iter != _tables.end() && previous_table_iter->second.table.lock() == table;
+    const auto* previous_table = table_was_checkpointed ? &previous_table_iter->second : nullptr;
+
+    auto& checkpointed_table = tables[table_name];
+    checkpointed_table.table = table;
+    checkpointed_table.chunks.resize(table->chunk_count());
+
+    for (ChunkID chunk_id{0}; chunk_id < checkpointed_table.chunks.size(); ++chunk_id) {
+      const auto* previous_chunk = previous_table && chunk_id < previous_table->chunks.size()
+                                       ? &previous_table->chunks[chunk_id]
+                                       : nullptr;
+      auto* checkpointed_chunk = &checkpointed_table.chunks[chunk_id];
+
+      const auto write_chunk_if_changed = [&, table_name, table, chunk_id, previous_chunk, checkpointed_chunk]() {
+        const auto chunk = table->get_chunk(chunk_id);
+        checkpointed_chunk->chunk_size = chunk->size();
+
+        auto visible_chunk_offsets = std::vector<ChunkOffset>{};
+        if (!_collect_visible_rows(*chunk, previous_chunk, checkpointed_chunk->chunk_size, snapshot_commit_id,
+                                   visible_chunk_offsets)) {
+          checkpointed_chunk->file_name = previous_chunk->file_name;
+          ++reused_chunk_count;
+          return;
+        }
+
+        ++written_chunk_count;
+        if (visible_chunk_offsets.empty()) return;
+
+        checkpointed_chunk->file_name = chunk_file_name(table_name, chunk_id, checkpoint_number);
+        _write_chunk(table, chunk_id, visible_chunk_offsets, checkpointed_chunk->file_name);
+      };
+      jobs.emplace_back(std::make_shared<JobTask>(write_chunk_if_changed));
+      jobs.back()->schedule();
+    }
+  }
+
+  for (const auto& job : jobs) {
+    job->join();
+  }
+
+  _write_manifest(tables, snapshot_commit_id, checkpoint_number);
+  _remove_unreferenced_files(tables);
+
+  _tables = std::move(tables);
+  _snapshot_commit_id = snapshot_commit_id;
+
+  return Result{snapshot_commit_id, written_chunk_count, reused_chunk_count};
+}
+
+size_t Checkpointer::restore() {
+  const auto manifest_path = _directory + "/" + MANIFEST_FILE_NAME;
+  std::ifstream manifest_file(manifest_path);
+  Assert(manifest_file.is_open(), "Checkpointer: Could not find manifest " + manifest_path);
+
+  nlohmann::json manifest;
+  manifest_file >> manifest;
+  _checkpoint_number = std::max(_checkpoint_number, manifest.at("checkpoint_number").get<uint64_t>() + 1);
+
+  std::map<std::string, CheckpointedTable> tables;
+  std::map<std::string, std::shared_ptr<Table>> restored_tables;
+  std::map<std::string, std::vector<std::shared_ptr<Chunk>>> restored_chunks;
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+
+  for (const auto& table_json : manifest.at("tables")) {
+    const auto table_name = table_json.at("name").get<std::string>();
+
+    TableColumnDefinitions column_definitions;
+    for (const auto& column_json : table_json.at("columns")) {
+      column_definitions.emplace_back(column_json.at("name").get<std::string>(),
+                                      data_type_to_string.right.at(column_json.at("type").get<std::string>()),
+                                      column_json.at("nullable").get<bool>());
+    }
+    // Manifests written before tables without MVCC were supported only contain tables with MVCC
+    const auto use_mvcc = table_json.value("use_mvcc", true) ? UseMvcc::Yes : UseMvcc::No;
+    restored_tables[table_name] = std::make_shared<Table>(
+        column_definitions, TableType::Data, table_json.at("max_chunk_size").get<uint32_t>(), use_mvcc);
+
+    const auto& chunks_json = table_json.at("chunks");
+    auto& checkpointed_table = tables[table_name];
+    checkpointed_table.chunks.resize(chunks_json.size());
+    auto* chunks = &restored_chunks[table_name];
+    chunks->resize(chunks_json.size());
+
+    for (auto chunk_index = size_t{0}; chunk_index < chunks_json.size(); ++chunk_index) {
+      const auto file_name = chunks_json[chunk_index].at("file").get<std::string>();
+      checkpointed_table.chunks[chunk_index].file_name = file_name;
+      if (file_name.empty()) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([this, file_name, chunk_index, chunks, use_mvcc]() {
+        auto import_binary = std::make_shared<ImportBinary>(_directory + "/" + file_name);
+        import_binary->execute();
+
+        const auto imported_table = import_binary->get_output();
+        Assert(imported_table->chunk_count() == 1, "Checkpointer: Chunk file " + file_name + " is invalid");
+
+        const auto imported_chunk = imported_table->get_chunk(ChunkID{0});
+        auto segments = Segments{};
+        auto is_encoded = false;
+        for (ColumnID column_id{0}; column_id < imported_chunk->column_count(); ++column_id) {
+          const auto segment = imported_chunk->get_segment(column_id);
+          is_encoded |= std::dynamic_pointer_cast<const BaseEncodedSegment>(segment) != nullptr;
+          segments.emplace_back(segment);
+        }
+
+        const auto mvcc_data =
+            use_mvcc == UseMvcc::Yes ? std::make_shared<MvccData>(imported_chunk->size()) : std::shared_ptr<MvccData>{};
+        auto chunk = std::make_shared<Chunk>(segments, mvcc_data);
+        if (is_encoded) chunk->mark_immutable();
+        (*chunks)[chunk_index] = chunk;
+      }));
+      jobs.back()->schedule();
+    }
+  }
+
+  for (const auto& job : jobs) {
+    job->join();
+  }
+
+  for (auto& [table_name, table] : restored_tables) {
+    auto& checkpointed_table = tables[table_name];
+    const auto& chunks = restored_chunks[table_name];
+
+    for (auto chunk_index = size_t{0}; chunk_index < chunks.size(); ++chunk_index) {
+      auto chunk = chunks[chunk_index];
+
+      // Chunks without visible rows are restored as empty chunks to keep the ChunkIDs stable
+      if (!chunk) {
+        auto segments = Segments{};
+        for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+          resolve_data_type(table->column_data_type(column_id), [&](auto type) {
+            using ColumnDataType = typename decltype(type)::type;
+            segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(table->column_is_nullable(column_id)));
+          });
+        }
+        const auto mvcc_data =
+            table->has_mvcc() == UseMvcc::Yes ? std::make_shared<MvccData>(0) : std::shared_ptr<MvccData>{};
+        chunk = std::make_shared<Chunk>(segments, mvcc_data);
+      }
+
+      // Rows are only appended to the last chunk and only until it is full. As Table::append() does not look at the
+      // chunks before the last one, these are finalized as well, even if rows that were not visible are missing.
+      if (chunk_index + 1 < chunks.size() || chunk->size() >= table->max_chunk_size()) chunk->mark_immutable();
+
+      checkpointed_table.chunks[chunk_index].chunk_size = chunk->size();
+      table->append_chunk(chunk);
+    }
+
+    StorageManager::get().add_table(table_name, table);
+    checkpointed_table.table = table;
+  }
+
+  // All restored rows have a begin commit id of zero, so that the next checkpoint only writes chunks changed later
+  _tables = std::move(tables);
+  _snapshot_commit_id = TransactionManager::get().last_commit_id();
+
+  return restored_tables.size();
+}
+
+bool Checkpointer::_collect_visible_rows(const Chunk& chunk, const CheckpointedChunk* previous_chunk,
+                                         const ChunkOffset chunk_size, const CommitID snapshot_commit_id,
+                                         std::vector<ChunkOffset>& visible_chunk_offsets) const {
+  // Rows were inserted or the chunk was released by the GarbageCollector
+  auto changed = !previous_chunk || previous_chunk->chunk_size != chunk_size;
+
+  // The rows of chunks compacted before the snapshot are not visible and might be released at any time
+  const auto cleanup_commit_id = chunk.get_cleanup_commit_id();
+  if (cleanup_commit_id && *cleanup_commit_id <= snapshot_commit_id) {
+    return changed || !previous_chunk->file_name.empty();
+  }
+
+  visible_chunk_offsets.reserve(chunk_size);
+
+  // Without MVCC, rows are neither invalidated nor uncommitted. Thus, all rows are visible and only appends change the
+  // chunk.
+  if (!chunk.has_mvcc_data()) {
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      visible_chunk_offsets.emplace_back(chunk_offset);
+    }
+    return changed;
+  }
+
+  const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+  for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    const auto begin_cid = mvcc_data->begin_cids[chunk_offset];
+    const auto end_cid = mvcc_data->end_cids[chunk_offset];
+
+    if (begin_cid <= snapshot_commit_id && snapshot_commit_id < end_cid) {
+      visible_chunk_offsets.emplace_back(chunk_offset);
+    }
+
+    // Commit ids up to the snapshot of the previous checkpoint were already contained in it
+    changed |= (begin_cid > _snapshot_commit_id && begin_cid <= snapshot_commit_id) ||
+               (end_cid > _snapshot_commit_id && end_cid <= snapshot_commit_id);
+  }
+
+  return changed;
+}
+
+void Checkpointer::_write_chunk(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
+                               const std::vector<ChunkOffset>& visible_chunk_offsets,
+                               const std::string& file_name) const {
+  const auto chunk = table->get_chunk(chunk_id);
+  auto chunk_table = std::shared_ptr<Table>{};
+
+  if (!chunk->is_mutable() && visible_chunk_offsets.size() == chunk->size()) {
+    // All rows of the immutable chunk are visible, so its segments are written as they are, keeping their encoding
+    chunk_table =
+        std::make_shared<Table>(table->column_definitions(), TableType::Data, table->max_chunk_size(), UseMvcc::No);
+    auto segments = Segments{};
+    for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      segments.emplace_back(chunk->get_segment(column_id));
+    }
+    chunk_table->append_chunk(segments);
+  } else {
+    // Otherwise, the visible rows are referenced and materialized by ExportBinary
+    auto pos_list = std::make_shared<PosList>();
+    pos_list->reserve(visible_chunk_offsets.size());
+    for (const auto chunk_offset : visible_chunk_offsets) {
+      pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+    }
+
+    chunk_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+    auto segments = Segments{};
+    for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+    }
+    chunk_table->append_chunk(segments);
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(chunk_table);
+  table_wrapper->execute();
+
+  auto export_binary = std::make_shared<ExportBinary>(table_wrapper, _directory + "/" + file_name);
+  export_binary->execute();
+}
+
+void Checkpointer::_write_manifest(const std::map<std::string, CheckpointedTable>& tables,
+                                   const CommitID snapshot_commit_id, const uint64_t checkpoint_number) const {
+  auto tables_json = nlohmann::json::array();
+  for (const auto& [table_name, checkpointed_table] : tables) {
+    const auto table = checkpointed_table.table.lock();
+    DebugAssert(table, "Checkpointed table was deleted during the checkpoint");
+
+    auto columns_json = nlohmann::json::array();
+    for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+      columns_json.push_back({{"name", table->column_name(column_id)},
+                              {"type", data_type_to_string.left.at(table->column_data_type(column_id))},
+                              {"nullable", table->column_is_nullable(column_id)}});
+    }
+
+    auto chunks_json = nlohmann::json::array();
+    for (const auto& checkpointed_chunk : checkpointed_table.chunks) {
+      chunks_json.push_back({{"file", checkpointed_chunk.file_name}});
+    }
+
+    tables_json.push_back({{"name", table_name},
+                           {"max_chunk_size", table->max_chunk_size()},
+                           {"use_mvcc", table->has_mvcc() == UseMvcc::Yes},
+                           {"columns", columns_json},
+                           {"chunks", chunks_json}});
+  }
+
+  const auto manifest = nlohmann::json{{"checkpoint_number", checkpoint_number},
+                                       {"snapshot_commit_id", snapshot_commit_id},
+                                       {"tables", tables_json}};
+
+  // Writing to a temporary file and renaming it atomically replaces the previous checkpoint
+  const auto manifest_path = _directory + "/" + MANIFEST_FILE_NAME;
+  const auto temporary_manifest_path = manifest_path + ".tmp";
+  {
+    std::ofstream manifest_file;
+    manifest_file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    manifest_file.open(temporary_manifest_path);
+    manifest_file << std::setw(4) << manifest << std::endl;
+  }
+  filesystem::rename(temporary_manifest_path, manifest_path);
+}
+
+void Checkpointer::_remove_unreferenced_files(const std::map<std::string, CheckpointedTable>& tables) const {
+  auto referenced_file_names = std::set<std::string>{};
+  for (const auto& [table_name, checkpointed_table] : tables) {
+    for (const auto& checkpointed_chunk : checkpointed_table.chunks) {
+      if (!checkpointed_chunk.file_name.empty()) referenced_file_names.emplace(checkpointed_chunk.file_name);
+    }
+  }
+
+  // Other files in the directory do not belong to the Checkpointer and are left alone
+  for (const auto& entry : filesystem::directory_iterator(_directory)) {
+    const auto file_name = entry.path().filename().string();
+    if (!is_chunk_file_name(file_name) || referenced_file_names.count(file_name)) continue;
+    filesystem::remove(entry.path());
+  }
+}
+
+}  // namespace opossum
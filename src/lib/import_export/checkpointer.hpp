@@ -0,0 +1,96 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * The Checkpointer writes consistent, incremental checkpoints of all tables in the StorageManager into a directory
+ * and restores them from there.
+ *
+ * A checkpoint contains the rows visible to a transaction snapshot taken when it starts. Concurrent queries are not
+ * blocked: the visibility of rows is determined from the MVCC data, and the snapshot keeps the GarbageCollector from
+ * releasing chunks that are still read. Tables without MVCC are checkpointed with all of their rows. Each chunk is
+ * written into its own file in the binary format of ExportBinary, so encoded immutable chunks without invalid rows
+ * keep their encoding.
+ *
+ * Only chunks that changed since the previous checkpoint written by the same Checkpointer are written again. A chunk
+ * changed if rows were inserted into it or if a row was inserted or invalidated with a commit id between the previous
+ * and the current snapshot. The files of unchanged chunks are referenced by the new checkpoint as well.
+ *
+ * The directory contains a manifest (checkpoint.json) that lists the tables, their schema, and the file of each
+ * chunk. A new manifest is written to a temporary file and renamed once all chunk files are written. Hence, the
+ * previous checkpoint stays valid until the new one is complete. Afterwards, chunk files that are no longer
+ * referenced are removed. Other files in the directory are not touched.
+ *
+ * Restoring loads the chunk files in parallel and adds the tables to the StorageManager. Their rows are visible to
+ * all transactions. The ChunkIDs of the restored tables match those of the checkpointed ones, so that checkpoints
+ * after a restore are incremental as well. All chunks but the last one are restored as immutable chunks, as is the
+ * last one if it is full.
+ */
+class Checkpointer {
+ public:
+  struct Result {
+    CommitID snapshot_commit_id{0};
+    size_t written_chunk_count{0};
+    size_t reused_chunk_count{0};
+  };
+
+  static constexpr auto MANIFEST_FILE_NAME = "checkpoint.json";
+
+  explicit Checkpointer(const std::string& directory);
+
+  // Writes a checkpoint of all tables in the StorageManager
+  Result checkpoint();
+
+  // Adds the tables of the checkpoint in the directory to the StorageManager. Returns the number of restored tables.
+  size_t restore();
+
+ protected:
+  struct CheckpointedChunk {
+    // The number of rows of the chunk, including invalid ones, when it was checkpointed
+    ChunkOffset chunk_size{0};
+
+    // The file containing the visible rows, empty if no row was visible
+    std::string file_name;
+  };
+
+  struct CheckpointedTable {
+    std::weak_ptr<const Table> table;
+    std::vector<CheckpointedChunk> chunks;
+  };
+
+  // Returns whether the chunk has to be written again and collects the offsets of the rows visible at the snapshot
+  bool _collect_visible_rows(const Chunk& chunk, const CheckpointedChunk* previous_chunk, ChunkOffset chunk_size,
+                             CommitID snapshot_commit_id, std::vector<ChunkOffset>& visible_chunk_offsets) const;
+
+  void _write_chunk(const std::shared_ptr<const Table>& table, ChunkID chunk_id,
+                    const std::vector<ChunkOffset>& visible_chunk_offsets, const std::string& file_name) const;
+
+  void _write_manifest(const std::map<std::string, CheckpointedTable>& tables, CommitID snapshot_commit_id,
+                       uint64_t checkpoint_number) const;
+
+  // Removes all chunk files in the directory that are not referenced by the given tables. Files whose names do not
+  // follow the naming scheme of chunk files are kept.
+  void _remove_unreferenced_files(const std::map<std::string, CheckpointedTable>& tables) const;
+
+  const std::string _directory;
+
+  // The number of the next checkpoint, used to distinguish chunk files written by different checkpoints
+  uint64_t _checkpoint_number{0};
+
+  // The commit id of the snapshot of the previous checkpoint (or the restore)
+  CommitID _snapshot_commit_id{0};
+
+  std::map<std::string, CheckpointedTable> _tables;
+};
+
+}  // namespace opossum
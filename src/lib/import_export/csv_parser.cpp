@@ -1,5 +1,6 @@
 #include "csv_parser.hpp"
 
+#include <deque>
 #include <fstream>
 #include <functional>
 #include <list>
@@ -15,6 +16,7 @@
 #include "import_export/csv_meta.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/table.hpp"
@@ -23,6 +25,11 @@
 
 namespace opossum {
 
+CsvParser::CsvParser(const size_t block_size, const size_t max_blocks_in_flight)
+    : _block_size{block_size}, _max_blocks_in_flight{max_blocks_in_flight} {
+  Assert(_block_size > 0 && _max_blocks_in_flight > 0, "Block size and number of blocks in flight must be positive");
+}
+
 std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const std::optional<CsvMeta>& csv_meta) {
   // If no meta info is given as a parameter, look for a json file
   if (csv_meta == std::nullopt) {
@@ -33,48 +40,87 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const std::
 
   auto table = _create_table_from_meta();
 
-  std::ifstream csvfile{filename};
-  std::string content{std::istreambuf_iterator<char>(csvfile), {}};
+  std::ifstream csvfile{filename, std::ios::binary};
 
-  // return empty table if input file is empty
+  // return empty table if input file cannot be read
   if (!csvfile) return table;
 
-  // make sure content ends with a delimiter for better row processing later
-  if (content.back() != _meta.config.delimiter) content.push_back(_meta.config.delimiter);
+  // Save chunks in list to avoid memory relocation
+  std::list<std::shared_ptr<Chunk>> chunks;
 
-  std::string_view content_view{content.c_str(), content.size()};
+  // The parsing tasks of each block. Each task holds a reference to the content of its block, so the number of blocks
+  // in flight bounds the memory used for the raw CSV content.
+  std::deque<std::vector<std::shared_ptr<AbstractTask>>> tasks_by_block;
 
-  // Save chunks in list to avoid memory relocation
-  std::list<Segments> segments_by_chunks;
-  std::vector<std::shared_ptr<AbstractTask>> tasks;
   std::vector<size_t> field_ends;
-  while (_find_fields_in_chunk(content_view, *table, field_ends)) {
-    // create empty chunk
-    segments_by_chunks.emplace_back();
-    auto& segments = segments_by_chunks.back();
-
-    // Only pass the part of the string that is actually needed to the parsing task
-    std::string_view relevant_content = content_view.substr(0, field_ends.back());
-
-    // Remove processed part of the csv content
-    content_view = content_view.substr(field_ends.back() + 1);
-
-    // create and start parsing task to fill chunk
-    tasks.emplace_back(std::make_shared<JobTask>([this, relevant_content, field_ends, &table, &segments]() {
-      _parse_into_chunk(relevant_content, field_ends, *table, segments);
-    }));
-    tasks.back()->schedule();
-  }
+  std::string remainder;
+  auto end_of_file = false;
+
+  while (!end_of_file) {
+    // Append the next block to the content that has not been processed yet, i.e., the last incomplete chunk
+    auto block = std::make_shared<std::string>(std::move(remainder));
+    const auto remainder_size = block->size();
+    block->resize(remainder_size + _block_size);
+    csvfile.read(block->data() + remainder_size, static_cast<std::streamsize>(_block_size));
+    block->resize(remainder_size + static_cast<size_t>(csvfile.gcount()));
+    end_of_file = csvfile.eof();
+
+    // make sure content ends with a delimiter for better row processing later
+    if (end_of_file && !block->empty() && block->back() != _meta.config.delimiter) {
+      block->push_back(_meta.config.delimiter);
+    }
 
-  for (auto& task : tasks) {
-    task->join();
-  }
+    std::string_view content_view{block->data(), block->size()};
+    auto& block_tasks = tasks_by_block.emplace_back();
+
+    while (_find_fields_in_chunk(content_view, *table, field_ends)) {
+      // Unless we reached the end of the file, a chunk that is not full might continue in the next block
+      const auto row_count = field_ends.size() / table->column_count();
+      if (row_count == 0 || (!end_of_file && row_count < table->max_chunk_size())) break;
+
+      // create empty chunk
+      auto& chunk = chunks.emplace_back();
+
+      // Only pass the part of the string that is actually needed to the parsing task
+      std::string_view relevant_content = content_view.substr(0, field_ends.back());
+
+      // Remove processed part of the csv content
+      content_view = content_view.substr(field_ends.back() + 1);
 
-  for (auto& segments : segments_by_chunks) {
-    table->append_chunk(segments);
+      // create and start parsing task to fill chunk. The block is captured to keep the content alive.
+      block_tasks.emplace_back(
+          std::make_shared<JobTask>([this, block, relevant_content, field_ends, &table, &chunk]() {
+            Segments segments;
+            const auto row_count = _parse_into_chunk(relevant_content, field_ends, *table, segments);
+
+            chunk = std::make_shared<Chunk>(segments, std::make_shared<MvccData>(row_count));
+
+            // Encode the chunk right away, so that its ValueSegments can be freed before the next blocks are parsed
+            if (_meta.auto_compress) ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+          }));
+      block_tasks.back()->schedule();
+
+      field_ends.clear();
+    }
+
+    // Copy the unprocessed content unless no task references the block, in which case it can be moved
+    if (content_view.size() == block->size()) {
+      remainder = std::move(*block);
+    } else {
+      remainder = std::string{content_view};
+    }
+
+    while (tasks_by_block.size() > _max_blocks_in_flight || (end_of_file && !tasks_by_block.empty())) {
+      for (auto& task : tasks_by_block.front()) {
+        task->join();
+      }
+      tasks_by_block.pop_front();
+    }
   }
 
-  if (_meta.auto_compress) ChunkEncoder::encode_all_chunks(table);
+  for (const auto& chunk : chunks) {
+    table->append_chunk(chunk);
+  }
 
   return table;
 }
@@ -98,15 +144,15 @@ std::shared_ptr<Table> CsvParser::_create_table_from_meta() {
 
 bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table& table,
                                       std::vector<size_t>& field_ends) {
-  field_ends.clear();
   if (csv_content.empty()) {
     return false;
   }
 
   std::string search_for{_meta.config.separator, _meta.config.delimiter, _meta.config.quote};
 
-  size_t pos, from = 0;
-  unsigned int rows = 0, field_count = 1;
+  // Continue after the complete rows found by the previous call, which ended at the end of the previous block
+  size_t pos, from = field_ends.empty() ? 0 : field_ends.back() + 1, complete_rows_field_count = field_ends.size();
+  unsigned int rows = static_cast<unsigned int>(field_ends.size() / table.column_count()), field_count = 1;
   bool in_quotes = false;
   while (rows < table.max_chunk_size() || 0 == table.max_chunk_size()) {
     // Find either of row separator, column delimiter, quote identifier
@@ -142,8 +188,12 @@ bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table&
 
     ++field_count;
     field_ends.push_back(pos);
+    if (elem == _meta.config.delimiter) complete_rows_field_count = field_ends.size();
   }
 
+  // Fields of an incomplete row at the end of the content are only parsed once the rest of the row has been read
+  field_ends.resize(complete_rows_field_count);
+
   return true;
 }
 
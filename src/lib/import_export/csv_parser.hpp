@@ -21,12 +21,21 @@ class Chunk;
  * For non-RFC 4180, all linebreaks within quoted strings are further escaped with an escape character.
  * For the structure of the meta csv file see export_csv.hpp
  *
- * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
- * csv rows.
- * Each data chunk is parsed and converted into a opossum chunk. In the end all chunks are combined to the final table.
+ * This parser reads the csv file block by block and iterates over each block to separate the data into chunks that are
+ * aligned with the csv rows. A chunk that is incomplete at the end of a block is continued in the next one.
+ * Each data chunk is parsed and converted into a opossum chunk by a separate task, which also encodes the chunk if
+ * auto_compress is set. At most max_blocks_in_flight blocks are being parsed at the same time, so that the memory
+ * needed for the raw csv content is bounded independently of the file size. In the end all chunks are combined to the
+ * final table.
  */
 class CsvParser {
  public:
+  static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024 * 1024;
+  static constexpr size_t DEFAULT_MAX_BLOCKS_IN_FLIGHT = 4;
+
+  explicit CsvParser(const size_t block_size = DEFAULT_BLOCK_SIZE,
+                     const size_t max_blocks_in_flight = DEFAULT_MAX_BLOCKS_IN_FLIGHT);
+
   // cannot move-assign because of const members
   CsvParser& operator=(CsvParser&&) = delete;
 
@@ -46,8 +55,9 @@ class CsvParser {
   /*
    * @param      csv_content String_view on the remaining content of the CSV.
    * @param      table       Empty table created by _process_meta_file.
-   * @param[out] field_ends  Empty vector, to be filled with positions of the field ends for one chunk found in \p
-   * csv_content.
+   * @param[out] field_ends  To be filled with positions of the field ends for one chunk found in \p csv_content. Only
+   * complete rows, i.e., rows terminated by a delimiter, are included. If it is not empty, it holds the fields found by
+   * a previous call on a prefix of \p csv_content, and the search continues after them instead of starting over.
    * @returns                False if \p csv_content is empty or chunk_size set to 0, True otherwise.
    */
   bool _find_fields_in_chunk(std::string_view csv_content, const Table& table, std::vector<size_t>& field_ends);
@@ -69,5 +79,9 @@ class CsvParser {
 
   // CSV meta information like chunk_size, column information, delimitor/seperator characters, etc.
   CsvMeta _meta;
+
+  // Number of bytes read from the file at once and maximum number of blocks whose chunks are parsed concurrently
+  const size_t _block_size;
+  const size_t _max_blocks_in_flight;
 };
 }  // namespace opossum
@@ -1,44 +1,79 @@
 #include "csv_writer.hpp"
 
-#include <fstream>
+#include <charconv>
+#include <cstdio>
 #include <string>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/create_iterable_from_segment.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
-CsvWriter::CsvWriter(const std::string& file, const ParseConfig& config) : _config(config) {
-  _stream.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-  _stream.open(file);
-}
+CsvWriter::CsvWriter(const ParseConfig& config) : _config(config) {}
 
-void CsvWriter::write(const AllTypeVariant& value) {
-  if (_current_column_count > 0) {
-    _stream << _config.separator;
-  }
+void CsvWriter::write_chunk(const Chunk& chunk, std::string& buffer) const {
+  const auto column_count = chunk.column_count();
+  const auto row_count = chunk.size();
 
-  _write_value(value);
-  ++_current_column_count;
-}
+  // The formatted fields of each column are stored back to back. field_ends[column_id][row] is the end of the field
+  // of the row, the field begins where the one of the previous row ends.
+  std::vector<std::string> fields(column_count);
+  std::vector<std::vector<size_t>> field_ends(column_count, std::vector<size_t>(row_count));
 
-void CsvWriter::end_line() {
-  _stream << _config.delimiter;
-  _current_column_count = 0;
-}
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    auto& column_fields = fields[column_id];
+    auto& column_field_ends = field_ends[column_id];
 
-void CsvWriter::_write_value(const AllTypeVariant& value) {
-  if (variant_is_null(value)) return;
+    resolve_data_and_segment_type(*chunk.get_segment(column_id), [&](auto type, const auto& typed_segment) {
+      using ColumnDataType = typename decltype(type)::type;
 
-  if (value.type() == typeid(std::string)) {
-    _write_string_value(type_cast<std::string>(value));
-    return;
+      auto row = size_t{0};
+      create_iterable_from_segment<ColumnDataType>(typed_segment).for_each([&](const auto& value) {
+        if (!value.is_null()) _write_value(value.value(), column_fields);
+        column_field_ends[row++] = column_fields.size();
+      });
+      DebugAssert(row == row_count, "Segment iterable did not produce one value per row");
+    });
   }
 
-  _stream << value;
+  auto total_size = buffer.size() + static_cast<size_t>(row_count) * column_count;
+  for (const auto& column_fields : fields) {
+    total_size += column_fields.size();
+  }
+  buffer.reserve(total_size);
+
+  for (ChunkOffset row = 0; row < row_count; ++row) {
+    for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+      if (column_id > 0) buffer += _config.separator;
+
+      const auto field_begin = row == 0 ? size_t{0} : field_ends[column_id][row - 1];
+      buffer.append(fields[column_id], field_begin, field_ends[column_id][row] - field_begin);
+    }
+    buffer += _config.delimiter;
+  }
+}
+
+template <typename T>
+void CsvWriter::_write_value(const T& value, std::string& buffer) const {
+  if constexpr (std::is_same_v<T, std::string>) {
+    _write_string_value(value, buffer);
+  } else if constexpr (std::is_integral_v<T>) {
+    char formatted[24];
+    const auto result = std::to_chars(std::begin(formatted), std::end(formatted), value);
+    buffer.append(formatted, result.ptr);
+  } else {
+    // Same format as the default formatting of std::ostream, which was used before
+    char formatted[32];
+    const auto length = std::snprintf(formatted, sizeof(formatted), "%g", static_cast<double>(value));
+    buffer.append(formatted, static_cast<size_t>(length));
+  }
 }
 
-void CsvWriter::_write_string_value(const std::string& value) {
+void CsvWriter::_write_string_value(const std::string& value, std::string& buffer) const {
   /**
    * We put an the quotechars around any string value by default
    * as this is the only time when a comma (,) might be inside a value.
@@ -48,23 +83,15 @@ void CsvWriter::_write_string_value(const std::string& value) {
    * this behaviour to either general quoting or checking for "illegal"
    * characters.
    */
-  _stream << _config.quote;
-  _stream << _escape(value);
-  _stream << _config.quote;
-}
+  buffer += _config.quote;
 
-/*
- * Escapes each quote character with an escape symbol.
- */
-std::string CsvWriter::_escape(const std::string& string) {
-  std::string result(string);
-  size_t next_pos = 0;
-  while (std::string::npos != (next_pos = result.find(_config.quote, next_pos))) {
-    result.insert(next_pos, 1, _config.escape);
-    // Has to jump 2 positions ahead because a new character had been inserted.
-    next_pos += 2;
+  // Escape each quote character with an escape symbol
+  for (const auto character : value) {
+    if (character == _config.quote) buffer += _config.escape;
+    buffer += character;
   }
-  return result;
+
+  buffer += _config.quote;
 }
 
 }  // namespace opossum
@@ -1,39 +1,34 @@
 #pragma once
 
-#include <fstream>
 #include <string>
 #include <vector>
 
-#include "all_type_variant.hpp"
 #include "csv_meta.hpp"
-#include "type_cast.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+class Chunk;
+
+/*
+ * Formats chunks as rows of a csv file. Instead of going through AllTypeVariant for every value, the segments are
+ * formatted column by column using their typed iterables and afterwards interleaved into rows.
+ */
 class CsvWriter {
  public:
-  /*
-   * Creates a new CsvWriter with the given file as output file.
-   * @param file The file to output the csv to.
-   */
-  explicit CsvWriter(const std::string& file, const ParseConfig& config = {});
-
-  void write(const AllTypeVariant& value);
+  explicit CsvWriter(const ParseConfig& config = {});
 
   /*
-   * Ends a row of entries in the csv file.
+   * Appends one line per row of the chunk to the buffer.
+   * Null values are written as empty fields.
    */
-  void end_line();
+  void write_chunk(const Chunk& chunk, std::string& buffer) const;
 
  protected:
-  std::string _escape(const std::string& string);
-
-  void _write_value(const AllTypeVariant& value);
-  void _write_string_value(const std::string& value);
+  template <typename T>
+  void _write_value(const T& value, std::string& buffer) const;
+  void _write_string_value(const std::string& value, std::string& buffer) const;
 
-  std::ofstream _stream;
-  ColumnID _current_column_count{0};
   ParseConfig _config;
 };
 
@@ -0,0 +1,55 @@
+#include "ordered_chunk_writer.hpp"
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void write_chunks_in_order(std::ostream& stream, const ChunkID chunk_count,
+                           const std::function<void(ChunkID chunk_id, std::string& buffer)>& serialize_chunk,
+                           const size_t max_chunks_in_flight) {
+  Assert(max_chunks_in_flight > 0, "At least one chunk has to be in flight");
+
+  std::deque<std::pair<std::shared_ptr<AbstractTask>, std::shared_ptr<std::string>>> chunks_in_flight;
+
+  const auto write_oldest_chunk = [&]() {
+    const auto& [task, buffer] = chunks_in_flight.front();
+    task->join();
+    stream.write(buffer->data(), static_cast<std::streamsize>(buffer->size()));
+    chunks_in_flight.pop_front();
+  };
+
+  try {
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      auto buffer = std::make_shared<std::string>();
+      auto task =
+          std::make_shared<JobTask>([&serialize_chunk, chunk_id, buffer]() { serialize_chunk(chunk_id, *buffer); });
+      task->schedule();
+      chunks_in_flight.emplace_back(std::move(task), std::move(buffer));
+
+      if (chunks_in_flight.size() >= max_chunks_in_flight) write_oldest_chunk();
+    }
+
+    while (!chunks_in_flight.empty()) {
+      write_oldest_chunk();
+    }
+  } catch (...) {
+    // The scheduled tasks reference serialize_chunk, which the caller destroys while the exception unwinds its stack.
+    // Thus, they have to be finished before the exception is passed on.
+    auto scheduled_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (const auto& chunk_in_flight : chunks_in_flight) {
+      scheduled_tasks.emplace_back(chunk_in_flight.first);
+    }
+    CurrentScheduler::wait_for_tasks(scheduled_tasks);
+    throw;
+  }
+}
+
+}  // namespace opossum
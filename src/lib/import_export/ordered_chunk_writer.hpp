@@ -0,0 +1,25 @@
+#pragma once
+
+#include <functional>
+#include <ostream>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Serializes the chunks 0 to chunk_count - 1 in parallel JobTasks and writes the results to the stream in the order
+ * of the chunks. Each chunk is serialized by serialize_chunk into its own buffer, which is written with a single
+ * sequential write once the chunk and all chunks before it are done.
+ *
+ * At most max_chunks_in_flight chunks are serialized or waiting to be written at any time. This bounds the memory
+ * used for the buffers, independent of the size of the table.
+ *
+ * If writing to the stream throws, the function waits for the scheduled tasks before it rethrows the exception.
+ */
+void write_chunks_in_order(std::ostream& stream, const ChunkID chunk_count,
+                           const std::function<void(ChunkID chunk_id, std::string& buffer)>& serialize_chunk,
+                           const size_t max_chunks_in_flight = 16);
+
+}  // namespace opossum
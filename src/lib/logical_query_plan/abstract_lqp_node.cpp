@@ -9,6 +9,7 @@
 #include "join_node.hpp"
 #include "lqp_utils.hpp"
 #include "predicate_node.hpp"
+#include "statistics/cardinality_feedback_store.hpp"
 #include "update_node.hpp"
 #include "utils/assert.hpp"
 #include "utils/print_directed_acyclic_graph.hpp"
@@ -209,7 +210,10 @@ ColumnID AbstractLQPNode::get_column_id(const AbstractExpression& expression) co
 }
 
 const std::shared_ptr<TableStatistics> AbstractLQPNode::get_statistics() {
-  return derive_statistics_from(left_input(), right_input());
+  // The inputs' get_statistics() build the subplan keys of their subtrees first, this node's key reuses them
+  const auto subplan_key_cache_scope = CardinalityFeedbackStore::ScopedSubplanKeyCache{};
+  return CardinalityFeedbackStore::get().adjust_statistics(*this, left_input(), right_input(),
+                                                           derive_statistics_from(left_input(), right_input()));
 }
 
 std::shared_ptr<TableStatistics> AbstractLQPNode::derive_statistics_from(
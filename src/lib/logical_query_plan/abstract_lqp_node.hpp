@@ -149,6 +149,9 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode>, pu
    * that shall be reordered with the same reference node.
    *
    * Inheriting nodes are free to override AbstractLQPNode::derive_statistics_from().
+   *
+   * get_statistics() replaces the estimated row count by the actual one if this subplan was executed before (see
+   * CardinalityFeedbackStore).
    */
   const std::shared_ptr<TableStatistics> get_statistics();
   virtual std::shared_ptr<TableStatistics> derive_statistics_from(
@@ -1,5 +1,6 @@
 #include "lqp_translator.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -56,6 +57,7 @@
 #include "sort_node.hpp"
 #include "storage/storage_manager.hpp"
 #include "stored_table_node.hpp"
+#include "type_cast.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
 #include "validate_node.hpp"
@@ -92,6 +94,12 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
   return pqp;
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::find_operator(
+    const std::shared_ptr<const AbstractLQPNode>& node) const {
+  const auto operator_iter = _operator_by_lqp_node.find(node);
+  return operator_iter != _operator_by_lqp_node.end() ? operator_iter->second : nullptr;
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     LQPNodeType type, const std::shared_ptr<AbstractLQPNode>& node) const {
   switch (type) {
@@ -133,23 +141,40 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  /**
+   * Predicates comparing columns of both inputs of an inner join are evaluated by the join itself instead of scanning
+   * the (often much larger) result of the join on a single column, e.g., for joins on composite keys
+   */
+  const auto join_operator = _translate_predicate_nodes_into_join(node);
+  if (join_operator) return join_operator;
+
   const auto input_node = node->left_input();
   const auto input_operator = translate_node(input_node);
   const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
-  const auto operator_scan_predicates =
-      OperatorScanPredicate::from_expression(*predicate_node->predicate, *predicate_node);
-
-  Assert(operator_scan_predicates,
-         "Couldn't translate to OperatorPredicate: "s + predicate_node->predicate->as_column_name());
 
   auto output_operator = input_operator;
 
   switch (predicate_node->scan_type) {
-    case ScanType::TableScan:
+    case ScanType::TableScan: {
+      // BETWEEN and IN with a value list are scanned in a single pass (on the value IDs of dictionary segments)
+      // instead of being split up into multiple scans or being evaluated by the ExpressionEvaluator
+      const auto single_pass_predicate =
+          OperatorScanPredicate::single_pass_from_expression(*predicate_node->predicate, *predicate_node);
+      if (single_pass_predicate) {
+        output_operator = _translate_predicate_node_to_table_scan(*single_pass_predicate, output_operator);
+        break;
+      }
+
+      const auto operator_scan_predicates =
+          OperatorScanPredicate::from_expression(*predicate_node->predicate, *predicate_node);
+
+      Assert(operator_scan_predicates,
+             "Couldn't translate to OperatorPredicate: "s + predicate_node->predicate->as_column_name());
+
       for (const auto& operator_scan_predicate : *operator_scan_predicates) {
         output_operator = _translate_predicate_node_to_table_scan(operator_scan_predicate, output_operator);
       }
-      break;
+    } break;
     case ScanType::IndexScan:
       output_operator = _translate_predicate_node_to_index_scan(predicate_node, output_operator);
       break;
@@ -158,11 +183,40 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
   return output_operator;
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_nodes_into_join(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+
+  auto current_node = node;
+  while (current_node->type == LQPNodeType::Predicate) {
+    const auto predicate_node = std::static_pointer_cast<PredicateNode>(current_node);
+    if (predicate_node->scan_type != ScanType::TableScan) return nullptr;
+
+    // The nodes below `node` are not translated on their own, so they must not be used by other nodes
+    if (current_node != node && current_node->output_count() != 1) return nullptr;
+
+    predicate_nodes.emplace_back(predicate_node);
+    current_node = current_node->left_input();
+  }
+
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(current_node);
+  if (!join_node || join_node->join_mode != JoinMode::Inner || join_node->output_count() != 1) return nullptr;
+
+  auto secondary_predicates = std::vector<OperatorJoinPredicate>{};
+  for (const auto& predicate_node : predicate_nodes) {
+    const auto secondary_predicate = OperatorJoinPredicate::from_expression(
+        *predicate_node->predicate, *join_node->left_input(), *join_node->right_input());
+    if (!secondary_predicate) return nullptr;
+
+    secondary_predicates.emplace_back(*secondary_predicate);
+  }
+
+  return _translate_join_node(join_node, secondary_predicates);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_table_scan(
     const OperatorScanPredicate& operator_scan_predicate,
     const std::shared_ptr<AbstractOperator>& input_operator) const {
-  Assert(operator_scan_predicate.predicate_condition != PredicateCondition::In, "TableScan doesn't support IN yet");
-
   return std::make_shared<TableScan>(input_operator, operator_scan_predicate);
 }
 
@@ -221,16 +275,11 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
                                                 predicate->predicate_condition, right_values, right_values2);
 
-  // See explanation for BETWEEN handling in _translate_predicate_node above.
   std::shared_ptr<TableScan> table_scan;
   if (predicate->predicate_condition == PredicateCondition::Between) {
     Assert(value2_variant, "Need value2 for Between");
-    auto table_scan_gt = std::make_shared<TableScan>(
-        input_operator, OperatorScanPredicate{column_id, PredicateCondition::GreaterThanEquals, value_variant});
-    table_scan_gt->set_excluded_chunk_ids(indexed_chunks);
-
     table_scan = std::make_shared<TableScan>(
-        table_scan_gt, OperatorScanPredicate{column_id, PredicateCondition::LessThanEquals, *value2_variant});
+        input_operator, OperatorScanPredicate{column_id, PredicateCondition::Between, value_variant, *value2_variant});
   } else {
     table_scan = std::make_shared<TableScan>(
         input_operator, OperatorScanPredicate{column_id, predicate->predicate_condition, value_variant});
@@ -302,6 +351,12 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  return _translate_join_node(node, {});
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
+    const std::shared_ptr<AbstractLQPNode>& node,
+    const std::vector<OperatorJoinPredicate>& secondary_predicates) const {
   const auto input_left_operator = translate_node(node->left_input());
   const auto input_right_operator = translate_node(node->right_input());
 
@@ -318,19 +373,32 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
    * Assert that the Join Predicate is simple, e.g. of the form <column_a> <predicate> <column_b>.
    * We do not require <column_a> to be in the left input though.
    */
-  const auto operator_join_predicate =
+  auto operator_join_predicate =
       OperatorJoinPredicate::from_expression(*join_node->join_predicate, *node->left_input(), *node->right_input());
   Assert(operator_join_predicate, "Couldn't translate join predicate: "s + join_node->join_predicate->as_column_name());
 
+  // Prefer an equi predicate as the primary predicate, so that the JoinHash can be used
+  auto operator_secondary_predicates = secondary_predicates;
+  if (operator_join_predicate->predicate_condition != PredicateCondition::Equals) {
+    const auto equi_predicate_iter = std::find_if(
+        operator_secondary_predicates.begin(), operator_secondary_predicates.end(),
+        [&](const auto& predicate) { return predicate.predicate_condition == PredicateCondition::Equals; });
+    if (equi_predicate_iter != operator_secondary_predicates.end()) {
+      std::swap(*operator_join_predicate, *equi_predicate_iter);
+    }
+  }
+
   const auto predicate_condition = operator_join_predicate->predicate_condition;
 
-  if (predicate_condition == PredicateCondition::Equals && join_node->join_mode != JoinMode::Outer) {
+  if (predicate_condition == PredicateCondition::Equals) {
     return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode,
-                                      operator_join_predicate->column_ids, predicate_condition);
+                                      operator_join_predicate->column_ids, predicate_condition,
+                                      operator_secondary_predicates);
   }
 
   return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode,
-                                         operator_join_predicate->column_ids, predicate_condition);
+                                         operator_join_predicate->column_ids, predicate_condition,
+                                         operator_secondary_predicates);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
@@ -376,13 +444,70 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     group_by_column_ids.emplace_back(group_by_column_expression->column_id);
   }
 
-  return std::make_shared<Aggregate>(input_operator, aggregate_column_definitions, group_by_column_ids);
+  /**
+   * Choose the AggregateStrategy. If the input is a SortNode that sorts by the group-by expressions first, the rows of
+   * each group are consecutive and can be aggregated in a single streaming pass. A single group-by column is grouped
+   * without hashing the rows, which falls back to the hash-based grouping for segments where that is not possible.
+   */
+  auto strategy = AggregateStrategy::Hash;
+  if (!group_by_column_ids.empty() && _is_sorted_by(*node->left_input(), aggregate_node->group_by_expressions)) {
+    strategy = AggregateStrategy::SortBased;
+  } else if (group_by_column_ids.size() == 1) {
+    strategy = AggregateStrategy::DirectArray;
+  }
+
+  return std::make_shared<Aggregate>(input_operator, aggregate_column_definitions, group_by_column_ids, strategy);
+}
+
+bool LQPTranslator::_is_sorted_by(const AbstractLQPNode& node,
+                                  const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  // Projections do not change the order of the rows
+  if (node.type == LQPNodeType::Projection) return _is_sorted_by(*node.left_input(), expressions);
+  if (node.type != LQPNodeType::Sort) return false;
+
+  const auto contains = [](const auto& expression_vector, const auto& expression) {
+    return std::any_of(expression_vector.begin(), expression_vector.end(),
+                       [&](const auto& other_expression) { return *other_expression == *expression; });
+  };
+
+  // The rows are sorted by the expressions if they are the first sort expressions, in any order
+  const auto& sort_expressions = static_cast<const SortNode&>(node).expressions;
+  for (auto sort_expression_iter = sort_expressions.begin(); sort_expression_iter != sort_expressions.end();
+       ++sort_expression_iter) {
+    if (!contains(expressions, *sort_expression_iter)) return false;
+
+    const auto leading_sort_expressions =
+        std::vector<std::shared_ptr<AbstractExpression>>(sort_expressions.begin(), std::next(sort_expression_iter));
+    const auto all_sorted = std::all_of(expressions.begin(), expressions.end(), [&](const auto& expression) {
+      return contains(leading_sort_expressions, expression);
+    });
+    if (all_sorted) return true;
+  }
+
+  return false;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
+
+  /**
+   * If the number of rows is a literal, the operators below the Limit need to produce only that many rows. Projections
+   * and Aliases output one row per input row, so the row budget is passed on to their inputs. Operators that have
+   * other consumers as well (see translate_node()) need to produce all rows.
+   */
+  const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(limit_node->num_rows_expression);
+  if (value_expression && !variant_is_null(value_expression->value)) {
+    const auto num_rows = type_cast<int64_t>(value_expression->value);
+    auto budget_node = node->left_input();
+    while (num_rows >= 0 && budget_node && budget_node->output_count() == 1) {
+      translate_node(budget_node)->set_row_budget(static_cast<size_t>(num_rows));
+      if (budget_node->type != LQPNodeType::Projection && budget_node->type != LQPNodeType::Alias) break;
+      budget_node = budget_node->left_input();
+    }
+  }
+
   return std::make_shared<Limit>(input_operator,
                                  _translate_expressions({limit_node->num_rows_expression}, node->left_input()).front());
 }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "all_type_variant.hpp"
@@ -26,12 +27,23 @@ class LQPTranslator {
 
   virtual std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  /**
+   * @return the (topmost) operator that @param node was translated into by this translator, or nullptr if the node was
+   *         not translated by it
+   */
+  std::shared_ptr<AbstractOperator> find_operator(const std::shared_ptr<const AbstractLQPNode>& node) const;
+
  private:
   std::shared_ptr<AbstractOperator> _translate_by_node_type(LQPNodeType type,
                                                             const std::shared_ptr<AbstractLQPNode>& node) const;
 
   std::shared_ptr<AbstractOperator> _translate_stored_table_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  // Translates a chain of PredicateNodes on top of an inner JoinNode into a single join operator that evaluates the
+  // predicates as secondary predicates. Returns nullptr if not all predicates can be evaluated by the join.
+  std::shared_ptr<AbstractOperator> _translate_predicate_nodes_into_join(
+      const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node_to_index_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node_to_table_scan(
@@ -41,6 +53,9 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_join_node(
+      const std::shared_ptr<AbstractLQPNode>& node,
+      const std::vector<OperatorJoinPredicate>& secondary_predicates) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -54,6 +69,11 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_show_tables_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_show_columns_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // Checks whether the output of @param node is sorted by @param expressions, i.e., all rows with the same values for
+  // these expressions are stored consecutively
+  static bool _is_sorted_by(const AbstractLQPNode& node,
+                            const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
+
   // Translate LQP- to PQPExpressions
   std::vector<std::shared_ptr<AbstractExpression>> _translate_expressions(
       const std::vector<std::shared_ptr<AbstractExpression>>& lqp_expressions,
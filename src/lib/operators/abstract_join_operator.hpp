@@ -6,13 +6,15 @@
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
+#include "operator_join_predicate.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
-// operator to join two tables using one column of each table
+// operator to join two tables using one column of each table (the primary predicate)
 // output is a table with ReferenceSegments
-// to filter by multiple criteria, you can chain the operator
+// to filter by multiple criteria, pass secondary predicates (supported by JoinHash and JoinSortMerge) or chain the
+// operator
 
 // As with most operators, we do not guarantee a stable operation with regards
 // to positions - i.e., your sorting order might be disturbed
@@ -28,17 +30,25 @@ class AbstractJoinOperator : public AbstractReadOnlyOperator {
       const OperatorType type, const std::shared_ptr<const AbstractOperator>& left,
       const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode, const ColumnIDPair& column_ids,
       const PredicateCondition predicate_condition,
+      const std::vector<OperatorJoinPredicate>& secondary_predicates = {},
       std::unique_ptr<OperatorPerformanceData> performance_data = std::make_unique<OperatorPerformanceData>());
 
   JoinMode mode() const;
   const ColumnIDPair& column_ids() const;
   PredicateCondition predicate_condition() const;
+
+  // Additional predicates that a pair of rows has to satisfy to be part of the join result, e.g., `a2 = b2` for a join
+  // on a composite key `(a1, a2) = (b1, b2)`. They are evaluated for the pairs of rows satisfying the primary
+  // predicate given by column_ids() and predicate_condition().
+  const std::vector<OperatorJoinPredicate>& secondary_predicates() const;
+
   const std::string description(DescriptionMode description_mode) const override;
 
  protected:
   const JoinMode _mode;
   const ColumnIDPair _column_ids;
   const PredicateCondition _predicate_condition;
+  const std::vector<OperatorJoinPredicate> _secondary_predicates;
 
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
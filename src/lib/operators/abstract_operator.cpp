@@ -9,13 +9,34 @@
 #include "concurrency/transaction_context.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
+#include "utils/cancellation_token.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/memory_arena.hpp"
+#include "utils/memory_tracker.hpp"
 #include "utils/print_directed_acyclic_graph.hpp"
 #include "utils/timer.hpp"
 #include "utils/tracing/probes.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Registers an operator as active in its transaction. The operator is unregistered also if it throws, e.g., because
+// the query was cancelled. Otherwise, a rollback would wait for it forever.
+class ActiveOperatorScope : private Noncopyable {
+ public:
+  explicit ActiveOperatorScope(TransactionContext& transaction_context) : _transaction_context(transaction_context) {
+    _transaction_context.on_operator_started();
+  }
+
+  ~ActiveOperatorScope() { _transaction_context.on_operator_finished(); }
+
+ private:
+  TransactionContext& _transaction_context;
+};
+
+}  // namespace
+
 AbstractOperator::AbstractOperator(const OperatorType type, const std::shared_ptr<const AbstractOperator>& left,
                                    const std::shared_ptr<const AbstractOperator>& right,
                                    std::unique_ptr<OperatorPerformanceData> performance_data)
@@ -29,30 +50,49 @@ void AbstractOperator::execute() {
   DebugAssert(!_input_right || _input_right->get_output(), "Right input has not yet been executed");
   DebugAssert(!_output, "Operator has already been executed");
 
+  // Operators are also executed outside of Tasks (e.g., by OperatorPipelines), so they check for cancellation as well
+  CancellationToken::check_current();
+
   Timer performance_timer;
 
   auto transaction_context = this->transaction_context();
 
-  if (transaction_context) {
-    /**
-     * Do not execute Operators if transaction has been aborted.
-     * Not doing so is crucial in order to make sure no other
-     * tasks of the Transaction run while the Rollback happens.
-     */
-    if (transaction_context->aborted()) {
-      return;
+  // The allocations of the operator (including those of the JobTasks it spawns) are accounted to a tracker that is
+  // nested into the tracker of the current thread, e.g., that of the SQL statement
+  const auto memory_tracker = MemoryTracker::create();
+
+  _memory_arena = std::make_shared<MemoryArena>();
+
+  {
+    const auto scoped_memory_tracker = ScopedMemoryTracker{memory_tracker};
+    const auto scoped_memory_arena = ScopedMemoryArena{_memory_arena};
+
+    if (transaction_context) {
+      /**
+       * Do not execute Operators if transaction has been aborted.
+       * Not doing so is crucial in order to make sure no other
+       * tasks of the Transaction run while the Rollback happens.
+       */
+      if (transaction_context->aborted()) {
+        return;
+      }
+      const auto active_operator_scope = ActiveOperatorScope{*transaction_context};
+      _output = _on_execute(transaction_context);
+    } else {
+      _output = _on_execute(nullptr);
     }
-    transaction_context->on_operator_started();
-    _output = _on_execute(transaction_context);
-    transaction_context->on_operator_finished();
-  } else {
-    _output = _on_execute(nullptr);
+
+    // release any temporary data if possible
+    _on_cleanup();
   }
 
-  // release any temporary data if possible
-  _on_cleanup();
+  // The JobTasks of the operator have released their references to the arena already, so this frees its memory
+  _memory_arena.reset();
 
   _performance_data->walltime = performance_timer.lap();
+  if (_output) _performance_data->output_row_count = _output->row_count();
+  _performance_data->peak_allocated_bytes = memory_tracker->peak_bytes();
+  _performance_data->allocated_bytes = memory_tracker->current_bytes();
 
   DTRACE_PROBE5(HYRISE, OPERATOR_EXECUTED, name().c_str(), _performance_data->walltime.count(),
                 _output ? _output->row_count() : 0, _output ? _output->chunk_count() : 0,
@@ -150,6 +190,18 @@ void AbstractOperator::print(std::ostream& stream) const {
   print_directed_acyclic_graph<const AbstractOperator>(shared_from_this(), get_children_fn, node_print_fn, stream);
 }
 
+bool AbstractOperator::is_pipeline_breaker() const { return true; }
+
+void AbstractOperator::set_row_budget(const std::optional<size_t>& row_budget) { _row_budget = row_budget; }
+
+const std::optional<size_t>& AbstractOperator::row_budget() const { return _row_budget; }
+
+void AbstractOperator::set_memory_budget(const std::optional<size_t>& memory_budget) {
+  _memory_budget = memory_budget;
+}
+
+const std::optional<size_t>& AbstractOperator::memory_budget() const { return _memory_budget; }
+
 void AbstractOperator::set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
   _on_set_parameters(parameters);
   if (input_left()) mutable_input_left()->set_parameters(parameters);
@@ -172,6 +224,8 @@ std::shared_ptr<AbstractOperator> AbstractOperator::_deep_copy_impl(
 
   const auto copied_op = _on_deep_copy(copied_input_left, copied_input_right);
   if (_transaction_context) copied_op->set_transaction_context(*_transaction_context);
+  copied_op->_row_budget = _row_budget;
+  copied_op->_memory_budget = _memory_budget;
 
   copied_ops.emplace(this, copied_op);
 
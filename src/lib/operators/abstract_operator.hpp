@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -12,6 +13,8 @@
 
 namespace opossum {
 
+class MemoryArena;
+class OperatorPipeline;
 class OperatorTask;
 class Table;
 class TransactionContext;
@@ -68,6 +71,8 @@ enum class OperatorType {
 // Find more information about operators in our Wiki: https://github.com/hyrise/hyrise/wiki/operator-concept
 
 class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>, private Noncopyable {
+  friend class OperatorPipeline;
+
  public:
   AbstractOperator(
       const OperatorType type, const std::shared_ptr<const AbstractOperator>& left = nullptr,
@@ -124,6 +129,23 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
 
   void print(std::ostream& stream = std::cout) const;
 
+  // Operators that are no pipeline breakers process each chunk of their (left and only) input independently of the
+  // other chunks and emit at most one output chunk per input chunk. Chains of such operators can be executed chunk by
+  // chunk without materializing the intermediate results (see OperatorPipeline). Conservatively defaults to true.
+  virtual bool is_pipeline_breaker() const;
+
+  // An upper bound for the number of rows the consumer of this operator reads, e.g., because it is the input of a
+  // Limit. Operators that support it (TableScan, Validate, Projection) stop processing their input once their output
+  // has at least that many rows, others ignore it. Must not be set if the operator has other consumers.
+  void set_row_budget(const std::optional<size_t>& row_budget);
+  const std::optional<size_t>& row_budget() const;
+
+  // An upper bound (in bytes) for the intermediate results of memory-intensive operators. Operators that support it
+  // (JoinHash, Aggregate) spill partitions of their input to temporary files (see SpillFile) and process them one after
+  // another if they estimate to exceed it, others ignore it.
+  void set_memory_budget(const std::optional<size_t>& memory_budget);
+  const std::optional<size_t>& memory_budget() const;
+
   // Set all specified parameters within this Operator's expressions and its inputs
   // Parameters can be ValuePlaceholders of prepared SQL statements, or external values in correlated subslects
   void set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
@@ -165,6 +187,17 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Is nullptr until the operator is executed
   std::shared_ptr<const Table> _output;
 
+  // See set_row_budget(), std::nullopt if all rows are needed
+  std::optional<size_t> _row_budget;
+
+  // See set_memory_budget(), std::nullopt if the operator may keep all intermediate results in memory
+  std::optional<size_t> _memory_budget;
+
+  // Serves the transient allocations of the operator while it is executed (see MemoryArena). It is released once the
+  // operator has been cleaned up. As it is a member of the base class, derived operators whose state was not cleaned
+  // up, e.g., because _on_execute() threw, release that state before the arena is destroyed.
+  std::shared_ptr<MemoryArena> _memory_arena;
+
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
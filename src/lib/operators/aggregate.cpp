@@ -6,6 +6,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -17,27 +18,41 @@
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/resolve_encoded_segment_type.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "table_wrapper.hpp"
+#include "type_cast.hpp"
 #include "type_comparison.hpp"
 #include "utils/aligned_size.hpp"
 #include "utils/assert.hpp"
+#include "utils/cancellation_token.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/spill_file.hpp"
 
 namespace opossum {
 
 Aggregate::Aggregate(const std::shared_ptr<AbstractOperator>& in,
                      const std::vector<AggregateColumnDefinition>& aggregates,
-                     const std::vector<ColumnID>& groupby_column_ids)
+                     const std::vector<ColumnID>& groupby_column_ids, const AggregateStrategy strategy)
     : AbstractReadOnlyOperator(OperatorType::Aggregate, in),
       _aggregates(aggregates),
-      _groupby_column_ids(groupby_column_ids) {
+      _groupby_column_ids(groupby_column_ids),
+      _strategy(strategy) {
   Assert(!(aggregates.empty() && groupby_column_ids.empty()),
          "Neither aggregate nor groupby columns have been specified");
+  Assert(strategy != AggregateStrategy::SortBased || !groupby_column_ids.empty(),
+         "SortBased aggregation requires groupby columns");
+  Assert(strategy != AggregateStrategy::DirectArray || groupby_column_ids.size() == 1,
+         "DirectArray aggregation requires exactly one groupby column");
 }
 
 const std::vector<AggregateColumnDefinition>& Aggregate::aggregates() const { return _aggregates; }
 
 const std::vector<ColumnID>& Aggregate::groupby_column_ids() const { return _groupby_column_ids; }
 
+AggregateStrategy Aggregate::strategy() const { return _strategy; }
+
 const std::string Aggregate::name() const { return "Aggregate"; }
 
 const std::string Aggregate::description(DescriptionMode description_mode) const {
@@ -64,13 +79,19 @@ const std::string Aggregate::description(DescriptionMode description_mode) const
 
     if (expression_idx + 1 < _aggregates.size()) desc << ", ";
   }
+
+  if (_strategy == AggregateStrategy::SortBased) {
+    desc << " (sort-based)";
+  } else if (_strategy == AggregateStrategy::DirectArray) {
+    desc << " (direct array)";
+  }
   return desc.str();
 }
 
 std::shared_ptr<AbstractOperator> Aggregate::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Aggregate>(copied_input_left, _aggregates, _groupby_column_ids);
+  return std::make_shared<Aggregate>(copied_input_left, _aggregates, _groupby_column_ids, _strategy);
 }
 
 void Aggregate::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -121,10 +142,34 @@ struct AggregateContext : SegmentVisitorContext {
   }
 
   std::shared_ptr<GroupByContext<AggregateKey>> groupby_context;
-  std::shared_ptr<std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>, std::hash<AggregateKey>>>
-      results;
+  std::shared_ptr<AggregateResults<AggregateKey, AggregateType, ColumnType>> results;
 };
 
+/*
+Calls @param functor for the AggregateResult of every group that occurs in the input, see AggregateResults.
+*/
+template <typename Results, typename Functor>
+void for_each_aggregate_result(Results& results, const Functor& functor) {
+  if constexpr (std::is_same_v<Results, std::vector<typename Results::value_type>>) {
+    for (auto& result : results) {
+      if (!result.row_id.is_null()) functor(result);
+    }
+  } else {
+    for (auto& key_and_result : results) {
+      functor(key_and_result.second);
+    }
+  }
+}
+
+template <typename Results>
+size_t aggregate_result_count(const Results& results) {
+  if constexpr (std::is_same_v<Results, std::vector<typename Results::value_type>>) {
+    return std::count_if(results.begin(), results.end(), [](const auto& result) { return !result.row_id.is_null(); });
+  } else {
+    return results.size();
+  }
+}
+
 /*
 The AggregateFunctionBuilder is used to create the lambda function that will be used by
 the AggregateVisitor. It is a separate class because methods cannot be partially specialized.
@@ -200,6 +245,167 @@ struct AggregateFunctionBuilder<ColumnType, AggregateType, AggregateFunction::Co
   }
 };
 
+/*
+The following functions aggregate an encoded segment whose rows all belong to the same group (i.e., there are no
+groupby columns) without decoding every value. They return false if there is no such kernel for the encoding and the
+aggregate function. As aggregate_count is only used for COUNT and AVG, the kernels of the other functions do not
+maintain it.
+*/
+template <AggregateFunction function, typename AggregateType, typename ColumnDataType>
+void update_min_max(AggregateResult<AggregateType, ColumnDataType>& result, const ColumnDataType& value) {
+  if (!result.current_aggregate ||
+      (function == AggregateFunction::Min ? value_smaller(value, *result.current_aggregate)
+                                          : value_greater(value, *result.current_aggregate))) {
+    result.current_aggregate = value;
+  }
+}
+
+// Adds @param value_count non-NULL values with the sum @param sum to the result of a COUNT, SUM, or AVG
+template <AggregateFunction function, typename AggregateType, typename ColumnDataType>
+void add_values(AggregateResult<AggregateType, ColumnDataType>& result, const size_t value_count,
+                const AggregateType sum) {
+  if (value_count == 0) return;
+
+  result.aggregate_count += value_count;
+  if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+    result.current_aggregate = result.current_aggregate ? *result.current_aggregate + sum : sum;
+  }
+}
+
+template <AggregateFunction function, typename Segment, typename Result>
+bool aggregate_typed_segment(const Segment&, Result&) {
+  return false;
+}
+
+// The dictionary consists of the sorted non-NULL values of the segment. MIN, MAX, and COUNT(DISTINCT) only need the
+// dictionary, the other functions count the occurrences of each ValueID.
+template <AggregateFunction function, typename AggregateType, typename T>
+bool aggregate_typed_segment(const DictionarySegment<T>& segment, AggregateResult<AggregateType, T>& result) {
+  const auto& dictionary = *segment.dictionary();
+
+  if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max) {
+    if (!dictionary.empty()) {
+      update_min_max<function>(result, function == AggregateFunction::Min ? dictionary.front() : dictionary.back());
+    }
+  } else if constexpr (function == AggregateFunction::CountDistinct) {
+    result.distinct_values.insert(dictionary.cbegin(), dictionary.cend());
+  } else {
+    // The null value ID is the size of the dictionary
+    auto value_id_counts = std::vector<size_t>(dictionary.size() + 1);
+    resolve_compressed_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+      for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend(); ++value_id_it) {
+        ++value_id_counts[*value_id_it];
+      }
+    });
+
+    auto value_count = size_t{0};
+    auto sum = AggregateType{0};
+    for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+      value_count += value_id_counts[value_id];
+      if constexpr (function != AggregateFunction::Count) {
+        sum += static_cast<AggregateType>(dictionary[value_id]) * static_cast<AggregateType>(value_id_counts[value_id]);
+      }
+    }
+    add_values<function>(result, value_count, sum);
+  }
+
+  return true;
+}
+
+// Each run is aggregated at once: its value is weighted with the length of the run
+template <AggregateFunction function, typename AggregateType, typename T>
+bool aggregate_typed_segment(const RunLengthSegment<T>& segment, AggregateResult<AggregateType, T>& result) {
+  const auto& values = *segment.values();
+  const auto& null_values = *segment.null_values();
+  const auto& end_positions = *segment.end_positions();
+
+  auto value_count = size_t{0};
+  auto sum = AggregateType{0};
+  auto run_start = ChunkOffset{0};
+  for (auto run_id = size_t{0}; run_id < values.size(); ++run_id) {
+    const auto run_length = end_positions[run_id] + 1 - run_start;
+    run_start = end_positions[run_id] + 1;
+    if (null_values[run_id]) continue;
+
+    if constexpr (function == AggregateFunction::Min || function == AggregateFunction::Max) {
+      update_min_max<function>(result, values[run_id]);
+    } else if constexpr (function == AggregateFunction::CountDistinct) {
+      result.distinct_values.insert(values[run_id]);
+    } else {
+      value_count += run_length;
+      if constexpr (function != AggregateFunction::Count) {
+        sum += static_cast<AggregateType>(values[run_id]) * static_cast<AggregateType>(run_length);
+      }
+    }
+  }
+
+  if constexpr (function == AggregateFunction::Count || function == AggregateFunction::Sum ||
+                function == AggregateFunction::Avg) {
+    add_values<function>(result, value_count, sum);
+  }
+
+  return true;
+}
+
+// For COUNT, SUM, and AVG, the offsets of each block are summed up without adding the block's minimum to each of them.
+// The loop over a block has no branches, so that the compiler can vectorize it.
+template <AggregateFunction function, typename AggregateType, typename T>
+bool aggregate_typed_segment(const FrameOfReferenceSegment<T>& segment, AggregateResult<AggregateType, T>& result) {
+  if constexpr (function != AggregateFunction::Count && function != AggregateFunction::Sum &&
+                function != AggregateFunction::Avg) {
+    return false;
+  } else {
+    const auto& block_minima = segment.block_minima();
+    const auto& null_values = segment.null_values();
+
+    auto value_count = size_t{0};
+    auto sum = AggregateType{0};
+    resolve_compressed_vector_type(segment.offset_values(), [&](const auto& offset_values) {
+      auto offset_it = offset_values.cbegin();
+      auto chunk_offset = size_t{0};
+      for (const auto block_minimum : block_minima) {
+        const auto block_end = std::min(chunk_offset + FrameOfReferenceSegment<T>::block_size, null_values.size());
+
+        auto block_value_count = size_t{0};
+        auto block_offset_sum = uint64_t{0};
+        for (; chunk_offset < block_end; ++chunk_offset, ++offset_it) {
+          const auto is_null = null_values[chunk_offset];
+          block_value_count += is_null ? 0u : 1u;
+          block_offset_sum += is_null ? uint64_t{0} : static_cast<uint64_t>(*offset_it);
+        }
+
+        value_count += block_value_count;
+        if constexpr (function != AggregateFunction::Count) {
+          sum += static_cast<AggregateType>(block_minimum) * static_cast<AggregateType>(block_value_count) +
+                 static_cast<AggregateType>(block_offset_sum);
+        }
+      }
+    });
+    add_values<function>(result, value_count, sum);
+
+    return true;
+  }
+}
+
+template <AggregateFunction function, typename AggregateType, typename ColumnDataType>
+bool aggregate_encoded_segment(const BaseSegment& base_segment,
+                               AggregateResult<AggregateType, ColumnDataType>& result) {
+  const auto encoded_segment = dynamic_cast<const BaseEncodedSegment*>(&base_segment);
+  if (!encoded_segment) return false;
+
+  // SUM and AVG on strings are rejected before the aggregation
+  if constexpr ((function == AggregateFunction::Sum || function == AggregateFunction::Avg) &&
+                !std::is_arithmetic_v<ColumnDataType>) {
+    return false;
+  } else {
+    auto aggregated = false;
+    resolve_encoded_segment_type<ColumnDataType>(*encoded_segment, [&](const auto& typed_segment) {
+      aggregated = aggregate_typed_segment<function>(typed_segment, result);
+    });
+    return aggregated;
+  }
+}
+
 template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
 void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
                                    const KeysPerChunk<AggregateKey>& keys_per_chunk) {
@@ -213,6 +419,15 @@ void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, cons
   auto& results = *context.results;
   const auto& hash_keys = keys_per_chunk[chunk_id];
 
+  // Without groupby columns, all rows have the AggregateKey 0 and encoded segments are aggregated without decoding them
+  if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+    if (_groupby_column_ids.empty() && base_segment.size() > 0 &&
+        aggregate_encoded_segment<function>(base_segment, results[0])) {
+      results[0].row_id = RowID{chunk_id, ChunkOffset{0}};
+      return;
+    }
+  }
+
   // clang-format off
   resolve_segment_type<ColumnDataType>(
       // clang-format on
@@ -248,6 +463,259 @@ void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, cons
       });
 }
 
+template <typename AggregateKey>
+size_t Aggregate::_partition_by_hash(KeysPerChunk<AggregateKey>& keys_per_chunk) const {
+  const auto input_table = input_table_left();
+
+  // Without groupby columns, all rows have the AggregateKey 0
+  auto group_count = size_t{1};
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(_groupby_column_ids.size());
+
+  for (size_t group_column_index = 0; group_column_index < _groupby_column_ids.size(); ++group_column_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, group_column_index]() {
+      const auto column_id = _groupby_column_ids.at(group_column_index);
+      const auto data_type = input_table->column_data_type(column_id);
+
+      resolve_data_type(data_type, [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        /*
+        Store unique IDs for equal values in the groupby column (similar to dictionary encoding).
+        The ID 0 is reserved for NULL values. The combined IDs build an AggregateKey for each row.
+        */
+
+        // This time, we have no idea how much space we need, so we take some memory and then rely on the automatic
+        // resizing. The size is quite random, but since single memory allocations do not cost too much, we rather
+        // allocate a bit too much.
+        auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(1'000'000);
+        auto allocator = PolymorphicAllocator<std::pair<const ColumnDataType, AggregateKeyEntry>>{&temp_buffer};
+
+        auto id_map = std::unordered_map<ColumnDataType, AggregateKeyEntry, std::hash<ColumnDataType>,
+                                         std::equal_to<ColumnDataType>, decltype(allocator)>(allocator);
+        AggregateKeyEntry id_counter = 1u;
+
+        for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+          CancellationToken::check_current();
+
+          const auto chunk_in = input_table->get_chunk(chunk_id);
+          const auto base_segment = chunk_in->get_segment(column_id);
+
+          resolve_segment_type<ColumnDataType>(*base_segment, [&](auto& typed_segment) {
+            auto iterable = create_iterable_from_segment<ColumnDataType>(typed_segment);
+
+            ChunkOffset chunk_offset{0};
+            iterable.for_each([&](const auto& value) {
+              if (value.is_null()) {
+                if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+                  keys_per_chunk[chunk_id][chunk_offset] = 0u;
+                } else {
+                  keys_per_chunk[chunk_id][chunk_offset][group_column_index] = 0u;
+                }
+              } else {
+                auto inserted = id_map.try_emplace(value.value(), id_counter);
+                // store either the current id_counter or the existing ID of the value
+                if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+                  keys_per_chunk[chunk_id][chunk_offset] = inserted.first->second;
+                } else {
+                  keys_per_chunk[chunk_id][chunk_offset][group_column_index] = inserted.first->second;
+                }
+
+                // if the id_map didn't have the value as a key and a new element was inserted
+                if (inserted.second) ++id_counter;
+              }
+
+              ++chunk_offset;
+            });
+          });
+        }
+
+        // With a single groupby column, the IDs are the group IDs
+        if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) group_count = id_counter;
+      });
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  return group_count;
+}
+
+size_t Aggregate::_partition_clustered(KeysPerChunk<AggregateKeyEntry>& keys_per_chunk) const {
+  const auto input_table = input_table_left();
+
+  /*
+  First, every row that starts a new group is marked with a 1 in keys_per_chunk, which is initialized with zeros. A row
+  starts a new group if one of its groupby values (NULLs being equal to each other) differs from the previous row. The
+  first row of a chunk is compared to the last row of the previous non-empty chunk.
+  */
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(input_table->chunk_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&input_table, &keys_per_chunk, chunk_id, this]() {
+      CancellationToken::check_current();
+
+      auto previous_chunk = std::shared_ptr<const Chunk>{};
+      for (auto previous_chunk_id = chunk_id; previous_chunk_id > 0 && !previous_chunk; --previous_chunk_id) {
+        const auto candidate_chunk = input_table->get_chunk(ChunkID{previous_chunk_id - 1});
+        if (candidate_chunk->size() > 0) previous_chunk = candidate_chunk;
+      }
+
+      auto& keys = keys_per_chunk[chunk_id];
+      const auto chunk = input_table->get_chunk(chunk_id);
+
+      for (const auto column_id : _groupby_column_ids) {
+        resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+
+          auto has_previous_value = false;
+          auto previous_is_null = false;
+          auto previous_value = ColumnDataType{};
+
+          if (previous_chunk) {
+            const auto last_value = (*previous_chunk->get_segment(column_id))[previous_chunk->size() - 1];
+            has_previous_value = true;
+            previous_is_null = variant_is_null(last_value);
+            if (!previous_is_null) previous_value = type_cast<ColumnDataType>(last_value);
+          }
+
+          resolve_segment_type<ColumnDataType>(*chunk->get_segment(column_id), [&](auto& typed_segment) {
+            create_iterable_from_segment<ColumnDataType>(typed_segment).for_each([&](const auto& value) {
+              const auto starts_group = !has_previous_value || value.is_null() != previous_is_null ||
+                                        (!value.is_null() && value.value() != previous_value);
+              if (!starts_group) return;
+
+              keys[value.chunk_offset()] = 1u;
+              has_previous_value = true;
+              previous_is_null = value.is_null();
+              if (!previous_is_null) previous_value = value.value();
+            });
+          });
+        });
+      }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // Second, the group IDs are the running sum of the group starts. As the first row always starts a group, we subtract
+  // one to begin with the group ID 0.
+  auto group_count = AggregateKeyEntry{0};
+  for (auto& keys : keys_per_chunk) {
+    for (auto& key : keys) {
+      group_count += key;
+      key = group_count - 1;
+    }
+  }
+
+  return group_count;
+}
+
+size_t Aggregate::_partition_by_direct_array(KeysPerChunk<AggregateKeyEntry>& keys_per_chunk) const {
+  const auto input_table = input_table_left();
+  const auto column_id = _groupby_column_ids.front();
+
+  // As with the Hash strategy, the ID 0 is reserved for NULL values
+  auto group_count = size_t{1};
+
+  resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // Integral values are grouped by their offset to the smallest value if this does not need more group IDs than the
+    // input has rows. Otherwise, the values are mapped to IDs like in _partition_by_hash().
+    auto min_value = std::optional<ColumnDataType>{};
+    if constexpr (std::is_integral_v<ColumnDataType>) {
+      auto max_value = ColumnDataType{};
+      const auto update_min_max = [&](const ColumnDataType& value) {
+        max_value = min_value ? std::max(max_value, value) : value;
+        min_value = min_value ? std::min(*min_value, value) : value;
+      };
+
+      for (const auto& chunk : input_table->chunks()) {
+        CancellationToken::check_current();
+
+        const auto base_segment = chunk->get_segment(column_id);
+        const auto dictionary_segment =
+            std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(base_segment);
+        if (dictionary_segment) {
+          // The dictionary is sorted, so we do not need to look at the rows
+          const auto& dictionary = *dictionary_segment->dictionary();
+          if (!dictionary.empty()) {
+            update_min_max(dictionary.front());
+            update_min_max(dictionary.back());
+          }
+          continue;
+        }
+
+        resolve_segment_type<ColumnDataType>(*base_segment, [&](auto& typed_segment) {
+          create_iterable_from_segment<ColumnDataType>(typed_segment).for_each([&](const auto& value) {
+            if (!value.is_null()) update_min_max(value.value());
+          });
+        });
+      }
+
+      // The subtraction is done on unsigned values, so that it does not overflow for large ranges
+      const auto range = min_value ? static_cast<uint64_t>(max_value) - static_cast<uint64_t>(*min_value) : 0;
+      if (min_value && range < input_table->row_count()) {
+        group_count = range + 2;
+      } else {
+        min_value.reset();
+      }
+    }
+
+    auto id_map = std::unordered_map<ColumnDataType, AggregateKeyEntry>{};
+
+    const auto get_group_id = [&](const ColumnDataType& value) -> AggregateKeyEntry {
+      if constexpr (std::is_integral_v<ColumnDataType>) {
+        if (min_value) return static_cast<uint64_t>(value) - static_cast<uint64_t>(*min_value) + 1;
+      }
+      const auto inserted = id_map.try_emplace(value, group_count);
+      if (inserted.second) ++group_count;
+      return inserted.first->second;
+    };
+
+    for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      CancellationToken::check_current();
+
+      auto& keys = keys_per_chunk[chunk_id];
+      const auto base_segment = input_table->get_chunk(chunk_id)->get_segment(column_id);
+
+      const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(base_segment);
+      if (dictionary_segment) {
+        // Translate each ValueID to its group ID once. The null value ID is the size of the dictionary.
+        const auto& dictionary = *dictionary_segment->dictionary();
+        DebugAssert(dictionary_segment->null_value_id() == dictionary.size(), "Unexpected null value ID");
+
+        auto group_ids = std::vector<AggregateKeyEntry>(dictionary.size() + 1, 0u);
+        for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+          group_ids[value_id] = get_group_id(dictionary[value_id]);
+        }
+
+        resolve_compressed_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+          auto chunk_offset = ChunkOffset{0};
+          for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend();
+               ++value_id_it, ++chunk_offset) {
+            keys[chunk_offset] = group_ids[*value_id_it];
+          }
+        });
+        continue;
+      }
+
+      resolve_segment_type<ColumnDataType>(*base_segment, [&](auto& typed_segment) {
+        create_iterable_from_segment<ColumnDataType>(typed_segment).for_each([&](const auto& value) {
+          keys[value.chunk_offset()] = value.is_null() ? AggregateKeyEntry{0} : get_group_id(value.value());
+        });
+      });
+    }
+  });
+
+  return group_count;
+}
+
 template <typename AggregateKey>
 void Aggregate::_aggregate() {
   // We use monotonic_buffer_resource for the vector of vectors that hold the aggregate keys. That is so that we can
@@ -327,72 +795,25 @@ void Aggregate::_aggregate() {
     }
   }
 
-  // Now that we have the data structures in place, we can start the actual work
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(_groupby_column_ids.size());
-
-  for (size_t group_column_index = 0; group_column_index < _groupby_column_ids.size(); ++group_column_index) {
-    jobs.emplace_back(std::make_shared<JobTask>([&input_table, group_column_index, &keys_per_chunk, this]() {
-      const auto column_id = _groupby_column_ids.at(group_column_index);
-      const auto data_type = input_table->column_data_type(column_id);
-
-      resolve_data_type(data_type, [&](auto type) {
-        using ColumnDataType = typename decltype(type)::type;
-
-        /*
-        Store unique IDs for equal values in the groupby column (similar to dictionary encoding).
-        The ID 0 is reserved for NULL values. The combined IDs build an AggregateKey for each row.
-        */
-
-        // This time, we have no idea how much space we need, so we take some memory and then rely on the automatic
-        // resizing. The size is quite random, but since single memory allocations do not cost too much, we rather
-        // allocate a bit too much.
-        auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(1'000'000);
-        auto allocator = PolymorphicAllocator<std::pair<const ColumnDataType, AggregateKeyEntry>>{&temp_buffer};
-
-        auto id_map = std::unordered_map<ColumnDataType, AggregateKeyEntry, std::hash<ColumnDataType>,
-                                         std::equal_to<ColumnDataType>, decltype(allocator)>(allocator);
-        AggregateKeyEntry id_counter = 1u;
-
-        for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
-          const auto chunk_in = input_table->get_chunk(chunk_id);
-          const auto base_segment = chunk_in->get_segment(column_id);
-
-          resolve_segment_type<ColumnDataType>(*base_segment, [&](auto& typed_segment) {
-            auto iterable = create_iterable_from_segment<ColumnDataType>(typed_segment);
-
-            ChunkOffset chunk_offset{0};
-            iterable.for_each([&](const auto& value) {
-              if (value.is_null()) {
-                if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                  keys_per_chunk[chunk_id][chunk_offset] = 0u;
-                } else {
-                  keys_per_chunk[chunk_id][chunk_offset][group_column_index] = 0u;
-                }
-              } else {
-                auto inserted = id_map.try_emplace(value.value(), id_counter);
-                // store either the current id_counter or the existing ID of the value
-                if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                  keys_per_chunk[chunk_id][chunk_offset] = inserted.first->second;
-                } else {
-                  keys_per_chunk[chunk_id][chunk_offset][group_column_index] = inserted.first->second;
-                }
-
-                // if the id_map didn't have the value as a key and a new element was inserted
-                if (inserted.second) ++id_counter;
-              }
-
-              ++chunk_offset;
-            });
-          });
-        }
-      });
-    }));
-    jobs.back()->schedule();
+  // Now that we have the data structures in place, we can start the actual work. The group_count is only used for
+  // AggregateKeyEntries, whose AggregateResults are stored in vectors with one entry per group ID.
+  auto group_count = size_t{0};
+  if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+    switch (_strategy) {
+      case AggregateStrategy::Hash:
+        group_count = _partition_by_hash<AggregateKey>(keys_per_chunk);
+        break;
+      case AggregateStrategy::SortBased:
+        group_count = _partition_clustered(keys_per_chunk);
+        break;
+      case AggregateStrategy::DirectArray:
+        group_count = _partition_by_direct_array(keys_per_chunk);
+        break;
+    }
+  } else {
+    _partition_by_hash<AggregateKey>(keys_per_chunk);
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
-
   /*
   AGGREGATION PHASE
   */
@@ -408,8 +829,7 @@ void Aggregate::_aggregate() {
     */
     auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
     context->results =
-        std::make_shared<std::unordered_map<AggregateKey, AggregateResult<DistinctAggregateType, DistinctColumnType>,
-                                            std::hash<AggregateKey>>>();
+        std::make_shared<AggregateResults<AggregateKey, DistinctAggregateType, DistinctColumnType>>(group_count);
 
     _contexts_per_column.push_back(context);
   }
@@ -425,17 +845,19 @@ void Aggregate::_aggregate() {
       // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
       auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
       context->results =
-          std::make_shared<std::unordered_map<AggregateKey, AggregateResult<CountAggregateType, CountColumnType>,
-                                              std::hash<AggregateKey>>>();
+          std::make_shared<AggregateResults<AggregateKey, CountAggregateType, CountColumnType>>(group_count);
       _contexts_per_column[column_id] = context;
       continue;
     }
     auto data_type = input_table->column_data_type(*aggregate.column);
-    _contexts_per_column[column_id] = _create_aggregate_context<AggregateKey>(data_type, aggregate.function);
+    _contexts_per_column[column_id] =
+        _create_aggregate_context<AggregateKey>(data_type, aggregate.function, group_count);
   }
 
   // Process Chunks and perform aggregations
   for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    CancellationToken::check_current();
+
     auto chunk_in = input_table->get_chunk(chunk_id);
 
     const auto& hash_keys = keys_per_chunk[chunk_id];
@@ -562,10 +984,8 @@ void Aggregate::_aggregate() {
     auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
         _contexts_per_column[0]);
     auto pos_list = PosList();
-    pos_list.reserve(context->results->size());
-    for (auto& map : *context->results) {
-      pos_list.push_back(map.second.row_id);
-    }
+    pos_list.reserve(aggregate_result_count(*context->results));
+    for_each_aggregate_result(*context->results, [&](const auto& result) { pos_list.push_back(result.row_id); });
     _write_groupby_output(pos_list);
   }
 
@@ -588,10 +1008,28 @@ void Aggregate::_aggregate() {
 }
 
 std::shared_ptr<const Table> Aggregate::_on_execute() {
+  /*
+  The memory consumption is estimated for the worst case of one group per row: an AggregateKey and one AggregateResult
+  per aggregate for every row. Without group-by columns, there is only a single group, so the budget is not checked.
+  */
+  if (_memory_budget && !_groupby_column_ids.empty()) {
+    const auto estimated_memory_consumption =
+        input_table_left()->row_count() *
+        (_groupby_column_ids.size() * sizeof(AggregateKeyEntry) +
+         std::max(_aggregates.size(), size_t{1}) * sizeof(AggregateResult<CountAggregateType, CountColumnType>));
+    const auto memory_budget = std::max(*_memory_budget, size_t{1});
+    const auto spill_file_count =
+        std::min((estimated_memory_consumption + memory_budget - 1) / memory_budget, MAX_SPILL_FILE_COUNT);
+
+    if (spill_file_count > 1) return _aggregate_spilled(spill_file_count);
+  }
+
   // We do not want the overhead of a vector with heap storage when we have a limited number of aggregate columns.
   // The reason we only have specializations up to 2 is because every specialization increases the compile time.
   // Also, we need to make sure that there are tests for at least the first case, one array case, and the fallback.
-  switch (_groupby_column_ids.size()) {
+  // The SortBased strategy identifies the groups of all groupby columns by a single group ID.
+  const auto key_column_count = _strategy == AggregateStrategy::SortBased ? size_t{1} : _groupby_column_ids.size();
+  switch (key_column_count) {
     case 0:
     case 1:
       // No need for a complex data structure if we only have one entry
@@ -614,6 +1052,149 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
   return output;
 }
 
+std::shared_ptr<const Table> Aggregate::_aggregate_spilled(const size_t spill_file_count) {
+  const auto input_table = input_table_left();
+
+  auto spill_files = std::vector<std::unique_ptr<SpillFile>>(spill_file_count);
+  for (auto& spill_file : spill_files) {
+    spill_file = std::make_unique<SpillFile>();
+  }
+
+  // Rows with the same group-by values have the same hash and thus end up in the same spill file. Only the RowIDs of
+  // the rows are spilled, the values are read from the input table again when aggregating the spill file.
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(input_table->chunk_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      auto hashes = std::vector<size_t>(chunk->size());
+
+      for (const auto column_id : _groupby_column_ids) {
+        resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+
+          resolve_segment_type<ColumnDataType>(*chunk->get_segment(column_id), [&](auto& typed_segment) {
+            create_iterable_from_segment<ColumnDataType>(typed_segment).for_each([&](const auto& value) {
+              const auto value_hash = value.is_null() ? size_t{0} : std::hash<ColumnDataType>{}(value.value());
+              boost::hash_combine(hashes[value.chunk_offset()], value_hash);
+            });
+          });
+        });
+      }
+
+      auto buffers = std::vector<std::vector<char>>(spill_file_count);
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        write_spilled_value(buffers[hashes[chunk_offset] % spill_file_count], RowID{chunk_id, chunk_offset});
+      }
+
+      for (auto spill_file_id = size_t{0}; spill_file_id < spill_file_count; ++spill_file_id) {
+        if (!buffers[spill_file_id].empty()) spill_files[spill_file_id]->append(buffers[spill_file_id]);
+      }
+    }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  /**
+   * For reference tables, the ReferenceSegments of a spill file reference the tables that the input references. As
+   * the chunks of the input may reference different tables, the chunks are grouped by the columns they reference. The
+   * rows of a spill file become one chunk per group.
+   */
+  using ReferencedColumns = std::vector<std::pair<std::shared_ptr<const Table>, ColumnID>>;
+  auto referenced_columns_by_group = std::vector<ReferencedColumns>{};
+  auto group_by_chunk = std::vector<size_t>(input_table->chunk_count(), 0);
+  auto input_pos_lists_by_chunk = std::vector<std::vector<std::shared_ptr<const PosList>>>{};
+  if (input_table->type() == TableType::References) {
+    input_pos_lists_by_chunk.resize(input_table->chunk_count());
+    for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      const auto chunk = input_table->get_chunk(chunk_id);
+
+      auto referenced_columns = ReferencedColumns{};
+      for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+        const auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id));
+        input_pos_lists_by_chunk[chunk_id].emplace_back(reference_segment->pos_list());
+        referenced_columns.emplace_back(reference_segment->referenced_table(),
+                                        reference_segment->referenced_column_id());
+      }
+
+      const auto group_iter =
+          std::find(referenced_columns_by_group.cbegin(), referenced_columns_by_group.cend(), referenced_columns);
+      group_by_chunk[chunk_id] = std::distance(referenced_columns_by_group.cbegin(), group_iter);
+      if (group_iter == referenced_columns_by_group.cend()) {
+        referenced_columns_by_group.emplace_back(std::move(referenced_columns));
+      }
+    }
+  }
+  const auto group_count = std::max(referenced_columns_by_group.size(), size_t{1});
+
+  std::shared_ptr<Table> output;
+
+  for (auto& spill_file : spill_files) {
+    _performance_data->spilled_bytes += spill_file->size();
+
+    const auto buffer = spill_file->read();
+    spill_file.reset();
+    if (buffer.empty()) continue;
+
+    auto pos_lists_by_group = std::vector<std::shared_ptr<PosList>>(group_count);
+    auto offset = size_t{0};
+    while (offset < buffer.size()) {
+      const auto row_id = read_spilled_value<RowID>(buffer, offset);
+
+      auto& pos_list = pos_lists_by_group[group_by_chunk[row_id.chunk_id]];
+      if (!pos_list) {
+        pos_list = std::make_shared<PosList>();
+        if (group_count == 1) pos_list->reserve(buffer.size() / sizeof(RowID));
+      }
+      pos_list->emplace_back(row_id);
+    }
+
+    auto spilled_table = std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+
+    for (auto group_id = size_t{0}; group_id < group_count; ++group_id) {
+      const auto& pos_list = pos_lists_by_group[group_id];
+      if (!pos_list) continue;
+
+      Segments segments;
+      for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+        if (input_table->type() == TableType::Data) {
+          segments.emplace_back(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+          continue;
+        }
+
+        auto resolved_pos_list = std::make_shared<PosList>();
+        resolved_pos_list->reserve(pos_list->size());
+        for (const auto& row_id : *pos_list) {
+          resolved_pos_list->emplace_back((*input_pos_lists_by_chunk[row_id.chunk_id][column_id])[row_id.chunk_offset]);
+        }
+
+        const auto& [referenced_table, referenced_column_id] = referenced_columns_by_group[group_id][column_id];
+        segments.emplace_back(
+            std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, resolved_pos_list));
+      }
+
+      spilled_table->append_chunk(segments);
+    }
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(spilled_table);
+    table_wrapper->execute();
+    // The rows of a spill file are not in the order of the input, so they are not clustered by the groupby columns
+    const auto strategy = _strategy == AggregateStrategy::SortBased ? AggregateStrategy::Hash : _strategy;
+    const auto aggregate = std::make_shared<Aggregate>(table_wrapper, _aggregates, _groupby_column_ids, strategy);
+    aggregate->execute();
+
+    const auto aggregated_table = aggregate->get_output();
+    if (!output) output = std::make_shared<Table>(aggregated_table->column_definitions(), TableType::Data);
+    for (const auto& chunk : aggregated_table->chunks()) {
+      output->append_chunk(chunk->segments());
+    }
+  }
+
+  return output;
+}
+
 /*
 The following template functions write the aggregated values for the different aggregate functions.
 They are separate and templated to avoid compiler errors for invalid type/function combinations.
@@ -623,98 +1204,91 @@ template <typename ColumnType, typename AggregateType, AggregateFunction func, t
 typename std::enable_if<
     func == AggregateFunction::Min || func == AggregateFunction::Max || func == AggregateFunction::Sum, void>::type
 write_aggregate_values(std::shared_ptr<ValueSegment<AggregateType>> segment,
-                       std::shared_ptr<std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>,
-                                                          std::hash<AggregateKey>>>
-                           results) {
+                       std::shared_ptr<AggregateResults<AggregateKey, AggregateType, ColumnType>> results) {
   DebugAssert(segment->is_nullable(), "Aggregate: Output segment needs to be nullable");
 
   auto& values = segment->values();
   auto& null_values = segment->null_values();
 
-  values.resize(results->size());
-  null_values.resize(results->size());
+  const auto result_count = aggregate_result_count(*results);
+  values.resize(result_count);
+  null_values.resize(result_count);
 
   size_t i = 0;
-  for (auto& kv : *results) {
-    null_values[i] = !kv.second.current_aggregate;
+  for_each_aggregate_result(*results, [&](const auto& result) {
+    null_values[i] = !result.current_aggregate;
 
-    if (kv.second.current_aggregate) {
-      values[i] = *kv.second.current_aggregate;
+    if (result.current_aggregate) {
+      values[i] = *result.current_aggregate;
     }
     ++i;
-  }
+  });
 }
 
 // COUNT writes the aggregate counter
 template <typename ColumnType, typename AggregateType, AggregateFunction func, typename AggregateKey>
 typename std::enable_if<func == AggregateFunction::Count, void>::type write_aggregate_values(
     std::shared_ptr<ValueSegment<AggregateType>> segment,
-    std::shared_ptr<
-        std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>, std::hash<AggregateKey>>>
-        results) {
+    std::shared_ptr<AggregateResults<AggregateKey, AggregateType, ColumnType>> results) {
   DebugAssert(!segment->is_nullable(), "Aggregate: Output segment for COUNT shouldn't be nullable");
 
   auto& values = segment->values();
-  values.resize(results->size());
+  values.resize(aggregate_result_count(*results));
 
   size_t i = 0;
-  for (auto& kv : *results) {
-    values[i] = kv.second.aggregate_count;
+  for_each_aggregate_result(*results, [&](const auto& result) {
+    values[i] = result.aggregate_count;
     ++i;
-  }
+  });
 }
 
 // COUNT(DISTINCT) writes the number of distinct values
 template <typename ColumnType, typename AggregateType, AggregateFunction func, typename AggregateKey>
 typename std::enable_if<func == AggregateFunction::CountDistinct, void>::type write_aggregate_values(
     std::shared_ptr<ValueSegment<AggregateType>> segment,
-    std::shared_ptr<
-        std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>, std::hash<AggregateKey>>>
-        results) {
+    std::shared_ptr<AggregateResults<AggregateKey, AggregateType, ColumnType>> results) {
   DebugAssert(!segment->is_nullable(), "Aggregate: Output segment for COUNT shouldn't be nullable");
 
   auto& values = segment->values();
-  values.resize(results->size());
+  values.resize(aggregate_result_count(*results));
 
   size_t i = 0;
-  for (auto& kv : *results) {
-    values[i] = kv.second.distinct_values.size();
+  for_each_aggregate_result(*results, [&](const auto& result) {
+    values[i] = result.distinct_values.size();
     ++i;
-  }
+  });
 }
 
 // AVG writes the calculated average from current aggregate and the aggregate counter
 template <typename ColumnType, typename AggregateType, AggregateFunction func, typename AggregateKey>
 typename std::enable_if<func == AggregateFunction::Avg && std::is_arithmetic<AggregateType>::value, void>::type
 write_aggregate_values(std::shared_ptr<ValueSegment<AggregateType>> segment,
-                       std::shared_ptr<std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>,
-                                                          std::hash<AggregateKey>>>
-                           results) {
+                       std::shared_ptr<AggregateResults<AggregateKey, AggregateType, ColumnType>> results) {
   DebugAssert(segment->is_nullable(), "Aggregate: Output segment needs to be nullable");
 
   auto& values = segment->values();
   auto& null_values = segment->null_values();
 
-  values.resize(results->size());
-  null_values.resize(results->size());
+  const auto result_count = aggregate_result_count(*results);
+  values.resize(result_count);
+  null_values.resize(result_count);
 
   size_t i = 0;
-  for (auto& kv : *results) {
-    null_values[i] = !kv.second.current_aggregate;
+  for_each_aggregate_result(*results, [&](const auto& result) {
+    null_values[i] = !result.current_aggregate;
 
-    if (kv.second.current_aggregate) {
-      values[i] = *kv.second.current_aggregate / static_cast<AggregateType>(kv.second.aggregate_count);
+    if (result.current_aggregate) {
+      values[i] = *result.current_aggregate / static_cast<AggregateType>(result.aggregate_count);
     }
     ++i;
-  }
+  });
 }
 
 // AVG is not defined for non-arithmetic types. Avoiding compiler errors.
 template <typename ColumnType, typename AggregateType, AggregateFunction func, typename AggregateKey>
 typename std::enable_if<func == AggregateFunction::Avg && !std::is_arithmetic<AggregateType>::value, void>::type
 write_aggregate_values(std::shared_ptr<ValueSegment<AggregateType>>,
-                       std::shared_ptr<std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnType>,
-                                                          std::hash<AggregateKey>>>) {
+                       std::shared_ptr<AggregateResults<AggregateKey, AggregateType, ColumnType>>) {
   Fail("Invalid aggregate");
 }
 
@@ -797,15 +1371,13 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
   // write all group keys into the respective columns
   if (column_index == 0) {
     auto pos_list = PosList();
-    pos_list.reserve(context->results->size());
-    for (auto& map : *context->results) {
-      pos_list.push_back(map.second.row_id);
-    }
+    pos_list.reserve(aggregate_result_count(*context->results));
+    for_each_aggregate_result(*context->results, [&](const auto& result) { pos_list.push_back(result.row_id); });
     _write_groupby_output(pos_list);
   }
 
   // write aggregated values into the segment
-  if (!context->results->empty()) {
+  if (aggregate_result_count(*context->results) > 0) {
     write_aggregate_values<ColumnType, decltype(aggregate_type), function, AggregateKey>(output_segment,
                                                                                          context->results);
   } else if (_groupby_segments.empty()) {
@@ -821,28 +1393,30 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
 
 template <typename AggregateKey>
 std::shared_ptr<SegmentVisitorContext> Aggregate::_create_aggregate_context(const DataType data_type,
-                                                                            const AggregateFunction function) const {
+                                                                            const AggregateFunction function,
+                                                                            const size_t group_count) const {
   std::shared_ptr<SegmentVisitorContext> context;
   resolve_data_type(data_type, [&](auto type) {
     using ColumnDataType = typename decltype(type)::type;
     switch (function) {
       case AggregateFunction::Min:
-        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Min, AggregateKey>();
+        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Min, AggregateKey>(group_count);
         break;
       case AggregateFunction::Max:
-        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Max, AggregateKey>();
+        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Max, AggregateKey>(group_count);
         break;
       case AggregateFunction::Sum:
-        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Sum, AggregateKey>();
+        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Sum, AggregateKey>(group_count);
         break;
       case AggregateFunction::Avg:
-        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Avg, AggregateKey>();
+        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Avg, AggregateKey>(group_count);
         break;
       case AggregateFunction::Count:
-        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Count, AggregateKey>();
+        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::Count, AggregateKey>(group_count);
         break;
       case AggregateFunction::CountDistinct:
-        context = _create_aggregate_context_impl<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>();
+        context =
+            _create_aggregate_context_impl<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(group_count);
         break;
     }
   });
@@ -850,10 +1424,10 @@ std::shared_ptr<SegmentVisitorContext> Aggregate::_create_aggregate_context(cons
 }
 
 template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
-std::shared_ptr<SegmentVisitorContext> Aggregate::_create_aggregate_context_impl() const {
+std::shared_ptr<SegmentVisitorContext> Aggregate::_create_aggregate_context_impl(const size_t group_count) const {
   const auto context = std::make_shared<AggregateContext<
       ColumnDataType, typename AggregateTraits<ColumnDataType, aggregate_function>::AggregateType, AggregateKey>>();
-  context->results = std::make_shared<typename decltype(context->results)::element_type>();
+  context->results = std::make_shared<typename decltype(context->results)::element_type>(group_count);
   return context;
 }
 
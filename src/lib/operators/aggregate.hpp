@@ -9,6 +9,7 @@
 #include <optional>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -40,6 +41,23 @@ struct AggregateColumnDefinition final {
   AggregateFunction function;
 };
 
+/**
+ * Determines how the Aggregate assigns the input rows to their groups. The strategy is chosen by the LQPTranslator.
+ *
+ * Hash:        The values of each group-by column are mapped to IDs using a hash map. Works for all inputs.
+ * SortBased:   The input is clustered by the group-by columns, i.e., all rows of a group are stored consecutively
+ *              (e.g., because the input was sorted by these columns). A new group starts whenever one of the group-by
+ *              values differs from the previous row, so the groups are formed in one streaming pass without hashing.
+ * DirectArray: Only for a single group-by column. Integral values whose range is not larger than the input are
+ *              grouped by their offset to the smallest value. Otherwise, the rows of DictionarySegments are grouped by
+ *              their ValueIDs, so that only the dictionary entries, but not the rows, need to be looked up in the hash
+ *              map. Other segments are grouped as with the Hash strategy.
+ *
+ * Except for the Hash strategy with more than one group-by column, each group is identified by a dense group ID and
+ * the AggregateResults are stored in vectors instead of hash maps (see AggregateResults).
+ */
+enum class AggregateStrategy { Hash, SortBased, DirectArray };
+
 /*
 Operator to aggregate columns by certain functions, such as min, max, sum, average, and count. The output is a table
  with reference segments. As with most operators we do not guarantee a stable operation with regards to positions -
@@ -68,6 +86,16 @@ using AggregateKeyEntry = uint64_t;
 template <typename AggregateKey>
 using AggregateKeys = pmr_vector<AggregateKey>;
 
+/*
+The AggregateResults of all groups. An AggregateKeyEntry is a dense group ID, so the results are stored in a vector that
+is indexed by the group ID. Entries of group IDs that do not occur in the input have no row_id. Composite keys need
+to be hashed.
+*/
+template <typename AggregateKey, typename AggregateType, typename ColumnDataType>
+using AggregateResults = std::conditional_t<
+    std::is_same_v<AggregateKey, AggregateKeyEntry>, std::vector<AggregateResult<AggregateType, ColumnDataType>>,
+    std::unordered_map<AggregateKey, AggregateResult<AggregateType, ColumnDataType>, std::hash<AggregateKey>>>;
+
 template <typename AggregateKey>
 using KeysPerChunk = pmr_vector<AggregateKeys<AggregateKey>>;
 
@@ -85,10 +113,12 @@ using DistinctAggregateType = int8_t;
 class Aggregate : public AbstractReadOnlyOperator {
  public:
   Aggregate(const std::shared_ptr<AbstractOperator>& in, const std::vector<AggregateColumnDefinition>& aggregates,
-            const std::vector<ColumnID>& groupby_column_ids);
+            const std::vector<ColumnID>& groupby_column_ids,
+            const AggregateStrategy strategy = AggregateStrategy::Hash);
 
   const std::vector<AggregateColumnDefinition>& aggregates() const;
   const std::vector<ColumnID>& groupby_column_ids() const;
+  AggregateStrategy strategy() const;
 
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
@@ -103,6 +133,17 @@ class Aggregate : public AbstractReadOnlyOperator {
   template <typename AggregateKey>
   void _aggregate();
 
+  // The following methods fill @param keys_per_chunk with the AggregateKey of every input row. If AggregateKey is an
+  // AggregateKeyEntry, they return the number of group IDs, i.e., the largest group ID + 1.
+  template <typename AggregateKey>
+  size_t _partition_by_hash(KeysPerChunk<AggregateKey>& keys_per_chunk) const;
+  size_t _partition_clustered(KeysPerChunk<AggregateKeyEntry>& keys_per_chunk) const;
+  size_t _partition_by_direct_array(KeysPerChunk<AggregateKeyEntry>& keys_per_chunk) const;
+
+  // Used if the operator exceeds its memory budget (see AbstractOperator::set_memory_budget): the input rows are
+  // partitioned by their group-by values into @param spill_file_count SpillFiles, which are aggregated one after another.
+  std::shared_ptr<const Table> _aggregate_spilled(const size_t spill_file_count);
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -123,13 +164,15 @@ class Aggregate : public AbstractReadOnlyOperator {
 
   template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
-                                                                   const AggregateFunction function) const;
+                                                                   const AggregateFunction function,
+                                                                   const size_t group_count) const;
 
   template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
-  std::shared_ptr<SegmentVisitorContext> _create_aggregate_context_impl() const;
+  std::shared_ptr<SegmentVisitorContext> _create_aggregate_context_impl(const size_t group_count) const;
 
   const std::vector<AggregateColumnDefinition> _aggregates;
   const std::vector<ColumnID> _groupby_column_ids;
+  const AggregateStrategy _strategy;
 
   TableColumnDefinitions _output_column_definitions;
   Segments _output_segments;
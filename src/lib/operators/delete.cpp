@@ -1,7 +1,9 @@
 #include "delete.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "concurrency/transaction_context.hpp"
 #include "concurrency/transaction_manager.hpp"
@@ -10,6 +12,32 @@
 #include "storage/storage_manager.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Calls func(chunk_id, begin, end) for each run of consecutive RowIDs in the PosList that share the same ChunkID, so
+ * that the MVCC data of a chunk is locked only once per run instead of once per row. Stops and returns false as soon
+ * as func returns false.
+ */
+template <typename Functor>
+bool for_each_chunk_run(const PosList& pos_list, const Functor& func) {
+  auto run_begin = pos_list.cbegin();
+  while (run_begin != pos_list.cend()) {
+    const auto chunk_id = run_begin->chunk_id;
+    const auto run_end = std::find_if(run_begin, pos_list.cend(),
+                                      [&](const auto& row_id) { return row_id.chunk_id != chunk_id; });
+
+    if (!func(chunk_id, run_begin, run_end)) return false;
+    run_begin = run_end;
+  }
+
+  return true;
+}
+
+}  // namespace
+
 namespace opossum {
 
 Delete::Delete(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& values_to_delete)
@@ -30,37 +58,59 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
 
   const auto values_to_delete = input_table_left();
 
+  // The chunk mapping of each referenced copy of the stored table (see below) is only built once
+  auto chunk_id_mappings = std::unordered_map<std::shared_ptr<const Table>, std::vector<ChunkID>>{};
+
   for (ChunkID chunk_id{0}; chunk_id < values_to_delete->chunk_count(); ++chunk_id) {
     const auto chunk = values_to_delete->get_chunk(chunk_id);
 
     // we have already verified that all segments reference the same table
     const auto first_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
-    const auto pos_list = first_segment->pos_list();
+    auto pos_list = first_segment->pos_list();
+
+    // GetTable creates a copy of the table if it excludes chunks (e.g., because they were pruned or compacted by the
+    // GarbageCollector). The copy shares the chunks of the stored table, but numbers them differently.
+    const auto& referenced_table = first_segment->referenced_table();
+    if (referenced_table != _table) {
+      auto chunk_id_mapping_iter = chunk_id_mappings.find(referenced_table);
+      if (chunk_id_mapping_iter == chunk_id_mappings.end()) {
+        chunk_id_mapping_iter =
+            chunk_id_mappings.emplace(referenced_table, _map_chunk_ids_to_stored_table(*referenced_table)).first;
+      }
+      const auto& chunk_id_mapping = chunk_id_mapping_iter->second;
+      if (!chunk_id_mapping.empty()) pos_list = _map_to_stored_table(chunk_id_mapping, *pos_list);
+    }
 
     _pos_lists.emplace_back(pos_list);
 
-    for (const auto& row_id : *pos_list) {
-      auto referenced_chunk = _table->get_chunk(row_id.chunk_id);
-
-      auto expected = 0u;
-      // Actual row lock for delete happens here
-      const auto success =
-          referenced_chunk->get_scoped_mvcc_data_lock()->tids[row_id.chunk_offset].compare_exchange_strong(
-              expected, _transaction_id);
-
-      if (success) continue;
-
-      // If the row has a set TID, it might be a row that our TX inserted
-      // No need to compare-and-swap here, because we can only run into conflicts when two transactions try to
-      // change this row from the initial tid
-      if (auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
-          mvcc_data->tids[row_id.chunk_offset] == _transaction_id) {
-        // Make sure that even we don't see it anymore
-        mvcc_data->tids[row_id.chunk_offset] = TransactionManager::INVALID_TRANSACTION_ID;
-        continue;
+    const auto locked_all_rows = for_each_chunk_run(*pos_list, [&](const ChunkID chunk_id, const auto begin,
+                                                                   const auto end) {
+      auto mvcc_data = _table->get_chunk(chunk_id)->get_scoped_mvcc_data_lock();
+
+      for (auto row_id_iter = begin; row_id_iter != end; ++row_id_iter) {
+        auto& tid = mvcc_data->tids[row_id_iter->chunk_offset];
+
+        auto expected = 0u;
+        // Actual row lock for delete happens here
+        if (tid.compare_exchange_strong(expected, _transaction_id)) continue;
+
+        // If the row has a set TID, it might be a row that our TX inserted
+        // No need to compare-and-swap here, because we can only run into conflicts when two transactions try to
+        // change this row from the initial tid
+        if (expected == _transaction_id) {
+          // Make sure that even we don't see it anymore
+          tid = TransactionManager::INVALID_TRANSACTION_ID;
+          continue;
+        }
+
+        // the row is already locked by someone else and the transaction needs to be rolled back
+        return false;
       }
 
-      // the row is already locked by someone else and the transaction needs to be rolled back
+      return true;
+    });
+
+    if (!locked_all_rows) {
       _mark_as_failed();
       return nullptr;
     }
@@ -73,12 +123,16 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
 
 void Delete::_on_commit_records(const CommitID cid) {
   for (const auto& pos_list : _pos_lists) {
-    for (const auto& row_id : *pos_list) {
-      auto chunk = _table->get_chunk(row_id.chunk_id);
+    for_each_chunk_run(*pos_list, [&](const ChunkID chunk_id, const auto begin, const auto end) {
+      auto mvcc_data = _table->get_chunk(chunk_id)->get_scoped_mvcc_data_lock();
 
-      chunk->get_scoped_mvcc_data_lock()->end_cids[row_id.chunk_offset] = cid;
-      // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
-    }
+      for (auto row_id_iter = begin; row_id_iter != end; ++row_id_iter) {
+        mvcc_data->end_cids[row_id_iter->chunk_offset] = cid;
+        // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
+      }
+
+      return true;
+    });
   }
 }
 
@@ -91,26 +145,68 @@ void Delete::_finish_commit() {
 
 void Delete::_on_rollback_records() {
   for (const auto& pos_list : _pos_lists) {
-    for (const auto& row_id : *pos_list) {
-      auto chunk = _table->get_chunk(row_id.chunk_id);
+    const auto unlocked_all_rows =
+        for_each_chunk_run(*pos_list, [&](const ChunkID chunk_id, const auto begin, const auto end) {
+          auto mvcc_data = _table->get_chunk(chunk_id)->get_scoped_mvcc_data_lock();
 
-      auto expected = _transaction_id;
+          for (auto row_id_iter = begin; row_id_iter != end; ++row_id_iter) {
+            auto expected = _transaction_id;
 
-      // unlock all rows locked in _on_execute
-      const auto result =
-          chunk->get_scoped_mvcc_data_lock()->tids[row_id.chunk_offset].compare_exchange_strong(expected, 0u);
+            // unlock all rows locked in _on_execute
+            const auto result = mvcc_data->tids[row_id_iter->chunk_offset].compare_exchange_strong(expected, 0u);
 
-      // If the above operation fails, it means the row is locked by another transaction. This must have been
-      // the reason why the rollback was initiated. Since _on_execute stopped at this row, we can stop
-      // unlocking rows here as well.
-      if (!result) return;
-    }
+            // If the above operation fails, it means the row is locked by another transaction. This must have been
+            // the reason why the rollback was initiated. Since _on_execute stopped at this row, we can stop
+            // unlocking rows here as well.
+            if (!result) return false;
+          }
+
+          return true;
+        });
+
+    if (!unlocked_all_rows) return;
   }
 }
 
+std::vector<ChunkID> Delete::_map_chunk_ids_to_stored_table(const Table& referenced_table) const {
+  auto chunk_ids = std::unordered_map<std::shared_ptr<const Chunk>, ChunkID>{};
+  for (ChunkID chunk_id{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    chunk_ids.emplace(_table->get_chunk(chunk_id), chunk_id);
+  }
+
+  auto chunk_id_mapping = std::vector<ChunkID>(referenced_table.chunk_count(), INVALID_CHUNK_ID);
+  for (ChunkID chunk_id{0}; chunk_id < referenced_table.chunk_count(); ++chunk_id) {
+    const auto chunk_id_iter = chunk_ids.find(referenced_table.get_chunk(chunk_id));
+    if (chunk_id_iter != chunk_ids.end()) chunk_id_mapping[chunk_id] = chunk_id_iter->second;
+  }
+
+  // Copies that exclude no chunk (see GetTable) number the chunks like the stored table
+  auto is_identity = true;
+  for (ChunkID chunk_id{0}; chunk_id < chunk_id_mapping.size(); ++chunk_id) {
+    is_identity &= chunk_id_mapping[chunk_id] == chunk_id;
+  }
+  if (is_identity) chunk_id_mapping.clear();
+
+  return chunk_id_mapping;
+}
+
+std::shared_ptr<const PosList> Delete::_map_to_stored_table(const std::vector<ChunkID>& chunk_id_mapping,
+                                                            const PosList& pos_list) {
+  auto mapped_pos_list = std::make_shared<PosList>();
+  mapped_pos_list->reserve(pos_list.size());
+
+  for (const auto& row_id : pos_list) {
+    const auto chunk_id = chunk_id_mapping[row_id.chunk_id];
+    Assert(chunk_id != INVALID_CHUNK_ID, "Referenced chunk is not part of the table to delete from");
+    mapped_pos_list->emplace_back(RowID{chunk_id, row_id.chunk_offset});
+  }
+
+  return mapped_pos_list;
+}
+
 /**
  * values_to_delete must be a table with at least one chunk, containing at least one ReferenceSegment
- * that all reference the table specified by table_name.
+ * that all reference the table specified by table_name (or a copy of it sharing its chunks, see GetTable).
  */
 bool Delete::_execution_input_valid(const std::shared_ptr<TransactionContext>& context) const {
   if (context == nullptr) return false;
@@ -132,7 +228,11 @@ bool Delete::_execution_input_valid(const std::shared_ptr<TransactionContext>& c
 
     const auto first_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
 
-    if (table != first_segment->referenced_table()) return false;
+    const auto referenced_table = first_segment->referenced_table();
+    if (table != referenced_table && (referenced_table->type() != TableType::Data ||
+                                      referenced_table->column_definitions() != table->column_definitions())) {
+      return false;
+    }
   }
 
   return true;
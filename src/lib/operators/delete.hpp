@@ -38,6 +38,20 @@ class Delete : public AbstractReadWriteOperator {
    */
   bool _execution_input_valid(const std::shared_ptr<TransactionContext>& context) const;
 
+  /**
+   * Maps the ChunkIDs of a copy of the stored table created by GetTable to the ChunkIDs of the stored table. Chunks
+   * that are not part of the stored table are mapped to INVALID_CHUNK_ID. Returns an empty mapping if the ChunkIDs of
+   * the copy and the stored table are the same.
+   */
+  std::vector<ChunkID> _map_chunk_ids_to_stored_table(const Table& referenced_table) const;
+
+  /**
+   * Maps a PosList that references a copy of the stored table to the ChunkIDs of the stored table, using the
+   * @param chunk_id_mapping created by _map_chunk_ids_to_stored_table()
+   */
+  static std::shared_ptr<const PosList> _map_to_stored_table(const std::vector<ChunkID>& chunk_id_mapping,
+                                                             const PosList& pos_list);
+
  private:
   const std::string _table_name;
   std::shared_ptr<Table> _table;
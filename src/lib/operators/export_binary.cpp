@@ -1,29 +1,32 @@
 #include "export_binary.hpp"
 
-#include <cstring>
 #include <fstream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "import_export/binary.hpp"
+#include "import_export/ordered_chunk_writer.hpp"
+#include "storage/create_iterable_from_segment.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
-#include "type_cast.hpp"
 #include "types.hpp"
 
 namespace {
 
-// Writes the content of the vector to the ofstream
+// Appends the content of the vector to the buffer
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values);
+void export_values(std::string& buffer, const std::vector<T, Alloc>& values);
 
-/* Writes the given strings to the ofstream. First an array of string lengths is written. After that the string are
+/* Appends the given strings to the buffer. First an array of string lengths is written. After that the string are
  * written without any gaps between them.
  * In order to reduce the number of memory allocations we iterate twice over the string vector.
  * After the first iteration we know the number of byte that must be written to the file and can construct a buffer of
@@ -31,7 +34,7 @@ void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values)
  * This approach is indeed faster than a dynamic approach with a stringstream.
  */
 template <typename Alloc>
-void export_string_values(std::ofstream& ofstream, const std::vector<std::string, Alloc>& values) {
+void export_string_values(std::string& buffer, const std::vector<std::string, Alloc>& values) {
   std::vector<size_t> string_lengths(values.size());
   size_t total_length = 0;
 
@@ -41,72 +44,95 @@ void export_string_values(std::ofstream& ofstream, const std::vector<std::string
     total_length += values[i].size();
   }
 
-  export_values(ofstream, string_lengths);
+  export_values(buffer, string_lengths);
 
   // We do not have to iterate over values if all strings are empty.
   if (total_length == 0) return;
 
-  // Write all string contents into to buffer.
-  std::vector<char> buffer(total_length);
-  size_t start = 0;
+  // Write all string contents without gaps.
+  buffer.reserve(buffer.size() + total_length);
   for (const auto& str : values) {
-    std::memcpy(buffer.data() + start, str.data(), str.size());
-    start += str.size();
+    buffer.append(str);
   }
-
-  export_values(ofstream, buffer);
 }
 
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values) {
-  ofstream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+void export_values(std::string& buffer, const std::vector<T, Alloc>& values) {
+  buffer.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
 }
 
 // specialized implementation for string values
 template <>
-void export_values(std::ofstream& ofstream, const opossum::pmr_vector<std::string>& values) {
-  export_string_values(ofstream, values);
+void export_values(std::string& buffer, const opossum::pmr_vector<std::string>& values) {
+  export_string_values(buffer, values);
 }
 template <>
-void export_values(std::ofstream& ofstream, const std::vector<std::string>& values) {
-  export_string_values(ofstream, values);
+void export_values(std::string& buffer, const std::vector<std::string>& values) {
+  export_string_values(buffer, values);
 }
 
 // specialized implementation for bool values
 template <>
-void export_values(std::ofstream& ofstream, const std::vector<bool>& values) {
+void export_values(std::string& buffer, const std::vector<bool>& values) {
   // Cast to fixed-size format used in binary file
   const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.begin(), values.end());
-  export_values(ofstream, writable_bools);
+  export_values(buffer, writable_bools);
+}
+template <>
+void export_values(std::string& buffer, const opossum::pmr_vector<bool>& values) {
+  const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.begin(), values.end());
+  export_values(buffer, writable_bools);
 }
 
 template <typename T>
-void export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector<T>& values) {
+void export_values(std::string& buffer, const opossum::pmr_concurrent_vector<T>& values) {
   // TODO(all): could be faster if we directly write the values into the stream without prior conversion
   const auto value_block = std::vector<T>{values.begin(), values.end()};
-  ofstream.write(reinterpret_cast<const char*>(value_block.data()), value_block.size() * sizeof(T));
+  export_values(buffer, value_block);
 }
 
 // specialized implementation for string values
 template <>
-void export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector<std::string>& values) {
+void export_values(std::string& buffer, const opossum::pmr_concurrent_vector<std::string>& values) {
   // TODO(all): could be faster if we directly write the values into the stream without prior conversion
   const auto value_block = std::vector<std::string>{values.begin(), values.end()};
-  export_string_values(ofstream, value_block);
+  export_string_values(buffer, value_block);
 }
 
 // specialized implementation for bool values
 template <>
-void export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector<bool>& values) {
+void export_values(std::string& buffer, const opossum::pmr_concurrent_vector<bool>& values) {
   // Cast to fixed-size format used in binary file
   const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.begin(), values.end());
-  export_values(ofstream, writable_bools);
+  export_values(buffer, writable_bools);
 }
 
-// Writes a shallow copy of the given value to the ofstream
+// Appends a shallow copy of the given value to the buffer
 template <typename T>
-void export_value(std::ofstream& ofstream, const T& value) {
-  ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+void export_value(std::string& buffer, const T& value) {
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Materializes a segment using its iterable and writes it in the format of a value segment
+template <typename T, typename Iterable>
+void export_materialized_segment(std::string& buffer, const Iterable& iterable, const size_t size,
+                                 const bool is_nullable) {
+  auto values = std::vector<T>(size);
+  auto null_values = std::vector<bool>(size);
+
+  auto index = size_t{0};
+  iterable.for_each([&](const auto& value) {
+    if (value.is_null()) {
+      null_values[index] = true;
+    } else {
+      values[index] = value.value();
+    }
+    ++index;
+  });
+
+  export_value(buffer, opossum::BinarySegmentType::value_segment);
+  if (is_nullable) export_values(buffer, null_values);
+  export_values(buffer, values);
 }
 }  // namespace
 
@@ -123,11 +149,14 @@ std::shared_ptr<const Table> ExportBinary::_on_execute() {
   ofstream.open(_filename, std::ios::binary);
 
   const auto table = _input_left->get_output();
-  _write_header(table, ofstream);
 
-  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id++) {
-    _write_chunk(table, ofstream, chunk_id);
-  }
+  std::string header;
+  _write_header(table, header);
+  ofstream.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+  write_chunks_in_order(ofstream, table->chunk_count(), [&](const ChunkID chunk_id, std::string& buffer) {
+    _write_chunk(table, buffer, chunk_id);
+  });
 
   return _input_left->get_output();
 }
@@ -140,10 +169,10 @@ std::shared_ptr<AbstractOperator> ExportBinary::_on_deep_copy(
 
 void ExportBinary::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
-void ExportBinary::_write_header(const std::shared_ptr<const Table>& table, std::ofstream& ofstream) {
-  export_value(ofstream, static_cast<ChunkOffset>(table->max_chunk_size()));
-  export_value(ofstream, static_cast<ChunkID>(table->chunk_count()));
-  export_value(ofstream, static_cast<ColumnID>(table->column_count()));
+void ExportBinary::_write_header(const std::shared_ptr<const Table>& table, std::string& buffer) {
+  export_value(buffer, static_cast<ChunkOffset>(table->max_chunk_size()));
+  export_value(buffer, static_cast<ChunkID>(table->chunk_count()));
+  export_value(buffer, static_cast<ColumnID>(table->column_count()));
 
   std::vector<std::string> column_types(table->column_count());
   std::vector<std::string> column_names(table->column_count());
@@ -155,20 +184,20 @@ void ExportBinary::_write_header(const std::shared_ptr<const Table>& table, std:
     column_names[column_id] = table->column_name(column_id);
     columns_are_nullable[column_id] = table->column_is_nullable(column_id);
   }
-  export_values(ofstream, column_types);
-  export_values(ofstream, columns_are_nullable);
-  export_string_values(ofstream, column_names);
+  export_values(buffer, column_types);
+  export_values(buffer, columns_are_nullable);
+  export_string_values(buffer, column_names);
 }
 
-void ExportBinary::_write_chunk(const std::shared_ptr<const Table>& table, std::ofstream& ofstream,
+void ExportBinary::_write_chunk(const std::shared_ptr<const Table>& table, std::string& buffer,
                                 const ChunkID& chunk_id) {
   const auto chunk = table->get_chunk(chunk_id);
-  const auto context = std::make_shared<ExportContext>(ofstream);
 
-  export_value(ofstream, static_cast<ChunkOffset>(chunk->size()));
+  export_value(buffer, static_cast<ChunkOffset>(chunk->size()));
 
   // Iterating over all segments of this chunk and exporting them
   for (ColumnID column_id{0}; column_id < chunk->column_count(); column_id++) {
+    const auto context = std::make_shared<ExportContext>(buffer, table->column_is_nullable(column_id));
     auto visitor =
         make_unique_by_data_type<AbstractSegmentVisitor, ExportBinaryVisitor>(table->column_data_type(column_id));
     resolve_data_and_segment_type(*chunk->get_segment(column_id),
@@ -184,13 +213,13 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseValueSegment
   auto context = std::static_pointer_cast<ExportContext>(base_context);
   const auto& segment = static_cast<const ValueSegment<T>&>(base_segment);
 
-  export_value(context->ofstream, BinarySegmentType::value_segment);
+  export_value(context->buffer, BinarySegmentType::value_segment);
 
   if (segment.is_nullable()) {
-    export_values(context->ofstream, segment.null_values());
+    export_values(context->buffer, segment.null_values());
   }
 
-  export_values(context->ofstream, segment.values());
+  export_values(context->buffer, segment.values());
 }
 
 template <typename T>
@@ -199,40 +228,8 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const ReferenceSegment
   auto context = std::static_pointer_cast<ExportContext>(base_context);
 
   // We materialize reference segments and save them as value segments
-  export_value(context->ofstream, BinarySegmentType::value_segment);
-
-  // Unfortunately, we have to iterate over all values of the reference segment
-  // to materialize its contents. Then we can write them to the file
-  for (ChunkOffset row = 0; row < ref_segment.size(); ++row) {
-    export_value(context->ofstream, type_cast<T>(ref_segment[row]));
-  }
-}
-
-// handle_segment implementation for string segments
-template <>
-void ExportBinary::ExportBinaryVisitor<std::string>::handle_segment(
-    const ReferenceSegment& ref_segment, std::shared_ptr<SegmentVisitorContext> base_context) {
-  auto context = std::static_pointer_cast<ExportContext>(base_context);
-
-  // We materialize reference segments and save them as value segments
-  export_value(context->ofstream, BinarySegmentType::value_segment);
-
-  // If there is no data, we can skip all of the coming steps.
-  if (ref_segment.size() == 0) return;
-
-  std::stringstream values;
-  std::string value;
-  std::vector<size_t> string_lengths(ref_segment.size());
-
-  // We export the values materialized
-  for (ChunkOffset row = 0; row < ref_segment.size(); ++row) {
-    value = type_cast<std::string>(ref_segment[row]);
-    string_lengths[row] = value.length();
-    values << value;
-  }
-
-  export_values(context->ofstream, string_lengths);
-  context->ofstream << values.rdbuf();
+  export_materialized_segment<T>(context->buffer, create_iterable_from_segment<T>(ref_segment), ref_segment.size(),
+                                 context->is_nullable);
 }
 
 template <typename T>
@@ -240,80 +237,121 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseDictionarySe
                                                           std::shared_ptr<SegmentVisitorContext> base_context) {
   auto context = std::static_pointer_cast<ExportContext>(base_context);
 
-  const auto is_fixed_size_byte_aligned = [&]() {
-    switch (base_segment.compressed_vector_type()) {
-      case CompressedVectorType::FixedSize4ByteAligned:
-      case CompressedVectorType::FixedSize2ByteAligned:
-      case CompressedVectorType::FixedSize1ByteAligned:
-        return true;
-      default:
-        return false;
-    }
-  }();
-
-  if (!is_fixed_size_byte_aligned) {
-    Fail("Does only support fixed-size byte-aligned compressed attribute vectors.");
-  }
-
-  export_value(context->ofstream, BinarySegmentType::dictionary_segment);
+  const auto dictionary_size = static_cast<ValueID>(base_segment.unique_values_count());
 
   const auto attribute_vector_width = [&]() {
     switch (base_segment.compressed_vector_type()) {
       case CompressedVectorType::FixedSize4ByteAligned:
-        return 4u;
+        return AttributeVectorWidth{4};
       case CompressedVectorType::FixedSize2ByteAligned:
-        return 2u;
+        return AttributeVectorWidth{2};
       case CompressedVectorType::FixedSize1ByteAligned:
-        return 1u;
+        return AttributeVectorWidth{1};
       default:
-        return 0u;
+        // The attribute vector is decompressed. Its largest value is the null value id, i.e., the dictionary size.
+        if (dictionary_size <= std::numeric_limits<uint8_t>::max()) return AttributeVectorWidth{1};
+        if (dictionary_size <= std::numeric_limits<uint16_t>::max()) return AttributeVectorWidth{2};
+        return AttributeVectorWidth{4};
     }
   }();
 
+  export_value(context->buffer, BinarySegmentType::dictionary_segment);
+
   // Write attribute vector width
-  export_value(context->ofstream, static_cast<const AttributeVectorWidth>(attribute_vector_width));
+  export_value(context->buffer, attribute_vector_width);
 
+  // Write the dictionary size and dictionary
+  export_value(context->buffer, dictionary_size);
   if (base_segment.encoding_type() == EncodingType::FixedStringDictionary) {
     const auto& segment = static_cast<const FixedStringDictionarySegment<std::string>&>(base_segment);
-
-    // Write the dictionary size and dictionary
-    export_value(context->ofstream, static_cast<ValueID>(segment.dictionary()->size()));
-    export_values(context->ofstream, *segment.dictionary());
+    export_values(context->buffer, *segment.dictionary());
   } else {
     const auto& segment = static_cast<const DictionarySegment<T>&>(base_segment);
-
-    // Write the dictionary size and dictionary
-    export_value(context->ofstream, static_cast<ValueID>(segment.dictionary()->size()));
-    export_values(context->ofstream, *segment.dictionary());
+    export_values(context->buffer, *segment.dictionary());
   }
 
   // Write attribute vector
-  _export_attribute_vector(context->ofstream, base_segment.compressed_vector_type(), *base_segment.attribute_vector());
+  switch (base_segment.compressed_vector_type()) {
+    case CompressedVectorType::FixedSize4ByteAligned:
+    case CompressedVectorType::FixedSize2ByteAligned:
+    case CompressedVectorType::FixedSize1ByteAligned:
+      _export_attribute_vector(context->buffer, base_segment.compressed_vector_type(),
+                               *base_segment.attribute_vector());
+      break;
+    default:
+      _export_decompressed_attribute_vector(context->buffer, attribute_vector_width, *base_segment.attribute_vector());
+  }
 }
 
 template <typename T>
 void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseEncodedSegment& base_segment,
                                                           std::shared_ptr<SegmentVisitorContext> base_context) {
-  Fail("Binary export not implemented yet for encoded segments.");
+  auto context = std::static_pointer_cast<ExportContext>(base_context);
+
+  if (base_segment.encoding_type() == EncodingType::RunLength) {
+    const auto& segment = static_cast<const RunLengthSegment<T>&>(base_segment);
+
+    export_value(context->buffer, BinarySegmentType::run_length_segment);
+    export_value(context->buffer, static_cast<ChunkOffset>(segment.values()->size()));
+    export_values(context->buffer, *segment.values());
+    export_values(context->buffer, *segment.null_values());
+    export_values(context->buffer, *segment.end_positions());
+    return;
+  }
+
+  // Encodings without a binary representation are materialized and saved as value segments
+  resolve_encoded_segment_type<T>(base_segment, [&](const auto& typed_segment) {
+    export_materialized_segment<T>(context->buffer, create_iterable_from_segment<T>(typed_segment),
+                                   typed_segment.size(), context->is_nullable);
+  });
 }
 
 template <typename T>
-void ExportBinary::ExportBinaryVisitor<T>::_export_attribute_vector(std::ofstream& ofstream,
+void ExportBinary::ExportBinaryVisitor<T>::_export_attribute_vector(std::string& buffer,
                                                                     const CompressedVectorType type,
                                                                     const BaseCompressedVector& attribute_vector) {
   switch (type) {
     case CompressedVectorType::FixedSize4ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(attribute_vector).data());
+      export_values(buffer, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(attribute_vector).data());
       return;
     case CompressedVectorType::FixedSize2ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(attribute_vector).data());
+      export_values(buffer, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(attribute_vector).data());
       return;
     case CompressedVectorType::FixedSize1ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(attribute_vector).data());
+      export_values(buffer, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(attribute_vector).data());
       return;
     default:
       Fail("Any other type should have been caught before.");
   }
 }
 
+template <typename T>
+void ExportBinary::ExportBinaryVisitor<T>::_export_decompressed_attribute_vector(
+    std::string& buffer, const AttributeVectorWidth width, const BaseCompressedVector& attribute_vector) {
+  const auto decompress = [&](auto value_id_type) {
+    using ValueIDType = decltype(value_id_type);
+
+    auto decoder = attribute_vector.create_base_decoder();
+    auto value_ids = std::vector<ValueIDType>(decoder->size());
+    for (auto index = size_t{0}; index < value_ids.size(); ++index) {
+      value_ids[index] = static_cast<ValueIDType>(decoder->get(index));
+    }
+    export_values(buffer, value_ids);
+  };
+
+  switch (width) {
+    case 4:
+      decompress(uint32_t{});
+      return;
+    case 2:
+      decompress(uint16_t{});
+      return;
+    case 1:
+      decompress(uint8_t{});
+      return;
+    default:
+      Fail("Invalid attribute vector width");
+  }
+}
+
 }  // namespace opossum
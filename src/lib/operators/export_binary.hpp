@@ -17,7 +17,9 @@ class BaseCompressedVector;
 enum class CompressedVectorType : uint8_t;
 
 /**
- * Note: ExportBinary does not support null values at the moment
+ * Exports a table into the binary format read by ImportBinary. The chunks are serialized in parallel into separate
+ * buffers, which are written to the file in order. Dictionary and run-length encoded segments are written in their
+ * encoded form, all other segments are materialized.
  */
 class ExportBinary : public AbstractReadOnlyOperator {
  public:
@@ -45,7 +47,7 @@ class ExportBinary : public AbstractReadOnlyOperator {
   const std::string _filename;
 
   /**
-   * This methods writes the header of this table into the given ofstream.
+   * This methods writes the header of this table into the given buffer.
    *
    * Description           | Type                                  | Size in bytes
    * -----------------------------------------------------------------------------------------
@@ -58,12 +60,12 @@ class ExportBinary : public AbstractReadOnlyOperator {
    * Column names          | std::string array                     |   Sum of lengths of all names
    *
    * @param table The table that is to be exported
-   * @param ofstream The output stream for exporting
+   * @param buffer The buffer the header is appended to
    */
-  static void _write_header(const std::shared_ptr<const Table>& table, std::ofstream& ofstream);
+  static void _write_header(const std::shared_ptr<const Table>& table, std::string& buffer);
 
   /**
-   * Writes the contents of the chunk into the given ofstream.
+   * Appends the contents of the chunk to the given buffer.
    * First, it creates a chunk header with the following contents:
    *
    * Description           | Type                                  | Size in bytes
@@ -74,18 +76,21 @@ class ExportBinary : public AbstractReadOnlyOperator {
    * of the segment, such as ReferenceSegment, DictionarySegment, ValueSegment).
    *
    * @param table The table we are currently exporting
-   * @param ofstream The output stream to write to
+   * @param buffer The buffer to write to
    * @param chunkId The id of the chunk that is to be worked on now
    *
    */
-  static void _write_chunk(const std::shared_ptr<const Table>& table, std::ofstream& ofstream, const ChunkID& chunk_id);
+  static void _write_chunk(const std::shared_ptr<const Table>& table, std::string& buffer, const ChunkID& chunk_id);
 
   template <typename T>
   class ExportBinaryVisitor;
 
   struct ExportContext : SegmentVisitorContext {
-    explicit ExportContext(std::ofstream& ofstream) : ofstream(ofstream) {}
-    std::ofstream& ofstream;
+    ExportContext(std::string& buffer, const bool is_nullable) : buffer(buffer), is_nullable(is_nullable) {}
+    std::string& buffer;
+
+    // Whether the column of the exported segment is nullable, i.e., whether materialized segments need null values
+    const bool is_nullable;
   };
 };
 
@@ -110,29 +115,17 @@ class ExportBinary::ExportBinaryVisitor : public AbstractSegmentVisitor {
    * °: This field is writen if the type of the column is NOT a string
    *
    * @param base_segment The segment to export
-   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the buffer.
    *
    */
   void handle_segment(const BaseValueSegment& base_segment, std::shared_ptr<SegmentVisitorContext> base_context) final;
 
   /**
-   * Reference Segments are dumped with the following layout, which is similar to value segments:
-   *
-   * Description           | Type                                  | Size in bytes
-   * -----------------------------------------------------------------------------------------
-   * Column Type           | ColumnType                            |   1
-   * Values°               | T (int, float, double, long)          |   rows * sizeof(T)
-   * Length of Strings^    | vector<size_t>                        |   rows * 2
-   * Values^               | std::string                           |   rows * string.length()
-   *
-   * Please note that the number of rows are written in the header of the chunk.
-   * The type of the column can be found in the global header of the file.
-   *
-   * ^: These fields are only written if the type of the column IS a string.
-   * °: This field is writen if the type of the column is NOT a string
+   * Reference Segments are materialized using their typed iterable and dumped as value segments, including the null
+   * values if the column is nullable.
    *
    * @param base_segment The segment to export
-   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the buffer.
    */
   void handle_segment(const ReferenceSegment& ref_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
@@ -156,18 +149,46 @@ class ExportBinary::ExportBinaryVisitor : public AbstractSegmentVisitor {
    * ^: These fields are only written if the type of the column IS a string.
    * °: This field is written if the type of the column is NOT a string
    *
+   * Attribute vectors that are not fixed-size byte-aligned are decompressed and written with the smallest width that
+   * fits the dictionary.
+   *
    * @param base_segment The segment to export
-   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the buffer.
    */
   void handle_segment(const BaseDictionarySegment& base_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
 
+  /**
+   * Run Length Segments are dumped with the following layout:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Run count             | ChunkOffset                           |   4
+   * Values°               | T (int, float, double, long)          |   runs * sizeof(T)
+   * Length of Strings^    | vector<size_t>                        |   runs * 8
+   * Values^               | std::string                           |   Sum of all string lengths
+   * Null Values           | vector<bool> (BoolAsByteType)         |   runs * 1
+   * End Positions         | ChunkOffset                           |   runs * 4
+   *
+   * ^: These fields are only written if the type of the column IS a string.
+   * °: This field is written if the type of the column is NOT a string
+   *
+   * All other encoded segments are materialized and dumped as value segments.
+   *
+   * @param base_segment The segment to export
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the buffer.
+   */
   void handle_segment(const BaseEncodedSegment& base_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
 
  private:
   // Chooses the right FixedSizeByteAlignedVector depending on the attribute_vector_width and exports it.
-  static void _export_attribute_vector(std::ofstream& ofstream, const CompressedVectorType type,
+  static void _export_attribute_vector(std::string& buffer, const CompressedVectorType type,
                                        const BaseCompressedVector& attribute_vector);
+
+  // Writes the attribute vector decompressed, using the given width
+  static void _export_decompressed_attribute_vector(std::string& buffer, const AttributeVectorWidth width,
+                                                    const BaseCompressedVector& attribute_vector);
 };
 }  // namespace opossum
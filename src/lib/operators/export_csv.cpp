@@ -1,5 +1,6 @@
 #include "export_csv.hpp"
 
+#include <fstream>
 #include <memory>
 #include <string>
 #include <utility>
@@ -9,8 +10,7 @@
 
 #include "import_export/csv_meta.hpp"
 #include "import_export/csv_writer.hpp"
-#include "storage/materialize.hpp"
-#include "storage/reference_segment.hpp"
+#include "import_export/ordered_chunk_writer.hpp"
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
@@ -67,34 +67,19 @@ void ExportCsv::_generate_content_file(const std::shared_ptr<const Table>& table
    * The disadvantage is that it can be quite slow if the data has been compressed before.
    * Also, it does not involve the column-oriented style used in OpossumDB.
    */
-
-  // Open file for writing
-  CsvWriter writer(csv_file);
+  std::ofstream stream;
+  stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  stream.open(csv_file, std::ios::binary);
 
   /**
-   * Multiple rows containing the values of each respective row are written.
-   * Therefore we first iterate through the chunks, then through the rows
-   * in the chunks and afterwards through the segments of the chunks.
-   *
-   * This is a lot of iterating, but to convert a column-based table to
-   * a row-based representation takes some effort.
+   * The rows of each chunk are formatted in parallel into a separate buffer. To convert the column-based chunk to a
+   * row-based representation, the CsvWriter first formats each segment and then interleaves the fields of all
+   * segments row by row. The buffers are written to the file in the order of the chunks.
    */
-  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    const auto chunk = table->get_chunk(chunk_id);
-
-    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk->size(); ++chunk_offset) {
-      for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
-        const auto segment = chunk->get_segment(column_id);
-
-        // The previous implementation did a double dispatch (at least two virtual method calls)
-        // So the subscript operator cannot be much slower.
-        const auto value = (*segment)[chunk_offset];
-        writer.write(value);
-      }
-
-      writer.end_line();
-    }
-  }
+  const auto writer = CsvWriter{};
+  write_chunks_in_order(stream, table->chunk_count(), [&](const ChunkID chunk_id, std::string& buffer) {
+    writer.write_chunk(*table->get_chunk(chunk_id), buffer);
+  });
 }
 
 }  // namespace opossum
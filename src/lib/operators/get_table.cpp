@@ -7,6 +7,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "concurrency/transaction_context.hpp"
 #include "storage/storage_manager.hpp"
 #include "types.hpp"
 
@@ -44,15 +45,34 @@ void GetTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeV
 
 std::shared_ptr<const Table> GetTable::_on_execute() {
   auto original_table = StorageManager::get().get_table(_name);
-  if (_excluded_chunk_ids.empty()) {
+
+  auto excluded_chunks_set = std::unordered_set<ChunkID>(_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend());
+
+  // Chunks compacted by the GarbageCollector before our snapshot don't contain any rows visible to us. Excluding them
+  // guarantees that no intermediate result of this transaction references them once their data is released.
+  //
+  // All other chunks are referenced through a copy of the table. Results of the transaction hold this copy, and thus
+  // its chunks, even after the transaction ended. This keeps the GarbageCollector from releasing chunks that are
+  // compacted later as long as such a result exists (see GarbageCollector::_collect_table()). Returning the stored
+  // table itself would only keep the table alive, while its chunks are released underneath the result.
+  const auto transaction_context = this->transaction_context();
+  const auto pin_chunks = transaction_context && original_table->has_mvcc() == UseMvcc::Yes;
+  if (pin_chunks) {
+    const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+    for (ChunkID chunk_id{0}; chunk_id < original_table->chunk_count(); ++chunk_id) {
+      const auto cleanup_commit_id = original_table->get_chunk(chunk_id)->get_cleanup_commit_id();
+      if (cleanup_commit_id && *cleanup_commit_id <= snapshot_commit_id) excluded_chunks_set.emplace(chunk_id);
+    }
+  }
+
+  if (excluded_chunks_set.empty() && !pin_chunks) {
     return original_table;
   }
 
   // we create a copy of the original table and don't include the excluded chunks
   const auto pruned_table = std::make_shared<Table>(original_table->column_definitions(), TableType::Data,
                                                     original_table->max_chunk_size(), original_table->has_mvcc());
-  const auto excluded_chunks_set =
-      std::unordered_set<ChunkID>(_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend());
   for (ChunkID chunk_id{0}; chunk_id < original_table->chunk_count(); ++chunk_id) {
     if (excluded_chunks_set.find(chunk_id) == excluded_chunks_set.end()) {
       pruned_table->append_chunk(original_table->get_chunk(chunk_id));
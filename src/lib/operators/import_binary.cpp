@@ -155,6 +155,8 @@ std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file,
       return _import_value_segment<ColumnDataType>(file, row_count, is_nullable);
     case BinarySegmentType::dictionary_segment:
       return _import_dictionary_segment<ColumnDataType>(file, row_count);
+    case BinarySegmentType::run_length_segment:
+      return _import_run_length_segment<ColumnDataType>(file);
     default:
       // This case happens if the read column type is not a valid BinarySegmentType.
       Fail("Cannot import column: invalid column type");
@@ -204,4 +206,14 @@ std::shared_ptr<DictionarySegment<T>> ImportBinary::_import_dictionary_segment(s
   return std::make_shared<DictionarySegment<T>>(dictionary, attribute_vector, null_value_id);
 }
 
+template <typename T>
+std::shared_ptr<RunLengthSegment<T>> ImportBinary::_import_run_length_segment(std::ifstream& file) {
+  const auto run_count = _read_value<ChunkOffset>(file);
+  auto values = std::make_shared<pmr_vector<T>>(_read_values<T>(file, run_count));
+  auto null_values = std::make_shared<pmr_vector<bool>>(_read_values<bool>(file, run_count));
+  auto end_positions = std::make_shared<pmr_vector<ChunkOffset>>(_read_values<ChunkOffset>(file, run_count));
+
+  return std::make_shared<RunLengthSegment<T>>(values, null_values, end_positions);
+}
+
 }  // namespace opossum
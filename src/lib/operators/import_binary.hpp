@@ -11,6 +11,7 @@
 #include "import_export/binary.hpp"
 #include "storage/base_segment.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/value_segment.hpp"
 
 namespace opossum {
@@ -19,8 +20,6 @@ namespace opossum {
  * This operator reads a Opossum binary file and creates a table from that input.
  * If parameter tablename provided, the imported table is stored in the StorageManager. If a table with this name
  * already exists, it is returned and no import is performed.
- *
- * Note: ImportBinary does not support null values at the moment
  */
 class ImportBinary : public AbstractReadOnlyOperator {
  public:
@@ -137,6 +136,25 @@ class ImportBinary : public AbstractReadOnlyOperator {
   template <typename T>
   static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::ifstream& file, ChunkOffset row_count);
 
+  /*
+   * Imports a serialized RunLengthSegment from the given file.
+   * The file must contain data in the following format:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Run count             | ChunkOffset                           |   4
+   * Values°               | T (int, float, double, long)          |   runs * sizeof(T)
+   * Length of Strings^    | size_t                                |   runs * 8
+   * Values^               | std::string                           |   Sum of all string lengths
+   * Null Values           | bool (stored as BoolAsByteType)       |   runs * 1
+   * End Positions         | ChunkOffset                           |   runs * 4
+   *
+   * ^: These fields are only needed if the type of the column is a string.
+   * °: This field is needed if the type of the column is NOT a string
+   */
+  template <typename T>
+  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(std::ifstream& file);
+
   // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
   static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
                                                                         AttributeVectorWidth attribute_vector_width);
@@ -1,6 +1,7 @@
 #include "insert.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
@@ -8,6 +9,7 @@
 #include "concurrency/transaction_context.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/create_iterable_from_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_segment.hpp"
 #include "type_cast.hpp"
@@ -80,11 +82,29 @@ class TypedSegmentProcessor : public AbstractTypedSegmentProcessor {
 
       // Ignore source value and only set null to true
       casted_target->null_values()[target_start_index] = true;
+    } else if (source->data_type() == data_type_from_type<T>()) {
+      // Reference and encoded segments are copied through their iterables, which avoids converting each value to an
+      // AllTypeVariant and, for ReferenceSegments, resolving the type of the referenced segment for each row.
+      resolve_segment_type<T>(*source, [&](const auto& typed_source) {
+        auto iterable = create_iterable_from_segment<T>(typed_source);
+        iterable.with_iterators([&](auto source_it, auto source_end) {
+          std::advance(source_it, source_start_index);
+
+          for (auto target_index = target_start_index; target_index < target_start_index + length;
+               ++target_index, ++source_it) {
+            const auto value = *source_it;
+            if (value.is_null()) {
+              Assert(target_is_nullable, "Cannot insert NULL into NOT NULL target");
+              values[target_index] = T{};
+              casted_target->null_values()[target_index] = true;
+            } else {
+              values[target_index] = value.value();
+            }
+          }
+        });
+      });
     } else {
-      // } else if(auto casted_source = std::dynamic_pointer_cast<ReferenceSegment>(source)){
-      // since we have no guarantee that a ReferenceSegment references only a single other segment,
-      // this would require us to find out the referenced segment's type for each single row.
-      // instead, we just use the slow path below.
+      // The data types of the source and the target mismatch, so we take the slow path with a type_cast for each row
       for (auto i = 0u; i < length; i++) {
         auto ref_value = (*source)[source_start_index + i];
         if (variant_is_null(ref_value)) {
@@ -198,15 +218,19 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
       }
     }
 
-    for (auto i = start_index; i < start_index + current_num_rows_to_insert; i++) {
-      // we do not need to check whether other operators have locked the rows, we have just created them
-      // and they are not visible for other operators.
-      // the transaction IDs are set here and not during the resize, because
-      // tbb::concurrent_vector::grow_to_at_least(n, t)" does not work with atomics, since their copy constructor is
-      // deleted.
-      target_chunk->get_scoped_mvcc_data_lock()->tids[i] = context->transaction_id();
-      _inserted_rows.emplace_back(RowID{target_chunk_id, i});
+    // we do not need to check whether other operators have locked the rows, we have just created them
+    // and they are not visible for other operators.
+    // the transaction IDs are set here and not during the resize, because
+    // tbb::concurrent_vector::grow_to_at_least(n, t)" does not work with atomics, since their copy constructor is
+    // deleted.
+    {
+      auto mvcc_data = target_chunk->get_scoped_mvcc_data_lock();
+      for (auto chunk_offset = start_index; chunk_offset < start_index + current_num_rows_to_insert; ++chunk_offset) {
+        mvcc_data->tids[chunk_offset] = context->transaction_id();
+      }
     }
+    _inserted_ranges.emplace_back(InsertedRange{target_chunk_id, ChunkOffset{start_index},
+                                                ChunkOffset{start_index + current_num_rows_to_insert}});
 
     input_offset += current_num_rows_to_insert;
     start_index = 0u;
@@ -216,25 +240,33 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
 }
 
 void Insert::_on_commit_records(const CommitID cid) {
-  for (auto row_id : _inserted_rows) {
-    auto chunk = _target_table->get_chunk(row_id.chunk_id);
+  for (const auto& inserted_range : _inserted_ranges) {
+    auto mvcc_data = _target_table->get_chunk(inserted_range.chunk_id)->get_scoped_mvcc_data_lock();
 
-    auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
-    mvcc_data->begin_cids[row_id.chunk_offset] = cid;
-    mvcc_data->tids[row_id.chunk_offset] = 0u;
+    for (auto chunk_offset = inserted_range.begin_chunk_offset; chunk_offset < inserted_range.end_chunk_offset;
+         ++chunk_offset) {
+      mvcc_data->begin_cids[chunk_offset] = cid;
+      mvcc_data->tids[chunk_offset] = 0u;
+    }
   }
 }
 
 void Insert::_on_rollback_records() {
-  for (auto row_id : _inserted_rows) {
-    auto chunk = _target_table->get_chunk(row_id.chunk_id);
+  for (const auto& inserted_range : _inserted_ranges) {
+    auto mvcc_data = _target_table->get_chunk(inserted_range.chunk_id)->get_scoped_mvcc_data_lock();
+
     // We set the begin and end cids to 0 (effectively making it invisible for everyone) so that the ChunkCompression
     // does not think that this row is still incomplete. We need to make sure that the end is written before the begin.
-    chunk->get_scoped_mvcc_data_lock()->end_cids[row_id.chunk_offset] = 0u;
+    for (auto chunk_offset = inserted_range.begin_chunk_offset; chunk_offset < inserted_range.end_chunk_offset;
+         ++chunk_offset) {
+      mvcc_data->end_cids[chunk_offset] = 0u;
+    }
     std::atomic_thread_fence(std::memory_order_release);
-    chunk->get_scoped_mvcc_data_lock()->begin_cids[row_id.chunk_offset] = 0u;
-
-    chunk->get_scoped_mvcc_data_lock()->tids[row_id.chunk_offset] = 0u;
+    for (auto chunk_offset = inserted_range.begin_chunk_offset; chunk_offset < inserted_range.end_chunk_offset;
+         ++chunk_offset) {
+      mvcc_data->begin_cids[chunk_offset] = 0u;
+      mvcc_data->tids[chunk_offset] = 0u;
+    }
   }
 }
 
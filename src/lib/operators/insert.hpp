@@ -38,7 +38,13 @@ class Insert : public AbstractReadWriteOperator {
   const std::string _target_table_name;
   std::shared_ptr<Table> _target_table;
 
-  PosList _inserted_rows;
+  // The rows inserted into each target chunk, so that commit and rollback lock the MVCC data once per chunk
+  struct InsertedRange {
+    ChunkID chunk_id;
+    ChunkOffset begin_chunk_offset;
+    ChunkOffset end_chunk_offset;
+  };
+  std::vector<InsertedRange> _inserted_ranges;
 };
 
 }  // namespace opossum
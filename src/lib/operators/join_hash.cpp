@@ -3,9 +3,12 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/variant.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -13,6 +16,7 @@
 #include <vector>
 
 #include "join_hash/hash_traits.hpp"
+#include "multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
@@ -22,7 +26,10 @@
 #include "type_cast.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
+#include "utils/cancellation_token.hpp"
+#include "utils/memory_arena.hpp"
 #include "utils/murmur_hash.hpp"
+#include "utils/spill_file.hpp"
 #include "utils/timer.hpp"
 
 namespace opossum {
@@ -30,8 +37,9 @@ namespace opossum {
 JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                    const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-                   const size_t radix_bits)
-    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition),
+                   const std::vector<OperatorJoinPredicate>& secondary_predicates, const size_t radix_bits)
+    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition,
+                           secondary_predicates),
       _radix_bits(radix_bits) {
   DebugAssert(predicate_condition == PredicateCondition::Equals, "Operator not supported by Hash Join.");
 }
@@ -41,7 +49,8 @@ const std::string JoinHash::name() const { return "JoinHash"; }
 std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition);
+  return std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition,
+                                    _secondary_predicates, _radix_bits);
 }
 
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -52,15 +61,9 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
   ColumnID build_column_id;
   ColumnID probe_column_id;
 
-  // This is the expected implementation for swapping tables:
-  // (1) if left or right outer join, outer relation becomes probe relation (we have to swap only for left outer)
-  // (2) for a semi and anti join the inputs are always swapped
-  bool inputs_swapped = (_mode == JoinMode::Left || _mode == JoinMode::Anti || _mode == JoinMode::Semi);
-
-  // (3) else the smaller relation will become build relation, the larger probe relation
-  if (!inputs_swapped && _input_left->get_output()->row_count() > _input_right->get_output()->row_count()) {
-    inputs_swapped = true;
-  }
+  // The smaller relation becomes the build relation, the larger one the probe relation. This holds for all join modes:
+  // the impl handles outer, semi, and anti joins for both the build and the probe side.
+  const auto inputs_swapped = _input_left->get_output()->row_count() > _input_right->get_output()->row_count();
 
   if (inputs_swapped) {
     // luckily we don't have to swap the operation itself here, because we only support the commutative Equi Join.
@@ -77,12 +80,22 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
   auto adjusted_column_ids = std::make_pair(build_column_id, probe_column_id);
 
+  // The secondary predicates are evaluated on (build row, probe row) pairs, so they need to be swapped as well
+  auto adjusted_secondary_predicates = _secondary_predicates;
+  if (inputs_swapped) {
+    for (auto& predicate : adjusted_secondary_predicates) {
+      std::swap(predicate.column_ids.first, predicate.column_ids.second);
+      predicate.predicate_condition = flip_predicate_condition(predicate.predicate_condition);
+    }
+  }
+
   auto build_input = build_operator->get_output();
   auto probe_input = probe_operator->get_output();
 
   _impl = make_unique_by_data_types<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
       build_input->column_data_type(build_column_id), probe_input->column_data_type(probe_column_id), build_operator,
-      probe_operator, _mode, adjusted_column_ids, _predicate_condition, inputs_swapped, _radix_bits);
+      probe_operator, _mode, adjusted_column_ids, _predicate_condition, adjusted_secondary_predicates, inputs_swapped,
+      _radix_bits, _memory_budget, *_performance_data);
   return _impl->_on_execute();
 }
 
@@ -105,8 +118,17 @@ struct PartitionedElement {
   T value;
 };
 
+/*
+Partitions only live while the join is executed. Thus, they are allocated from the MemoryArena of the operator (or of
+the pair of spilled partitions that is joined) and released together with its other transient data.
+*/
 template <typename T>
-using Partition = std::vector<PartitionedElement<T>>;
+using Partition = pmr_vector<PartitionedElement<T>>;
+
+template <typename T>
+std::shared_ptr<Partition<T>> make_transient_partition() {
+  return std::make_shared<Partition<T>>(PolymorphicAllocator<PartitionedElement<T>>{MemoryArena::transient_resource()});
+}
 
 template <typename T>
 using HashTable = std::unordered_map<T, boost::variant<RowID, PosList>>;
@@ -200,13 +222,50 @@ constexpr Hash hash_value(const OriginalType& value, const unsigned int seed) {
   // clang-format on
 }
 
+/*
+Hashes the values of the columns of the secondary equi predicates for all rows of a chunk. Combined with the hash of the
+join column, these hashes distribute rows with the same join key but different composite keys over the radix
+partitions, e.g., for a join on (tenant_id, id) with few different tenant_ids.
+*/
+std::vector<Hash> hash_secondary_columns(const Chunk& chunk, const std::vector<ColumnID>& column_ids,
+                                         const unsigned int seed) {
+  if (column_ids.empty()) return {};
+
+  auto hashes = std::vector<Hash>(chunk.size());
+
+  for (const auto column_id : column_ids) {
+    resolve_data_and_segment_type(*chunk.get_segment(column_id), [&](auto type, auto& typed_segment) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto chunk_offset = ChunkOffset{0};
+      auto iterable = create_iterable_from_segment<ColumnDataType>(typed_segment);
+      iterable.for_each([&](const auto& value) {
+        // NULLs never satisfy the predicate, so they do not have to end up in the same partition as anything else
+        if (!value.is_null()) {
+          auto& hash = hashes[chunk_offset];
+          hash ^= murmur2<ColumnDataType>(value.value(), seed) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+        ++chunk_offset;
+      });
+    });
+  }
+
+  return hashes;
+}
+
+/*
+Materializes the non-NULL values of the join column. NULL values never match, so they are not partitioned. If rows with
+a NULL value are part of the join result (i.e., for the outer side of outer joins), their positions are written to
+@param null_rows instead.
+*/
 template <typename T, typename HashedType>
 std::shared_ptr<Partition<T>> materialize_input(const std::shared_ptr<const Table>& in_table, ColumnID column_id,
                                                 std::vector<std::shared_ptr<std::vector<size_t>>>& histograms,
                                                 const size_t radix_bits, const unsigned int partitioning_seed,
-                                                bool keep_nulls = false) {
+                                                const std::vector<ColumnID>& secondary_hash_column_ids,
+                                                PosList* null_rows = nullptr) {
   // list of all elements that will be partitioned
-  auto elements = std::make_shared<Partition<T>>();
+  auto elements = make_transient_partition<T>();
   elements->resize(in_table->row_count());
 
   // fan-out
@@ -231,6 +290,9 @@ std::shared_ptr<Partition<T>> materialize_input(const std::shared_ptr<const Tabl
   histograms = std::vector<std::shared_ptr<std::vector<size_t>>>();
   histograms.resize(chunk_offsets.size());
 
+  // The NULL rows are collected per chunk, so that the jobs do not need to synchronize
+  auto null_rows_by_chunk = std::vector<PosList>(null_rows ? in_table->chunk_count() : 0);
+
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(in_table->chunk_count());
 
@@ -241,17 +303,25 @@ std::shared_ptr<Partition<T>> materialize_input(const std::shared_ptr<const Tabl
       auto output_iterator = elements->begin() + output_offset;
       auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
 
+      const auto secondary_hashes =
+          hash_secondary_columns(*in_table->get_chunk(chunk_id), secondary_hash_column_ids, partitioning_seed);
+
       // prepare histogram
       histograms[chunk_id] = std::make_shared<std::vector<size_t>>(num_partitions);
       auto& histogram = static_cast<std::vector<size_t>&>(*histograms[chunk_id]);
 
-      resolve_segment_type<T>(*segment, [&, chunk_id, keep_nulls](auto& typed_segment) {
+      resolve_segment_type<T>(*segment, [&, chunk_id](auto& typed_segment) {
         auto reference_chunk_offset = ChunkOffset{0};
         auto iterable = create_iterable_from_segment<T>(typed_segment);
 
-        iterable.for_each([&, chunk_id, keep_nulls](const auto& value) {
-          if (!value.is_null() || keep_nulls) {
-            const Hash hashed_value = hash_value<T, HashedType>(value.value(), partitioning_seed);
+        iterable.for_each([&, chunk_id](const auto& value) {
+          if (value.is_null()) {
+            if (null_rows) null_rows_by_chunk[chunk_id].emplace_back(chunk_id, value.chunk_offset());
+          } else {
+            Hash hashed_value = hash_value<T, HashedType>(value.value(), partitioning_seed);
+
+            // For ReferenceSegments, chunk_offset() is the position in the segment, as for secondary_hashes
+            if (!secondary_hash_column_ids.empty()) hashed_value ^= secondary_hashes[value.chunk_offset()];
 
             /*
             For ReferenceSegments we do not use the RowIDs from the referenced tables.
@@ -276,11 +346,18 @@ std::shared_ptr<Partition<T>> materialize_input(const std::shared_ptr<const Tabl
         });
       });
     }));
+    jobs.back()->set_preferred_node_id(in_table->get_chunk(chunk_id)->home_node_id());
     jobs.back()->schedule();
   }
 
   CurrentScheduler::wait_for_tasks(jobs);
 
+  if (null_rows) {
+    for (const auto& null_rows_of_chunk : null_rows_by_chunk) {
+      null_rows->insert(null_rows->end(), null_rows_of_chunk.begin(), null_rows_of_chunk.end());
+    }
+  }
+
   return elements;
 }
 
@@ -288,7 +365,7 @@ template <typename T>
 RadixContainer<T> partition_radix_parallel(const std::shared_ptr<Partition<T>>& materialized,
                                            const std::shared_ptr<std::vector<size_t>>& chunk_offsets,
                                            std::vector<std::shared_ptr<std::vector<size_t>>>& histograms,
-                                           const size_t radix_bits, bool keep_nulls = false) {
+                                           const size_t radix_bits) {
   // fan-out
   const size_t num_partitions = 1ull << radix_bits;
 
@@ -297,7 +374,7 @@ RadixContainer<T> partition_radix_parallel(const std::shared_ptr<Partition<T>>&
   size_t mask = static_cast<uint32_t>(pow(2, radix_bits * (pass + 1)) - 1);
 
   // allocate new (shared) output
-  auto output = std::make_shared<Partition<T>>();
+  auto output = make_transient_partition<T>();
   output->resize(materialized->size());
 
   auto& offsets = static_cast<std::vector<size_t>&>(*chunk_offsets);
@@ -337,7 +414,8 @@ RadixContainer<T> partition_radix_parallel(const std::shared_ptr<Partition<T>>&
       for (size_t chunk_offset = input_offset; chunk_offset < input_offset + input_size; ++chunk_offset) {
         auto& element = (*materialized)[chunk_offset];
 
-        if (!keep_nulls && element.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
+        // Skip the slots of NULL values, which have not been materialized
+        if (element.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
           continue;
         }
 
@@ -354,15 +432,137 @@ RadixContainer<T> partition_radix_parallel(const std::shared_ptr<Partition<T>>&
   return radix_output;
 }
 
+/*
+Used instead of materialize_input() if the join exceeds its memory budget (Grace hash join). The non-NULL values are not
+kept in memory, but appended to one of @param spill_files, together with their RowID and hash. The spill file of a value
+is determined by the bits of its hash above the radix bits, so that matching values of both relations end up in spill
+files with the same index and each pair of spill files can be joined on its own.
+*/
+template <typename T, typename HashedType>
+void spill_input(const std::shared_ptr<const Table>& in_table, ColumnID column_id, const size_t radix_bits,
+                 const unsigned int partitioning_seed, const std::vector<ColumnID>& secondary_hash_column_ids,
+                 std::vector<std::unique_ptr<SpillFile>>& spill_files, PosList* null_rows = nullptr) {
+  // The NULL rows are collected per chunk, so that the jobs do not need to synchronize
+  auto null_rows_by_chunk = std::vector<PosList>(null_rows ? in_table->chunk_count() : 0);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(in_table->chunk_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = in_table->get_chunk(chunk_id);
+      const auto secondary_hashes = hash_secondary_columns(*chunk, secondary_hash_column_ids, partitioning_seed);
+
+      // Each job writes its values into one buffer per spill file, which is appended to the file in one go
+      auto buffers = std::vector<std::vector<char>>(spill_files.size());
+
+      resolve_segment_type<T>(*chunk->get_segment(column_id), [&](auto& typed_segment) {
+        auto iterable = create_iterable_from_segment<T>(typed_segment);
+
+        iterable.for_each([&](const auto& value) {
+          if (value.is_null()) {
+            if (null_rows) null_rows_by_chunk[chunk_id].emplace_back(chunk_id, value.chunk_offset());
+            return;
+          }
+
+          Hash hashed_value = hash_value<T, HashedType>(value.value(), partitioning_seed);
+          if (!secondary_hash_column_ids.empty()) hashed_value ^= secondary_hashes[value.chunk_offset()];
+
+          auto& buffer = buffers[(hashed_value >> radix_bits) % spill_files.size()];
+          write_spilled_value(buffer, RowID{chunk_id, value.chunk_offset()});
+          write_spilled_value(buffer, hashed_value);
+          write_spilled_value<T>(buffer, value.value());
+        });
+      });
+
+      for (auto spill_file_id = size_t{0}; spill_file_id < spill_files.size(); ++spill_file_id) {
+        if (!buffers[spill_file_id].empty()) spill_files[spill_file_id]->append(buffers[spill_file_id]);
+      }
+    }));
+    jobs.back()->set_preferred_node_id(in_table->get_chunk(chunk_id)->home_node_id());
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  if (null_rows) {
+    for (const auto& null_rows_of_chunk : null_rows_by_chunk) {
+      null_rows->insert(null_rows->end(), null_rows_of_chunk.begin(), null_rows_of_chunk.end());
+    }
+  }
+}
+
+/*
+Reads the values written to @param spill_file by spill_input(). As materialize_input(), it fills @param histograms for
+the radix partitioning, but with a single histogram, as the values of a spill file are not split by chunk.
+*/
+template <typename T>
+std::shared_ptr<Partition<T>> load_spilled_input(const SpillFile& spill_file,
+                                                 std::vector<std::shared_ptr<std::vector<size_t>>>& histograms,
+                                                 const size_t radix_bits) {
+  const size_t num_partitions = 1ull << radix_bits;
+  const size_t mask = num_partitions - 1;
+
+  auto elements = make_transient_partition<T>();
+  auto histogram = std::make_shared<std::vector<size_t>>(num_partitions);
+
+  const auto buffer = spill_file.read();
+  auto offset = size_t{0};
+  while (offset < buffer.size()) {
+    const auto row_id = read_spilled_value<RowID>(buffer, offset);
+    const auto hashed_value = read_spilled_value<Hash>(buffer, offset);
+    elements->emplace_back(row_id, hashed_value, read_spilled_value<T>(buffer, offset));
+    ++(*histogram)[hashed_value & mask];
+  }
+
+  histograms = {histogram};
+  return elements;
+}
+
+/*
+Bitmap of the rows of the build relation that found a match while probing. It is needed if rows of the build relation
+are part of the result depending on whether they found a match, i.e., for outer joins with the build relation as the
+outer relation, and for semi and anti joins that output the build relation. Rows are marked with an atomic fetch_or, so
+that the probe jobs can mark rows of the same word concurrently.
+*/
+class BuildRowBitmap {
+ public:
+  explicit BuildRowBitmap(const Table& build_table) {
+    _words_by_chunk.reserve(build_table.chunk_count());
+    for (ChunkID chunk_id{0}; chunk_id < build_table.chunk_count(); ++chunk_id) {
+      // Value-initialized, i.e., all bits are unset
+      _words_by_chunk.emplace_back((build_table.get_chunk(chunk_id)->size() + 63) / 64);
+    }
+  }
+
+  void mark(const RowID& row_id) {
+    _words_by_chunk[row_id.chunk_id][row_id.chunk_offset / 64].fetch_or(uint64_t{1} << (row_id.chunk_offset % 64),
+                                                                        std::memory_order_relaxed);
+  }
+
+  bool is_marked(const RowID& row_id) const {
+    const auto word = _words_by_chunk[row_id.chunk_id][row_id.chunk_offset / 64].load(std::memory_order_relaxed);
+    return word & (uint64_t{1} << (row_id.chunk_offset % 64));
+  }
+
+ protected:
+  std::vector<std::vector<std::atomic<uint64_t>>> _words_by_chunk;
+};
+
 /*
   In the probe phase we take all partitions from the right partition, iterate over them and compare each join candidate
   with the values in the hash table. Since Left and Right are hashed using the same hash function, we can reduce the
   number of hash tables that need to be looked into to just 1.
+
+  Probe rows without a match are padded with NULLs if @param emit_unmatched_probe_rows is set (i.e., if the probe
+  relation is the outer relation). If @param matched_build_rows is given, the matched build rows are marked in it.
   */
 template <typename RightType, typename HashedType>
 void probe(const RadixContainer<RightType>& radix_container,
            const std::vector<std::optional<HashTable<HashedType>>>& hashtables, std::vector<PosList>& pos_lists_left,
-           std::vector<PosList>& pos_lists_right, const JoinMode mode) {
+           std::vector<PosList>& pos_lists_right, const bool emit_unmatched_probe_rows,
+           const std::optional<MultiPredicateJoinEvaluator>& secondary_predicate_evaluator,
+           BuildRowBitmap* matched_build_rows = nullptr) {
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(radix_container.partition_offsets.size() - 1);
 
@@ -402,43 +602,45 @@ void probe(const RadixContainer<RightType>& radix_container,
         for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
           auto& row = partition[partition_offset];
 
-          if (mode == JoinMode::Inner && row.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
-            continue;
-          }
-
           const auto& rows_iter = hashtable.find(type_cast<HashedType>(row.value));
 
+          // Whether the key exists and, if there are secondary predicates, at least one row satisfies them
+          auto has_match = false;
+
           if (rows_iter != hashtable.end()) {
+            const auto emit_if_match = [&](const RowID& row_id) {
+              if (secondary_predicate_evaluator &&
+                  !secondary_predicate_evaluator->satisfies_all_predicates(row_id, row.row_id)) {
+                return;
+              }
+
+              pos_list_left_local.emplace_back(row_id);
+              pos_list_right_local.emplace_back(row.row_id);
+              has_match = true;
+
+              if (matched_build_rows) matched_build_rows->mark(row_id);
+            };
+
             // Key exists, thus we have at least one hit
             const auto& matching_rows_variant = rows_iter->second;
             if (matching_rows_variant.type() == typeid(PosList)) {
               // Multiple matches, stored in one PosList
               for (const auto row_id : boost::get<PosList>(matching_rows_variant)) {
-                if (row_id.chunk_offset != INVALID_CHUNK_OFFSET) {
-                  pos_list_left_local.emplace_back(row_id);
-                  pos_list_right_local.emplace_back(row.row_id);
-                }
+                emit_if_match(row_id);
               }
             } else {
               // A single RowID
-              const auto row_id = boost::get<RowID>(matching_rows_variant);
-              if (row_id.chunk_offset != INVALID_CHUNK_OFFSET) {
-                pos_list_left_local.emplace_back(row_id);
-                pos_list_right_local.emplace_back(row.row_id);
-              }
+              emit_if_match(boost::get<RowID>(matching_rows_variant));
             }
-            // We assume that the relations have been swapped previously,
-            // so that the outer relation is the probing relation.
-          } else if (mode == JoinMode::Left || mode == JoinMode::Right) {
+          }
+
+          if (!has_match && emit_unmatched_probe_rows) {
             pos_list_left_local.emplace_back(NULL_ROW_ID);
             pos_list_right_local.emplace_back(row.row_id);
           }
         }
-      } else if (mode == JoinMode::Left || mode == JoinMode::Right) {
+      } else if (emit_unmatched_probe_rows) {
         /*
-          We assume that the relations have been swapped previously,
-          so that the outer relation is the probing relation.
-
           Since we did not find a proper hash table,
           we know that there is no match in Left for this partition.
           Hence we are going to write NULL values for each row.
@@ -465,10 +667,17 @@ void probe(const RadixContainer<RightType>& radix_container,
   CurrentScheduler::wait_for_tasks(jobs);
 }
 
+/*
+  Semi and anti joins output the rows of the left input only. If the left input is the probe relation, the matching (or
+  non-matching) probe rows are written to @param pos_lists. If it is the build relation, @param matched_build_rows is
+  given instead and all build rows that match a probe row are marked in it.
+  */
 template <typename RightType, typename HashedType>
 void probe_semi_anti(const RadixContainer<RightType>& radix_container,
                      const std::vector<std::optional<HashTable<HashedType>>>& hashtables,
-                     std::vector<PosList>& pos_lists, const JoinMode mode) {
+                     std::vector<PosList>& pos_lists, const JoinMode mode,
+                     const std::optional<MultiPredicateJoinEvaluator>& secondary_predicate_evaluator,
+                     BuildRowBitmap* matched_build_rows = nullptr) {
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(radix_container.partition_offsets.size() - 1);
 
@@ -494,20 +703,45 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
         for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
           auto& row = partition[partition_offset];
 
-          if (row.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
-            continue;
-          }
-
           const auto& hashtable = hashtables[current_partition_id].value();
           const auto it = hashtable.find(type_cast<HashedType>(row.value));
 
-          if ((mode == JoinMode::Semi && it != hashtable.end()) || (mode == JoinMode::Anti && it == hashtable.end())) {
+          auto has_match = false;
+          if (it != hashtable.end()) {
+            // Returns true if no further candidates need to be checked, i.e., if only the existence of a match matters
+            const auto check_candidate = [&](const RowID& row_id) {
+              if (secondary_predicate_evaluator &&
+                  !secondary_predicate_evaluator->satisfies_all_predicates(row_id, row.row_id)) {
+                return false;
+              }
+
+              has_match = true;
+              if (!matched_build_rows) return true;
+
+              matched_build_rows->mark(row_id);
+              return false;
+            };
+
+            const auto& matching_rows_variant = it->second;
+            if (matching_rows_variant.type() == typeid(PosList)) {
+              const auto& matching_rows = boost::get<PosList>(matching_rows_variant);
+              for (const auto& row_id : matching_rows) {
+                if (check_candidate(row_id)) break;
+              }
+            } else {
+              check_candidate(boost::get<RowID>(matching_rows_variant));
+            }
+          }
+
+          if (matched_build_rows) continue;
+
+          if ((mode == JoinMode::Semi && has_match) || (mode == JoinMode::Anti && !has_match)) {
             // Semi: found at least one match for this row -> match
             // Anti: no matching rows found -> match
             pos_list_local.emplace_back(row.row_id);
           }
         }
-      } else if (mode == JoinMode::Anti) {
+      } else if (mode == JoinMode::Anti && !matched_build_rows) {
         // no hashtable on other side, but we are in Anti mode
         pos_list_local.reserve(partition_end - partition_begin);
         for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
@@ -616,14 +850,19 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
  public:
   JoinHashImpl(const std::shared_ptr<const AbstractOperator>& left,
                const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
-               const ColumnIDPair& column_ids, const PredicateCondition predicate_condition, const bool inputs_swapped,
-               const size_t radix_bits)
+               const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
+               const std::vector<OperatorJoinPredicate>& secondary_predicates, const bool inputs_swapped,
+               const size_t radix_bits, const std::optional<size_t>& memory_budget,
+               OperatorPerformanceData& performance_data)
       : _left(left),
         _right(right),
         _mode(mode),
         _column_ids(column_ids),
         _predicate_condition(predicate_condition),
-        _inputs_swapped(inputs_swapped) {
+        _secondary_predicates(secondary_predicates),
+        _inputs_swapped(inputs_swapped),
+        _memory_budget(memory_budget),
+        _performance_data(performance_data) {
     /*
       Setting number of bits for radix clustering:
       The number of bits is used to create probe partitions with a size that can
@@ -636,19 +875,8 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         - each entry in the hash map is a data structure holding the actual value
         and the RowID
     */
+    // JoinHash::_on_execute() has chosen the smaller relation as the build relation
     const auto build_relation_size = _left->get_output()->row_count();
-    const auto probe_relation_size = _right->get_output()->row_count();
-
-    if (build_relation_size > probe_relation_size) {
-      /*
-        Hash joins perform best for join relations with a small left join partner. In case the
-        optimizer selects the hash join due to such a situation, but neglects that the
-        input will be switched (e.g., due to the join type), the user will be warned.
-      */
-      std::string warning{"Left relation larger than right relation hash join"};
-      warning += inputs_swapped ? " (input relations have been swapped)." : ".";
-      PerformanceWarning(warning);
-    }
 
     const auto l2_cache_size = 256'000;  // bytes
 
@@ -672,7 +900,10 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   const JoinMode _mode;
   const ColumnIDPair _column_ids;
   const PredicateCondition _predicate_condition;
+  const std::vector<OperatorJoinPredicate> _secondary_predicates;
   const bool _inputs_swapped;
+  const std::optional<size_t> _memory_budget;
+  OperatorPerformanceData& _performance_data;
 
   std::shared_ptr<Table> _output_table;
 
@@ -691,14 +922,15 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     auto right_in_table = _right->get_output();
     auto left_in_table = _left->get_output();
 
-    if (_inputs_swapped) {
-      // Semi/Anti joins are always swapped but do not need the outer relation
-      if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
-        output_column_definitions = right_in_table->column_definitions();
-      } else {
-        output_column_definitions =
-            concatenated(right_in_table->column_definitions(), left_in_table->column_definitions());
-      }
+    const auto semi_or_anti = _mode == JoinMode::Semi || _mode == JoinMode::Anti;
+
+    if (semi_or_anti) {
+      // Semi/Anti joins only output the columns of the original left relation
+      output_column_definitions =
+          _inputs_swapped ? right_in_table->column_definitions() : left_in_table->column_definitions();
+    } else if (_inputs_swapped) {
+      output_column_definitions =
+          concatenated(right_in_table->column_definitions(), left_in_table->column_definitions());
     } else {
       output_column_definitions =
           concatenated(left_in_table->column_definitions(), right_in_table->column_definitions());
@@ -707,11 +939,24 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     _output_table = std::make_shared<Table>(output_column_definitions, TableType::References);
 
     /*
-     * This flag is used in the materialization and probing phases.
-     * When dealing with an OUTER join, we need to make sure that we keep the NULL values for the outer relation.
-     * In the current implementation, the relation on the right is always the outer relation.
-     */
-    auto keep_nulls = (_mode == JoinMode::Left || _mode == JoinMode::Right);
+    As the build relation is chosen by size, the outer relation of an outer join can be on either side. Unmatched rows
+    of the probe relation are NULL-padded while probing. Unmatched rows of the build relation are tracked in a bitmap
+    and NULL-padded after probing. The same bitmap is used for semi and anti joins if the left relation is the build
+    relation. Rows with a NULL join key never match. They are not partitioned, but collected separately where needed.
+    */
+    const auto probe_side_is_outer =
+        _mode == JoinMode::Outer || _mode == (_inputs_swapped ? JoinMode::Left : JoinMode::Right);
+    const auto build_side_is_outer =
+        _mode == JoinMode::Outer || _mode == (_inputs_swapped ? JoinMode::Right : JoinMode::Left);
+    const auto semi_or_anti_outputs_build_side = semi_or_anti && !_inputs_swapped;
+
+    auto matched_build_rows = std::optional<BuildRowBitmap>{};
+    if (build_side_is_outer || semi_or_anti_outputs_build_side) matched_build_rows.emplace(*left_in_table);
+
+    // For the build relation, only anti joins need the NULL rows (to exclude them). Unmatched build rows are found by
+    // scanning the bitmap, which includes the NULL rows.
+    auto left_null_rows = PosList{};
+    auto right_null_rows = PosList{};
 
     // Pre-partitioning
     // Save chunk offsets into the input relation
@@ -736,69 +981,210 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       offset_right += right_in_table->get_chunk(i)->size();
     }
 
-    Timer performance_timer;
-
-    // Materialization phase
-    std::vector<std::shared_ptr<std::vector<size_t>>> histograms_left;
-    std::vector<std::shared_ptr<std::vector<size_t>>> histograms_right;
     /*
-    NUMA notes:
-    The materialized vectors don't have any strong NUMA preference because they haven't been partitioned yet.
-    However, it would be a good idea to keep each materialized vector on one node if possible.
-    This helps choosing a scheduler node for the radix phase (see below).
+    Secondary equi predicates on columns of the same type are hashed into the radix partitions together with the join
+    column (i.e., the composite key is partitioned). All secondary predicates are evaluated when probing.
     */
-    // Scheduler note: parallelize this at some point. Currently, the amount of jobs would be too high
-    auto materialized_left = materialize_input<LeftType, HashedType>(left_in_table, _column_ids.first, histograms_left,
-                                                                     _radix_bits, _partitioning_seed);
-    // 'keep_nulls' makes sure that the relation on the right materializes NULL values when executing an OUTER join.
-    auto materialized_right = materialize_input<RightType, HashedType>(
-        right_in_table, _column_ids.second, histograms_right, _radix_bits, _partitioning_seed, keep_nulls);
-
-    // Radix Partitioning phase
-    /*
-    NUMA notes:
-    If the input vectors (the materialized vectors) reside on a specific node, the partitioning worker for
-    this phase should be scheduled on the same node.
-    Additionally, the output vectors in this phase are partitioned by a radix key. Therefore it would be good
-    to pin the outputs from both sides on the same node for each radix partition. For example, if there are
-    only two radix partitions A and B, the partitions leftA and rightA should be on the same node, and the
-    partitions leftB and leftB should also be on the same node.
-    */
-    // Scheduler note: parallelize this at some point. Currently, the amount of jobs would be too high
-    auto radix_left =
-        partition_radix_parallel<LeftType>(materialized_left, left_chunk_offsets, histograms_left, _radix_bits);
-    // 'keep_nulls' makes sure that the relation on the right keeps NULL values when executing an OUTER join.
-    auto radix_right = partition_radix_parallel<RightType>(materialized_right, right_chunk_offsets, histograms_right,
-                                                           _radix_bits, keep_nulls);
+    auto left_secondary_hash_column_ids = std::vector<ColumnID>{};
+    auto right_secondary_hash_column_ids = std::vector<ColumnID>{};
+    for (const auto& predicate : _secondary_predicates) {
+      if (predicate.predicate_condition != PredicateCondition::Equals) continue;
+      if (left_in_table->column_data_type(predicate.column_ids.first) !=
+          right_in_table->column_data_type(predicate.column_ids.second)) {
+        continue;
+      }
+
+      left_secondary_hash_column_ids.emplace_back(predicate.column_ids.first);
+      right_secondary_hash_column_ids.emplace_back(predicate.column_ids.second);
+    }
 
-    // Build phase
-    auto hashtables = build<LeftType, HashedType>(radix_left);
+    auto secondary_predicate_evaluator = std::optional<MultiPredicateJoinEvaluator>{};
+    if (!_secondary_predicates.empty()) {
+      secondary_predicate_evaluator.emplace(*left_in_table, *right_in_table, _secondary_predicates);
+    }
+
+    Timer performance_timer;
 
-    // Probe phase
+    const auto matched_build_rows_ptr = matched_build_rows ? &*matched_build_rows : nullptr;
+
+    // One PosList per radix partition plus one for the rows that are emitted after probing (see below)
     std::vector<PosList> left_pos_lists;
     std::vector<PosList> right_pos_lists;
-    const size_t partition_count = radix_right.partition_offsets.size() - 1;
-    left_pos_lists.resize(partition_count);
-    right_pos_lists.resize(partition_count);
-    for (size_t i = 0; i < partition_count; i++) {
-      // simple heuristic: half of the rows of the right relation will match
-      const size_t result_rows_per_partition = _right->get_output()->row_count() / partition_count / 2;
-
-      left_pos_lists[i].reserve(result_rows_per_partition);
-      right_pos_lists[i].reserve(result_rows_per_partition);
-    }
+
+    // Radix-partitions the materialized relations, builds the hash tables, and probes them. The PosLists of the radix
+    // partitions are appended to left_pos_lists and right_pos_lists.
+    const auto partition_build_and_probe =
+        [&](const std::shared_ptr<Partition<LeftType>>& materialized_left,
+            const std::shared_ptr<std::vector<size_t>>& left_chunk_offsets,
+            std::vector<std::shared_ptr<std::vector<size_t>>>& histograms_left,
+            const std::shared_ptr<Partition<RightType>>& materialized_right,
+            const std::shared_ptr<std::vector<size_t>>& right_chunk_offsets,
+            std::vector<std::shared_ptr<std::vector<size_t>>>& histograms_right, const size_t radix_bits) {
+          // Radix Partitioning phase
+          /*
+          NUMA notes:
+          If the input vectors (the materialized vectors) reside on a specific node, the partitioning worker for
+          this phase should be scheduled on the same node.
+          Additionally, the output vectors in this phase are partitioned by a radix key. Therefore it would be good
+          to pin the outputs from both sides on the same node for each radix partition. For example, if there are
+          only two radix partitions A and B, the partitions leftA and rightA should be on the same node, and the
+          partitions leftB and leftB should also be on the same node.
+          */
+          // Scheduler note: parallelize this at some point. Currently, the amount of jobs would be too high
+          auto radix_left =
+              partition_radix_parallel<LeftType>(materialized_left, left_chunk_offsets, histograms_left, radix_bits);
+          auto radix_right = partition_radix_parallel<RightType>(materialized_right, right_chunk_offsets,
+                                                                 histograms_right, radix_bits);
+
+          // Build phase
+          auto hashtables = build<LeftType, HashedType>(radix_left);
+
+          // Probe phase
+          const size_t partition_count = radix_right.partition_offsets.size() - 1;
+          auto partition_left_pos_lists = std::vector<PosList>(partition_count);
+          auto partition_right_pos_lists = std::vector<PosList>(partition_count);
+          for (size_t i = 0; i < partition_count; i++) {
+            // simple heuristic: half of the rows of the right relation will match
+            const size_t result_rows_per_partition = materialized_right->size() / partition_count / 2;
+
+            partition_left_pos_lists[i].reserve(result_rows_per_partition);
+            partition_right_pos_lists[i].reserve(result_rows_per_partition);
+          }
+          /*
+          NUMA notes:
+          The workers for each radix partition P should be scheduled on the same node as the input data:
+          leftP, rightP and hashtableP.
+          */
+          if (semi_or_anti) {
+            probe_semi_anti<RightType, HashedType>(radix_right, hashtables, partition_right_pos_lists, _mode,
+                                                   secondary_predicate_evaluator, matched_build_rows_ptr);
+          } else {
+            probe<RightType, HashedType>(radix_right, hashtables, partition_left_pos_lists, partition_right_pos_lists,
+                                         probe_side_is_outer, secondary_predicate_evaluator, matched_build_rows_ptr);
+          }
+
+          left_pos_lists.insert(left_pos_lists.end(), std::make_move_iterator(partition_left_pos_lists.begin()),
+                                std::make_move_iterator(partition_left_pos_lists.end()));
+          right_pos_lists.insert(right_pos_lists.end(), std::make_move_iterator(partition_right_pos_lists.begin()),
+                                 std::make_move_iterator(partition_right_pos_lists.end()));
+        };
+
+    const auto left_null_rows_ptr =
+        (semi_or_anti_outputs_build_side && _mode == JoinMode::Anti) ? &left_null_rows : nullptr;
+    const auto right_null_rows_ptr = probe_side_is_outer ? &right_null_rows : nullptr;
+
     /*
-    NUMA notes:
-    The workers for each radix partition P should be scheduled on the same node as the input data:
-    leftP, rightP and hashtableP.
+    If the estimated memory consumption exceeds the memory budget, the join is executed as a Grace hash join: both
+    relations are spilled into the same number of files (see spill_input()), and the pairs of files are joined one
+    after another. The estimate covers the materialized and the radix-partitioned copies of both relations and the hash
+    tables of the build relation. Strings are only accounted for with their fixed size.
     */
-    if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
-      probe_semi_anti<RightType, HashedType>(radix_right, hashtables, right_pos_lists, _mode);
+    auto spill_file_count = size_t{1};
+    if (_memory_budget) {
+      const auto estimated_memory_consumption = left_in_table->row_count() * 3 * sizeof(PartitionedElement<LeftType>) +
+                                                right_in_table->row_count() * 2 * sizeof(PartitionedElement<RightType>);
+      const auto memory_budget = std::max(*_memory_budget, size_t{1});
+      spill_file_count = std::min((estimated_memory_consumption + memory_budget - 1) / memory_budget,
+                                  MAX_SPILL_FILE_COUNT);
+    }
+
+    if (spill_file_count <= 1) {
+      // Materialization phase
+      std::vector<std::shared_ptr<std::vector<size_t>>> histograms_left;
+      std::vector<std::shared_ptr<std::vector<size_t>>> histograms_right;
+      /*
+      NUMA notes:
+      The materialized vectors don't have any strong NUMA preference because they haven't been partitioned yet.
+      However, it would be a good idea to keep each materialized vector on one node if possible.
+      This helps choosing a scheduler node for the radix phase (see below).
+      */
+      // Scheduler note: parallelize this at some point. Currently, the amount of jobs would be too high
+      auto materialized_left = materialize_input<LeftType, HashedType>(
+          left_in_table, _column_ids.first, histograms_left, _radix_bits, _partitioning_seed,
+          left_secondary_hash_column_ids, left_null_rows_ptr);
+      auto materialized_right = materialize_input<RightType, HashedType>(
+          right_in_table, _column_ids.second, histograms_right, _radix_bits, _partitioning_seed,
+          right_secondary_hash_column_ids, right_null_rows_ptr);
+
+      partition_build_and_probe(materialized_left, left_chunk_offsets, histograms_left, materialized_right,
+                                right_chunk_offsets, histograms_right, _radix_bits);
     } else {
-      probe<RightType, HashedType>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
+      auto left_spill_files = std::vector<std::unique_ptr<SpillFile>>(spill_file_count);
+      auto right_spill_files = std::vector<std::unique_ptr<SpillFile>>(spill_file_count);
+      for (auto spill_file_id = size_t{0}; spill_file_id < spill_file_count; ++spill_file_id) {
+        left_spill_files[spill_file_id] = std::make_unique<SpillFile>();
+        right_spill_files[spill_file_id] = std::make_unique<SpillFile>();
+      }
+
+      spill_input<LeftType, HashedType>(left_in_table, _column_ids.first, _radix_bits, _partitioning_seed,
+                                        left_secondary_hash_column_ids, left_spill_files, left_null_rows_ptr);
+      spill_input<RightType, HashedType>(right_in_table, _column_ids.second, _radix_bits, _partitioning_seed,
+                                         right_secondary_hash_column_ids, right_spill_files, right_null_rows_ptr);
+
+      // Each pair of spill files holds about 1/spill_file_count of the relations, so fewer radix bits suffice
+      const auto spill_file_bits = static_cast<size_t>(std::log2(spill_file_count));
+      const auto spilled_radix_bits = _radix_bits > spill_file_bits ? _radix_bits - spill_file_bits : size_t{0};
+      const auto spilled_chunk_offsets = std::make_shared<std::vector<size_t>>(1, 0);
+
+      for (auto spill_file_id = size_t{0}; spill_file_id < spill_file_count; ++spill_file_id) {
+        _performance_data.spilled_bytes += left_spill_files[spill_file_id]->size();
+        _performance_data.spilled_bytes += right_spill_files[spill_file_id]->size();
+
+        // The partitions of each pair of spill files are released before the next pair is loaded
+        const auto spill_memory_arena = std::make_shared<MemoryArena>();
+        const auto scoped_memory_arena = ScopedMemoryArena{spill_memory_arena};
+
+        std::vector<std::shared_ptr<std::vector<size_t>>> histograms_left;
+        std::vector<std::shared_ptr<std::vector<size_t>>> histograms_right;
+        auto materialized_left =
+            load_spilled_input<LeftType>(*left_spill_files[spill_file_id], histograms_left, spilled_radix_bits);
+        auto materialized_right =
+            load_spilled_input<RightType>(*right_spill_files[spill_file_id], histograms_right, spilled_radix_bits);
+
+        // Remove the spill files as soon as they have been read
+        left_spill_files[spill_file_id].reset();
+        right_spill_files[spill_file_id].reset();
+
+        partition_build_and_probe(materialized_left, spilled_chunk_offsets, histograms_left, materialized_right,
+                                  spilled_chunk_offsets, histograms_right, spilled_radix_bits);
+      }
     }
 
-    auto only_output_right_input = _inputs_swapped && (_mode == JoinMode::Semi || _mode == JoinMode::Anti);
+    left_pos_lists.emplace_back();
+    right_pos_lists.emplace_back();
+
+    // Emit the rows that do not result from probing: the unmatched (and NULL) rows of the outer relations as well as
+    // the output of semi/anti joins that output the build relation
+    auto& left_extra_rows = left_pos_lists.back();
+    auto& right_extra_rows = right_pos_lists.back();
+
+    for (const auto& row_id : right_null_rows) {
+      left_extra_rows.emplace_back(NULL_ROW_ID);
+      right_extra_rows.emplace_back(row_id);
+    }
+
+    if (matched_build_rows) {
+      // Anti joins do not output rows with a NULL join key (as for the probe relation), so they are marked as matched
+      for (const auto& row_id : left_null_rows) {
+        matched_build_rows->mark(row_id);
+      }
+
+      for (ChunkID chunk_id{0}; chunk_id < left_chunk_count; ++chunk_id) {
+        const auto chunk_size = left_in_table->get_chunk(chunk_id)->size();
+
+        for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          const auto row_id = RowID{chunk_id, chunk_offset};
+          const auto is_matched = matched_build_rows->is_marked(row_id);
+
+          if (_mode == JoinMode::Semi) {
+            if (is_matched) left_extra_rows.emplace_back(row_id);
+          } else if (!is_matched) {
+            left_extra_rows.emplace_back(row_id);
+            if (_mode != JoinMode::Anti) right_extra_rows.emplace_back(NULL_ROW_ID);
+          }
+        }
+      }
+    }
 
     /**
      * Two Caches to avoid redundant reference materialization for Reference input tables. As there might be
@@ -815,23 +1201,29 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     PosListsBySegment left_pos_lists_by_segment;
     PosListsBySegment right_pos_lists_by_segment;
 
+    // Semi/Anti joins output only one of the relations
+    const auto output_left = !semi_or_anti || !_inputs_swapped;
+    const auto output_right = !semi_or_anti || _inputs_swapped;
+
     // left_pos_lists_by_segment will only be needed if left is a reference table and being output
-    if (left_in_table->type() == TableType::References && !only_output_right_input) {
+    if (left_in_table->type() == TableType::References && output_left) {
       left_pos_lists_by_segment = setup_pos_lists_by_segment(left_in_table);
     }
 
-    // right_pos_lists_by_segment will only be needed if right is a reference table
-    if (right_in_table->type() == TableType::References) {
+    // right_pos_lists_by_segment will only be needed if right is a reference table and being output
+    if (right_in_table->type() == TableType::References && output_right) {
       right_pos_lists_by_segment = setup_pos_lists_by_segment(right_in_table);
     }
 
     for (size_t partition_id = 0; partition_id < left_pos_lists.size(); ++partition_id) {
+      CancellationToken::check_current();
+
       // moving the values into a shared pos list saves us some work in write_output_segments. We know that
       // left_pos_lists and right_pos_lists will not be used again.
       auto left = std::make_shared<PosList>(std::move(left_pos_lists[partition_id]));
       auto right = std::make_shared<PosList>(std::move(right_pos_lists[partition_id]));
 
-      if (left->empty() && right->empty()) {
+      if ((!output_left || left->empty()) && (!output_right || right->empty())) {
         continue;
       }
 
@@ -840,14 +1232,10 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       // we need to swap back the inputs, so that the order of the output columns is not harmed
       if (_inputs_swapped) {
         write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
-
-        // Semi/Anti joins are always swapped but do not need the outer relation
-        if (!only_output_right_input) {
-          write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left);
-        }
+        if (output_left) write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left);
       } else {
         write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left);
-        write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
+        if (output_right) write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
       }
 
       _output_table->append_chunk(output_segments);
@@ -14,7 +14,13 @@ namespace opossum {
 /**
  * This operator joins two tables using one column of each table.
  * The output is a new table with referenced columns for all columns of the two inputs and filtered pos_lists.
- * If you want to filter by multiple criteria, you can chain this operator.
+ * To join on multiple criteria (e.g., a composite key), pass them as secondary predicates. Secondary equi predicates
+ * are hashed into the radix partitions together with the join column, and all secondary predicates are evaluated
+ * while probing. This avoids materializing and scanning the (possibly much larger) result of the single-column join.
+ *
+ * The smaller input is used to build the hash tables, independent of the join mode. Thus, the outer relation of
+ * left/right/full outer joins and the output relation of semi/anti joins can be either the build or the probe side.
+ * Rows of the build side that need to be emitted depending on whether they found a match are tracked in a bitmap.
  *
  * As with most operators, we do not guarantee a stable operation with regards to positions -
  * i.e., your sorting order might be disturbed.
@@ -25,7 +31,7 @@ class JoinHash : public AbstractJoinOperator {
  public:
   JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
            const JoinMode mode, const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-           const size_t radix_bits = 9);
+           const std::vector<OperatorJoinPredicate>& secondary_predicates = {}, const size_t radix_bits = 9);
 
   const std::string name() const override;
 
@@ -3,12 +3,14 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "join_sort_merge/radix_cluster_sort.hpp"
+#include "multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
@@ -30,12 +32,14 @@ namespace opossum {
 *    /utils/radix_cluster_sort.hpp for more info on the clustering phase.
 * -> The join is performed per cluster. For the joining phase, runs of entries with the same value are identified
 *    and handled at once. If a join-match is identified, the corresponding row_ids are noted for the output.
+*    If there are secondary predicates, only the combinations of row_ids satisfying them are noted.
 * -> Using the join result, the output table is built using pos lists referencing the original tables.
 **/
 JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator>& left,
                              const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
-                             const ColumnIDPair& column_ids, const PredicateCondition op)
-    : AbstractJoinOperator(OperatorType::JoinSortMerge, left, right, mode, column_ids, op) {
+                             const ColumnIDPair& column_ids, const PredicateCondition op,
+                             const std::vector<OperatorJoinPredicate>& secondary_predicates)
+    : AbstractJoinOperator(OperatorType::JoinSortMerge, left, right, mode, column_ids, op, secondary_predicates) {
   // Validate the parameters
   DebugAssert(mode != JoinMode::Cross, "This operator does not support cross joins.");
   DebugAssert(left != nullptr, "The left input operator is null.");
@@ -46,13 +50,15 @@ JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator>& left
               "Unsupported predicate condition");
   DebugAssert(op != PredicateCondition::NotEquals || mode == JoinMode::Inner,
               "Outer joins are not implemented for not-equals joins.");
+  DebugAssert(secondary_predicates.empty() || op == PredicateCondition::Equals || mode == JoinMode::Inner,
+              "Outer joins with secondary predicates are only implemented for the equi-join case.");
 }
 
 std::shared_ptr<AbstractOperator> JoinSortMerge::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
   return std::make_shared<JoinSortMerge>(copied_input_left, copied_input_right, _mode, _column_ids,
-                                         _predicate_condition);
+                                         _predicate_condition, _secondary_predicates);
 }
 
 void JoinSortMerge::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -116,6 +122,9 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   std::vector<std::shared_ptr<PosList>> _output_pos_lists_left;
   std::vector<std::shared_ptr<PosList>> _output_pos_lists_right;
 
+  // Only set if the join has secondary predicates
+  std::optional<MultiPredicateJoinEvaluator> _secondary_predicate_evaluator;
+
   /**
    * The TablePosition is a utility struct that is used to define a specific position in a sorted input table.
   **/
@@ -257,6 +266,11 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   * I.e. the cross product of the ranges is emitted.
   **/
   void _emit_all_combinations(size_t output_cluster, TableRange left_range, TableRange right_range) {
+    if (_secondary_predicate_evaluator) {
+      _emit_qualified_combinations(output_cluster, left_range, right_range);
+      return;
+    }
+
     left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
       right_range.for_every_row_id(_sorted_right_table, [&](RowID right_row_id) {
         _emit_combination(output_cluster, left_row_id, right_row_id);
@@ -264,6 +278,39 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     });
   }
 
+  /**
+  * Emits the combinations of row ids from the left table range and the right table range that satisfy the secondary
+  * predicates. For outer joins, rows without such a combination are emitted with a NULL value on the other side.
+  **/
+  void _emit_qualified_combinations(size_t output_cluster, TableRange left_range, TableRange right_range) {
+    auto right_row_ids = PosList{};
+    right_range.for_every_row_id(_sorted_right_table,
+                                 [&](RowID right_row_id) { right_row_ids.push_back(right_row_id); });
+    auto right_row_ids_matched = std::vector<bool>(right_row_ids.size());
+
+    left_range.for_every_row_id(_sorted_left_table, [&](RowID left_row_id) {
+      auto left_row_id_matched = false;
+
+      for (size_t index = 0; index < right_row_ids.size(); ++index) {
+        if (!_secondary_predicate_evaluator->satisfies_all_predicates(left_row_id, right_row_ids[index])) continue;
+
+        _emit_combination(output_cluster, left_row_id, right_row_ids[index]);
+        left_row_id_matched = true;
+        right_row_ids_matched[index] = true;
+      }
+
+      if (!left_row_id_matched && (_mode == JoinMode::Left || _mode == JoinMode::Outer)) {
+        _emit_combination(output_cluster, left_row_id, NULL_ROW_ID);
+      }
+    });
+
+    if (_mode == JoinMode::Right || _mode == JoinMode::Outer) {
+      for (size_t index = 0; index < right_row_ids.size(); ++index) {
+        if (!right_row_ids_matched[index]) _emit_combination(output_cluster, NULL_ROW_ID, right_row_ids[index]);
+      }
+    }
+  }
+
   /**
   * Emits all combinations of row ids from the left table range and a NULL value on the right side to the join output.
   **/
@@ -658,6 +705,12 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     _end_of_left_table = _end_of_table(_sorted_left_table);
     _end_of_right_table = _end_of_table(_sorted_right_table);
 
+    if (!_sort_merge_join._secondary_predicates.empty()) {
+      _secondary_predicate_evaluator.emplace(*_sort_merge_join.input_table_left(),
+                                             *_sort_merge_join.input_table_right(),
+                                             _sort_merge_join._secondary_predicates);
+    }
+
     _perform_join();
 
     // merge the pos lists into single pos lists
@@ -11,6 +11,7 @@
 #include "storage/dictionary_segment.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
+#include "utils/memory_arena.hpp"
 
 namespace opossum {
 
@@ -24,7 +25,14 @@ struct MaterializedValue {
 };
 
 template <typename T>
-using MaterializedSegment = std::vector<MaterializedValue<T>>;
+using MaterializedSegment = pmr_vector<MaterializedValue<T>>;
+
+// Materialized segments only live while the join is executed, so they are allocated from the MemoryArena of the
+// operator
+template <typename T>
+PolymorphicAllocator<MaterializedValue<T>> transient_materialized_segment_allocator() {
+  return PolymorphicAllocator<MaterializedValue<T>>{MemoryArena::transient_resource()};
+}
 
 template <typename T>
 using MaterializedSegmentList = std::vector<std::shared_ptr<MaterializedSegment<T>>>;
@@ -82,7 +90,7 @@ class ColumnMaterializer {
   template <typename SegmentType>
   std::shared_ptr<MaterializedSegment<T>> _materialize_segment(const SegmentType& segment, ChunkID chunk_id,
                                                                std::unique_ptr<PosList>& null_rows_output) {
-    auto output = MaterializedSegment<T>{};
+    auto output = MaterializedSegment<T>{transient_materialized_segment_allocator<T>()};
     output.reserve(segment.size());
 
     auto iterable = create_iterable_from_segment<T>(segment);
@@ -111,7 +119,7 @@ class ColumnMaterializer {
    */
   std::shared_ptr<MaterializedSegment<T>> _materialize_segment(const DictionarySegment<T>& segment, ChunkID chunk_id,
                                                                std::unique_ptr<PosList>& null_rows_output) {
-    auto output = MaterializedSegment<T>{};
+    auto output = MaterializedSegment<T>{transient_materialized_segment_allocator<T>()};
     output.reserve(segment.size());
 
     auto base_attribute_vector = segment.attribute_vector();
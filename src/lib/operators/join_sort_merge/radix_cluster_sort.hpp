@@ -152,7 +152,7 @@ class RadixClusterSort {
   static std::unique_ptr<MaterializedSegmentList<T>> _concatenate_chunks(
       std::unique_ptr<MaterializedSegmentList<T>>& input_chunks) {
     auto output_table = std::make_unique<MaterializedSegmentList<T>>(1);
-    (*output_table)[0] = std::make_shared<MaterializedSegment<T>>();
+    (*output_table)[0] = std::make_shared<MaterializedSegment<T>>(transient_materialized_segment_allocator<T>());
 
     // Reserve the required space and move the data to the output
     auto output_chunk = (*output_table)[0];
@@ -209,7 +209,8 @@ class RadixClusterSort {
     // Reserve the appropriate output space for the clusters
     for (size_t cluster_id = 0; cluster_id < _cluster_count; ++cluster_id) {
       auto cluster_size = table_information.cluster_histogram[cluster_id];
-      (*output_table)[cluster_id] = std::make_shared<MaterializedSegment<T>>(cluster_size);
+      (*output_table)[cluster_id] =
+          std::make_shared<MaterializedSegment<T>>(cluster_size, transient_materialized_segment_allocator<T>());
     }
 
     // Move each entry into its appropriate cluster in parallel
@@ -0,0 +1,114 @@
+#include "multi_predicate_join_evaluator.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/table.hpp"
+#include "type_comparison.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+MultiPredicateJoinEvaluator::ColumnAccessor<T>::ColumnAccessor(const Table& table, const ColumnID column_id) {
+  const auto add_segment_accessors = [&](const Table& data_table, const ColumnID data_column_id) {
+    auto& segment_accessors = _segment_accessors.emplace_back();
+    segment_accessors.reserve(data_table.chunk_count());
+    for (ChunkID chunk_id{0}; chunk_id < data_table.chunk_count(); ++chunk_id) {
+      segment_accessors.emplace_back(
+          create_segment_accessor<T>(data_table.get_chunk(chunk_id)->get_segment(data_column_id)));
+    }
+  };
+
+  if (table.type() == TableType::Data) {
+    add_segment_accessors(table, column_id);
+    return;
+  }
+
+  // Usually, all ReferenceSegments of a column reference the same column, so the accessors are created only once for
+  // each referenced column
+  auto referenced_columns = std::vector<std::pair<std::shared_ptr<const Table>, ColumnID>>{};
+
+  _pos_lists.reserve(table.chunk_count());
+  _referenced_column_indices.reserve(table.chunk_count());
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto reference_segment =
+        std::static_pointer_cast<const ReferenceSegment>(table.get_chunk(chunk_id)->get_segment(column_id));
+    _pos_lists.emplace_back(reference_segment->pos_list());
+
+    const auto referenced_column =
+        std::make_pair(reference_segment->referenced_table(), reference_segment->referenced_column_id());
+    const auto referenced_column_iter =
+        std::find(referenced_columns.cbegin(), referenced_columns.cend(), referenced_column);
+    _referenced_column_indices.emplace_back(std::distance(referenced_columns.cbegin(), referenced_column_iter));
+
+    if (referenced_column_iter == referenced_columns.cend()) {
+      referenced_columns.emplace_back(referenced_column);
+      add_segment_accessors(*referenced_column.first, referenced_column.second);
+    }
+  }
+}
+
+template <typename T>
+std::optional<T> MultiPredicateJoinEvaluator::ColumnAccessor<T>::access(RowID row_id) const {
+  if (row_id.is_null()) return std::nullopt;
+
+  auto referenced_column_index = size_t{0};
+  if (!_pos_lists.empty()) {
+    referenced_column_index = _referenced_column_indices[row_id.chunk_id];
+    row_id = (*_pos_lists[row_id.chunk_id])[row_id.chunk_offset];
+    if (row_id.is_null()) return std::nullopt;
+  }
+
+  return _segment_accessors[referenced_column_index][row_id.chunk_id]->access(row_id.chunk_offset);
+}
+
+MultiPredicateJoinEvaluator::MultiPredicateJoinEvaluator(const Table& left, const Table& right,
+                                                         const std::vector<OperatorJoinPredicate>& predicates) {
+  _comparators.reserve(predicates.size());
+
+  for (const auto& predicate : predicates) {
+    const auto left_data_type = left.column_data_type(predicate.column_ids.first);
+    const auto right_data_type = right.column_data_type(predicate.column_ids.second);
+
+    resolve_data_type(left_data_type, [&](auto left_type) {
+      resolve_data_type(right_data_type, [&](auto right_type) {
+        using LeftType = typename decltype(left_type)::type;
+        using RightType = typename decltype(right_type)::type;
+
+        // make sure that we do not compile invalid versions of the comparators
+        constexpr auto LEFT_IS_STRING_COLUMN = (std::is_same<LeftType, std::string>{});
+        constexpr auto RIGHT_IS_STRING_COLUMN = (std::is_same<RightType, std::string>{});
+
+        // clang-format off
+        if constexpr (LEFT_IS_STRING_COLUMN == RIGHT_IS_STRING_COLUMN) {
+          with_comparator(predicate.predicate_condition, [&](auto comparator) {
+            using Comparator = decltype(comparator);
+            _comparators.emplace_back(std::make_unique<FieldComparator<LeftType, RightType, Comparator>>(
+                left, right, predicate.column_ids, comparator));
+          });
+        } else {
+          Fail("Cannot compare string and non-string columns in a join predicate");
+        }
+        // clang-format on
+      });
+    });
+  }
+}
+
+bool MultiPredicateJoinEvaluator::satisfies_all_predicates(const RowID& left_row_id,
+                                                           const RowID& right_row_id) const {
+  for (const auto& comparator : _comparators) {
+    if (!comparator->compare(left_row_id, right_row_id)) return false;
+  }
+  return true;
+}
+
+}  // namespace opossum
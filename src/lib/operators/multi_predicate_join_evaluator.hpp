@@ -0,0 +1,82 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "operators/operator_join_predicate.hpp"
+#include "storage/base_segment_accessor.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Evaluates the secondary predicates of a join (see AbstractJoinOperator::secondary_predicates) for pairs of rows that
+ * fulfill the primary predicate. This way, joins on composite keys (e.g., `a1 = b1 AND a2 = b2`) or with additional
+ * non-equi predicates do not need to materialize the result of the primary predicate and scan it afterwards.
+ *
+ * The RowIDs passed to satisfies_all_predicates() are positions in the input tables, also if these are reference
+ * tables. Rows with a NULL value in a column of a secondary predicate do not satisfy that predicate.
+ */
+class MultiPredicateJoinEvaluator {
+ public:
+  MultiPredicateJoinEvaluator(const Table& left, const Table& right,
+                              const std::vector<OperatorJoinPredicate>& predicates);
+
+  bool satisfies_all_predicates(const RowID& left_row_id, const RowID& right_row_id) const;
+
+ protected:
+  // Accesses the values of one column of an input table by the RowIDs of that table. For reference tables, the RowIDs
+  // are resolved to the referenced tables, so that the values are accessed without the indirection of
+  // ReferenceSegments. The chunks of a reference table may reference different tables.
+  template <typename T>
+  class ColumnAccessor {
+   public:
+    ColumnAccessor(const Table& table, const ColumnID column_id);
+
+    std::optional<T> access(RowID row_id) const;
+
+   protected:
+    std::vector<std::shared_ptr<const PosList>> _pos_lists;
+
+    // For reference tables, the index of the referenced column in _segment_accessors for each chunk
+    std::vector<size_t> _referenced_column_indices;
+
+    // One segment accessor per chunk for each (referenced) column
+    std::vector<std::vector<std::unique_ptr<BaseSegmentAccessor<T>>>> _segment_accessors;
+  };
+
+  class BaseFieldComparator {
+   public:
+    virtual ~BaseFieldComparator() = default;
+    virtual bool compare(const RowID& left_row_id, const RowID& right_row_id) const = 0;
+  };
+
+  template <typename L, typename R, typename Comparator>
+  class FieldComparator : public BaseFieldComparator {
+   public:
+    FieldComparator(const Table& left, const Table& right, const ColumnIDPair& column_ids, const Comparator& comparator)
+        : _left_accessor(left, column_ids.first), _right_accessor(right, column_ids.second), _comparator(comparator) {}
+
+    bool compare(const RowID& left_row_id, const RowID& right_row_id) const override {
+      const auto left_value = _left_accessor.access(left_row_id);
+      if (!left_value) return false;
+
+      const auto right_value = _right_accessor.access(right_row_id);
+      if (!right_value) return false;
+
+      return _comparator(*left_value, *right_value);
+    }
+
+   protected:
+    const ColumnAccessor<L> _left_accessor;
+    const ColumnAccessor<R> _right_accessor;
+    const Comparator _comparator;
+  };
+
+  std::vector<std::unique_ptr<BaseFieldComparator>> _comparators;
+};
+
+}  // namespace opossum
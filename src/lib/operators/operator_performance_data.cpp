@@ -2,12 +2,16 @@
 
 #include <string>
 
+#include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
 
 namespace opossum {
 
 std::string OperatorPerformanceData::to_string(DescriptionMode description_mode) const {
-  return format_duration(std::chrono::duration_cast<std::chrono::nanoseconds>(walltime));
+  auto string = format_duration(std::chrono::duration_cast<std::chrono::nanoseconds>(walltime));
+  if (peak_allocated_bytes > 0) string += ", peak memory " + format_bytes(peak_allocated_bytes);
+  if (spilled_bytes > 0) string += ", spilled " + format_bytes(spilled_bytes);
+  return string;
 }
 
 }  // namespace opossum
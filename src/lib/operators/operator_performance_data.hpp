@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
@@ -14,6 +15,17 @@ struct OperatorPerformanceData : public Noncopyable {
 
   std::chrono::microseconds walltime{0};
 
+  // Number of rows in the output table. Kept here since the output itself might be cleared before it can be inspected.
+  std::optional<uint64_t> output_row_count;
+
+  // Number of bytes written to temporary files by operators that exceeded their memory budget
+  uint64_t spilled_bytes{0};
+
+  // Maximum number of bytes allocated at the same time during the execution (see MemoryTracker), and the number of
+  // bytes that were still allocated afterwards, i.e., mostly the output of the operator
+  uint64_t peak_allocated_bytes{0};
+  uint64_t allocated_bytes{0};
+
   virtual std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const;
 };
 
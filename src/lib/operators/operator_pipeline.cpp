@@ -0,0 +1,237 @@
+#include "operator_pipeline.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace opossum {
+
+OperatorPipeline::OperatorPipeline(const std::vector<std::shared_ptr<AbstractOperator>>& operators)
+    : _operators(operators) {
+  Assert(!_operators.empty(), "OperatorPipeline needs at least one operator");
+  for (auto operator_idx = size_t{0}; operator_idx < _operators.size(); ++operator_idx) {
+    const auto& op = _operators[operator_idx];
+    Assert(!op->is_pipeline_breaker(), "Pipeline breakers cannot be part of an OperatorPipeline");
+    Assert(op->input_left() && !op->input_right(), "Operators of an OperatorPipeline need exactly one input");
+    Assert(operator_idx == 0 || op->input_left() == _operators[operator_idx - 1],
+           "Operators of an OperatorPipeline need to form a chain");
+  }
+}
+
+const std::vector<std::shared_ptr<AbstractOperator>>& OperatorPipeline::operators() const { return _operators; }
+
+void OperatorPipeline::execute() {
+  const auto& last_operator = _operators.back();
+  DebugAssert(!last_operator->_output, "OperatorPipeline has already been executed");
+
+  const auto input_table = _operators.front()->input_table_left();
+  DebugAssert(input_table, "Input of the OperatorPipeline has not yet been executed");
+
+  // There is nothing to gain from pipelining a single chunk
+  if (input_table->chunk_count() <= ChunkID{1}) {
+    for (const auto& op : _operators) {
+      op->execute();
+    }
+    for (auto operator_idx = size_t{0}; operator_idx + 1 < _operators.size(); ++operator_idx) {
+      _operators[operator_idx]->clear_output();
+    }
+    return;
+  }
+
+  Timer performance_timer;
+
+  // Do not execute operators if the transaction has been aborted (see AbstractOperator::execute)
+  const auto transaction_context = last_operator->transaction_context();
+  if (transaction_context && transaction_context->aborted()) return;
+
+  auto chunk_outputs = std::vector<std::shared_ptr<const Table>>(input_table->chunk_count());
+
+  // With a row budget of the last operator, chunks are only processed until the outputs have enough rows. The first
+  // chunk is always processed, as its output defines the columns of the pipeline's output.
+  const auto& row_budget = last_operator->_row_budget;
+  auto output_row_count = std::atomic<size_t>{0};
+  const auto budget_exhausted = [&]() { return row_budget && output_row_count >= *row_budget; };
+
+  // Chains of operator copies that are not used by a JobTask at the moment
+  auto idle_chains = std::vector<ChunkOperatorChain>{};
+  auto idle_chains_mutex = std::mutex{};
+
+  auto operator_row_counts = std::vector<std::atomic<uint64_t>>(_operators.size());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(input_table->chunk_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    if (chunk_id != ChunkID{0} && budget_exhausted()) break;
+
+    auto job_task = std::make_shared<JobTask>([&, chunk_id]() {
+      if (chunk_id != ChunkID{0} && budget_exhausted()) return;
+
+      auto chain = std::optional<ChunkOperatorChain>{};
+      {
+        std::lock_guard<std::mutex> lock(idle_chains_mutex);
+        if (!idle_chains.empty()) {
+          chain = std::move(idle_chains.back());
+          idle_chains.pop_back();
+        }
+      }
+      if (!chain) chain = _make_chunk_operator_chain(input_table, transaction_context);
+
+      const auto chunk_output = _execute_chunk(input_table, chunk_id, *chain, operator_row_counts);
+      if (chunk_output) output_row_count += chunk_output->row_count();
+      chunk_outputs[chunk_id] = chunk_output;
+
+      std::lock_guard<std::mutex> lock(idle_chains_mutex);
+      idle_chains.emplace_back(std::move(*chain));
+    });
+
+    job_task->set_preferred_node_id(input_table->get_chunk(chunk_id)->home_node_id());
+
+    jobs.push_back(job_task);
+    job_task->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // The operators of a chunk are not executed if the transaction was aborted in the meantime
+  if (transaction_context && transaction_context->aborted()) return;
+
+  const auto& first_chunk_output = chunk_outputs.front();
+  auto output = std::make_shared<Table>(first_chunk_output->column_definitions(), first_chunk_output->type(),
+                                        first_chunk_output->max_chunk_size());
+
+  for (const auto& chunk_output : chunk_outputs) {
+    // Skipped because of the row budget
+    if (!chunk_output) continue;
+
+    for (ChunkID chunk_id{0}; chunk_id < chunk_output->chunk_count(); ++chunk_id) {
+      const auto chunk = chunk_output->get_chunk(chunk_id);
+      output->append_chunk(chunk->segments(), chunk->get_allocator(), chunk->access_counter());
+
+      // Keep the MVCC data forwarded by the operators, as Projection does
+      output->get_chunk(ChunkID{output->chunk_count() - 1})->set_mvcc_data(chunk->mvcc_data());
+    }
+  }
+
+  last_operator->_output = output;
+
+  last_operator->_performance_data->walltime = performance_timer.lap();
+  last_operator->_performance_data->output_row_count = output->row_count();
+
+  // If the row budget stopped the pipeline early, the inner operators did not see all rows (see
+  // CardinalityFeedbackStore::record_executed_plan)
+  const auto all_chunks_processed = std::all_of(chunk_outputs.cbegin(), chunk_outputs.cend(),
+                                                [](const auto& chunk_output) { return chunk_output != nullptr; });
+  if (!all_chunks_processed) return;
+
+  for (auto operator_idx = size_t{0}; operator_idx + 1 < _operators.size(); ++operator_idx) {
+    _operators[operator_idx]->_performance_data->output_row_count = operator_row_counts[operator_idx].load();
+  }
+}
+
+OperatorPipeline::ChunkOperatorChain OperatorPipeline::_make_chunk_operator_chain(
+    const std::shared_ptr<const Table>& input_table,
+    const std::shared_ptr<TransactionContext>& transaction_context) const {
+  // The input is never executed, _execute_chunk() sets its output to the chunk that is processed
+  auto chain = ChunkOperatorChain{std::make_shared<TableWrapper>(input_table), {}};
+  chain.operators.reserve(_operators.size());
+
+  auto previous_operator = chain.input;
+  for (const auto& op : _operators) {
+    auto chunk_operator = op->_on_deep_copy(previous_operator, nullptr);
+    if (transaction_context) chunk_operator->set_transaction_context(transaction_context);
+
+    chain.operators.emplace_back(chunk_operator);
+    previous_operator = chunk_operator;
+  }
+
+  return chain;
+}
+
+std::shared_ptr<const Table> OperatorPipeline::_execute_chunk(
+    const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id, const ChunkOperatorChain& chain,
+    std::vector<std::atomic<uint64_t>>& operator_row_counts) const {
+  // The chunk is shared with the input table, so that it is neither copied nor needs new MVCC data
+  const auto chunk = std::const_pointer_cast<Chunk>(input_table->get_chunk(chunk_id));
+  const auto chunk_table =
+      std::make_shared<Table>(input_table->column_definitions(), input_table->type(), input_table->max_chunk_size(),
+                              chunk->has_mvcc_data() ? UseMvcc::Yes : UseMvcc::No);
+  chunk_table->append_chunk(chunk);
+
+  chain.input->_output = chunk_table;
+
+  for (auto operator_idx = size_t{0}; operator_idx < chain.operators.size(); ++operator_idx) {
+    const auto& chunk_operator = chain.operators[operator_idx];
+    chunk_operator->execute();
+
+    // The intermediate result is consumed, ReferenceSegments keep the tables they reference alive
+    chunk_operator->mutable_input_left()->clear_output();
+
+    if (!chunk_operator->get_output()) return nullptr;
+    operator_row_counts[operator_idx] += chunk_operator->get_output()->row_count();
+  }
+
+  // Leave the chain ready for the next chunk
+  const auto chunk_output = chain.operators.back()->get_output();
+  chain.operators.back()->clear_output();
+
+  if (chunk_output->type() == TableType::Data) return chunk_output;
+
+  // Redirect the references into the chunk table to the input table. As in TableScan, position lists are shared
+  // between segments if they were shared before.
+  auto output = std::make_shared<Table>(chunk_output->column_definitions(), TableType::References,
+                                        chunk_output->max_chunk_size());
+
+  for (ChunkID output_chunk_id{0}; output_chunk_id < chunk_output->chunk_count(); ++output_chunk_id) {
+    const auto output_chunk = chunk_output->get_chunk(output_chunk_id);
+
+    auto redirected_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<const PosList>>{};
+    auto segments = Segments{};
+    segments.reserve(output_chunk->column_count());
+
+    for (ColumnID column_id{0}; column_id < output_chunk->column_count(); ++column_id) {
+      const auto segment = output_chunk->get_segment(column_id);
+      const auto reference_segment = std::static_pointer_cast<const ReferenceSegment>(segment);
+      if (reference_segment->referenced_table() != chunk_table) {
+        segments.push_back(segment);
+        continue;
+      }
+
+      auto& redirected_pos_list = redirected_pos_lists[reference_segment->pos_list()];
+      if (!redirected_pos_list) {
+        auto pos_list = std::make_shared<PosList>(*reference_segment->pos_list());
+        for (auto& row_id : *pos_list) {
+          if (!row_id.is_null()) row_id.chunk_id = chunk_id;
+        }
+        redirected_pos_list = pos_list;
+      }
+
+      const auto referenced_column_id = reference_segment->referenced_column_id();
+      segments.push_back(std::make_shared<ReferenceSegment>(input_table, referenced_column_id, redirected_pos_list));
+    }
+
+    output->append_chunk(segments, output_chunk->get_allocator(), output_chunk->access_counter());
+    output->get_chunk(output_chunk_id)->set_mvcc_data(output_chunk->mvcc_data());
+  }
+
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+class TransactionContext;
+
+/**
+ * Executes a chain of operators that are no pipeline breakers (see AbstractOperator::is_pipeline_breaker) chunk by
+ * chunk instead of operator by operator.
+ *
+ * For each chunk of the input of the chain, one JobTask pushes the chunk through copies of all operators of the chain.
+ * The copies are reused for the following chunks, so that only as many copies exist as JobTasks run concurrently.
+ * Thus, each operator consumes the intermediate result of its predecessor while it is still hot in the cache, and only
+ * the output of the last operator is materialized for the whole table. The JobTasks are scheduled on the home node of
+ * their chunk. Afterwards, the per-chunk results are combined (in the order of the input chunks) into the output of
+ * the last operator, which can then be consumed like the output of any other operator.
+ *
+ * Pipelines end at pipeline breakers, i.e., operators that need their complete input (e.g., Sort, Aggregate, or the
+ * build side of a join) and all operators with two inputs. The operators inside the pipeline do not get an output, but
+ * their performance data holds the number of rows they emitted for all chunks together.
+ *
+ * If the last operator has a row budget (see AbstractOperator::set_row_budget), no further chunks are processed once
+ * the outputs of the processed chunks have enough rows. The operators inside the pipeline then get no output row count,
+ * as they did not see all of their input.
+ */
+class OperatorPipeline final {
+ public:
+  // @param operators   the chain from bottom to top, the left (and only) input of each operator is its predecessor
+  explicit OperatorPipeline(const std::vector<std::shared_ptr<AbstractOperator>>& operators);
+
+  const std::vector<std::shared_ptr<AbstractOperator>>& operators() const;
+
+  // Executes the chain and sets the output of its last operator. The input of the first operator must have been
+  // executed before.
+  void execute();
+
+ protected:
+  // Copies of the operators, with an input operator whose output is set to the chunk that is processed
+  struct ChunkOperatorChain {
+    std::shared_ptr<AbstractOperator> input;
+    std::vector<std::shared_ptr<AbstractOperator>> operators;
+  };
+
+  ChunkOperatorChain _make_chunk_operator_chain(const std::shared_ptr<const Table>& input_table,
+                                                const std::shared_ptr<TransactionContext>& transaction_context) const;
+
+  // Executes the @param chain on a table holding only the chunk @param chunk_id of the @param input_table and adds the
+  // output row counts of its operators to @param operator_row_counts. References into that table are redirected to
+  // the input table.
+  std::shared_ptr<const Table> _execute_chunk(const std::shared_ptr<const Table>& input_table, ChunkID chunk_id,
+                                              const ChunkOperatorChain& chain,
+                                              std::vector<std::atomic<uint64_t>>& operator_row_counts) const;
+
+  const std::vector<std::shared_ptr<AbstractOperator>> _operators;
+};
+
+}  // namespace opossum
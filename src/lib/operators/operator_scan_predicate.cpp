@@ -3,6 +3,8 @@
 #include "constant_mappings.hpp"
 #include "expression/abstract_predicate_expression.hpp"
 #include "expression/expression_functional.hpp"
+#include "expression/in_expression.hpp"
+#include "expression/list_expression.hpp"
 #include "expression/parameter_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
@@ -46,7 +48,19 @@ std::string OperatorScanPredicate::to_string(const std::shared_ptr<const Table>&
   }
 
   std::stringstream stream;
-  stream << column_name_left << " " << predicate_condition_to_string.left.at(predicate_condition) << " " << right;
+  stream << column_name_left << " " << predicate_condition_to_string.left.at(predicate_condition) << " ";
+
+  if (predicate_condition == PredicateCondition::In) {
+    stream << "(";
+    for (auto value_idx = size_t{0}; value_idx < value_list.size(); ++value_idx) {
+      stream << (value_idx > 0 ? ", " : "") << value_list[value_idx];
+    }
+    stream << ")";
+  } else {
+    stream << right;
+    if (value2) stream << " AND " << opossum::to_string(*value2);
+  }
+
   return stream.str();
 }
 
@@ -102,8 +116,62 @@ std::optional<std::vector<OperatorScanPredicate>> OperatorScanPredicate::from_ex
       OperatorScanPredicate{boost::get<ColumnID>(*argument_a), predicate_condition, *argument_b}};
 }
 
+std::optional<OperatorScanPredicate> OperatorScanPredicate::single_pass_from_expression(
+    const AbstractExpression& expression, const AbstractLQPNode& node) {
+  const auto* predicate = dynamic_cast<const AbstractPredicateExpression*>(&expression);
+  if (!predicate) return std::nullopt;
+
+  if (predicate->predicate_condition == PredicateCondition::Between) {
+    Assert(predicate->arguments.size() == 3, "Expect ternary PredicateExpression to have three arguments");
+
+    const auto column_id = node.find_column_id(*predicate->arguments[0]);
+    if (!column_id) return std::nullopt;
+
+    // Bounds that are columns require a comparison per row and are handled by two ColumnComparison scans
+    const auto lower_bound = resolve_all_parameter_variant(*predicate->arguments[1], node);
+    const auto upper_bound = resolve_all_parameter_variant(*predicate->arguments[2], node);
+    if (!lower_bound || !upper_bound || is_column_id(*lower_bound) || is_column_id(*upper_bound)) return std::nullopt;
+
+    return OperatorScanPredicate{*column_id, PredicateCondition::Between, *lower_bound, *upper_bound};
+  }
+
+  if (predicate->predicate_condition == PredicateCondition::In) {
+    const auto& in_expression = static_cast<const InExpression&>(*predicate);
+
+    const auto column_id = node.find_column_id(*in_expression.value());
+    if (!column_id) return std::nullopt;
+
+    const auto list_expression = std::dynamic_pointer_cast<ListExpression>(in_expression.set());
+    if (!list_expression) return std::nullopt;
+
+    // Values of other data types would have to be compared with the semantics of the ExpressionEvaluator (e.g., an int
+    // column is never IN (1.5)), and NULLs turn non-matches into NULL. Both are left to the ExpressionEvaluator.
+    const auto data_type = in_expression.value()->data_type();
+
+    auto value_list = std::vector<AllTypeVariant>{};
+    value_list.reserve(list_expression->elements().size());
+
+    for (const auto& element : list_expression->elements()) {
+      const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(element);
+      if (!value_expression || variant_is_null(value_expression->value) || value_expression->data_type() != data_type) {
+        return std::nullopt;
+      }
+      value_list.emplace_back(value_expression->value);
+    }
+
+    return OperatorScanPredicate{*column_id, PredicateCondition::In, value_list};
+  }
+
+  return std::nullopt;
+}
+
+OperatorScanPredicate::OperatorScanPredicate(const ColumnID column_id, const PredicateCondition predicate_condition,
+                                             const AllParameterVariant& value,
+                                             const std::optional<AllParameterVariant>& value2)
+    : column_id(column_id), predicate_condition(predicate_condition), value(value), value2(value2) {}
+
 OperatorScanPredicate::OperatorScanPredicate(const ColumnID column_id, const PredicateCondition predicate_condition,
-                                             const AllParameterVariant& value)
-    : column_id(column_id), predicate_condition(predicate_condition), value(value) {}
+                                             const std::vector<AllTypeVariant>& value_list)
+    : column_id(column_id), predicate_condition(predicate_condition), value_list(value_list) {}
 
 }  // namespace opossum
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <optional>
+#include <string>
+#include <vector>
 
 #include "all_parameter_variant.hpp"
 #include "all_type_variant.hpp"
@@ -24,9 +26,23 @@ struct OperatorScanPredicate {
   static std::optional<std::vector<OperatorScanPredicate>> from_expression(const AbstractExpression& expression,
                                                                            const AbstractLQPNode& node);
 
+  /**
+   * Try to build a single OperatorScanPredicate that the TableScan evaluates in one pass over the column, i.e.,
+   *    - `<column> BETWEEN <value/placeholder> AND <value/placeholder>` and
+   *    - `<column> IN (<value>, <value>, ...)` with non-NULL values of the column's data type.
+   * On dictionary segments, these are evaluated on the value IDs.
+   *
+   * @return std::nullopt for all other expressions. Use from_expression() for them.
+   */
+  static std::optional<OperatorScanPredicate> single_pass_from_expression(const AbstractExpression& expression,
+                                                                           const AbstractLQPNode& node);
+
   OperatorScanPredicate() = default;
   OperatorScanPredicate(const ColumnID column_id, const PredicateCondition predicate_condition,
-                        const AllParameterVariant& value = NullValue{});
+                        const AllParameterVariant& value = NullValue{},
+                        const std::optional<AllParameterVariant>& value2 = std::nullopt);
+  OperatorScanPredicate(const ColumnID column_id, const PredicateCondition predicate_condition,
+                        const std::vector<AllTypeVariant>& value_list);
 
   // Returns a string representation of the predicate, using an optionally given table that is used to resolve column
   // ids to names.
@@ -35,6 +51,12 @@ struct OperatorScanPredicate {
   ColumnID column_id{INVALID_COLUMN_ID};
   PredicateCondition predicate_condition{PredicateCondition::Equals};
   AllParameterVariant value;
+
+  // The upper bound of BETWEEN
+  std::optional<AllParameterVariant> value2;
+
+  // The values of IN
+  std::vector<AllTypeVariant> value_list;
 };
 
 }  // namespace opossum
@@ -4,6 +4,7 @@
 #include <functional>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -12,8 +13,42 @@
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Whether the expression has the same value for all rows and can be evaluated without a table
+bool is_constant(const AbstractExpression& expression) {
+  switch (expression.type) {
+    case ExpressionType::Value:
+    case ExpressionType::Parameter:
+      return true;
+
+    case ExpressionType::Arithmetic:
+    case ExpressionType::Cast:
+    case ExpressionType::Case:
+    case ExpressionType::Extract:
+    case ExpressionType::Function:
+    case ExpressionType::Logical:
+    case ExpressionType::Predicate:
+    case ExpressionType::UnaryMinus:
+      return std::all_of(expression.arguments.begin(), expression.arguments.end(),
+                         [&](const auto& argument) { return is_constant(*argument); });
+
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
 Projection::Projection(const std::shared_ptr<const AbstractOperator>& in,
@@ -22,6 +57,20 @@ Projection::Projection(const std::shared_ptr<const AbstractOperator>& in,
 
 const std::string Projection::name() const { return "Projection"; }
 
+bool Projection::is_pipeline_breaker() const {
+  auto is_pipeline_breaker = false;
+  for (const auto& expression : expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (sub_expression->type == ExpressionType::PQPSelect || sub_expression->type == ExpressionType::Parameter) {
+        is_pipeline_breaker = true;
+        return ExpressionVisitation::DoNotVisitArguments;
+      }
+      return ExpressionVisitation::VisitArguments;
+    });
+  }
+  return is_pipeline_breaker;
+}
+
 std::shared_ptr<AbstractOperator> Projection::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -37,6 +86,8 @@ void Projection::_on_set_transaction_context(const std::weak_ptr<TransactionCont
 }
 
 std::shared_ptr<const Table> Projection::_on_execute() {
+  const auto input_table = input_table_left();
+
   /**
    * Determine the TableColumnDefinitions
    */
@@ -46,18 +97,30 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   }
 
   /**
-   * If an expression is a PQPColumnExpression then it might be possible to forward the input column, if the
-   * input TableType (References or Data) matches the output column type.
+   * Columns that are projected unchanged (PQPColumnExpressions) are forwarded, i.e., their input segments are reused.
+   * For a Data input, the forwarded (possibly encoded) segments are placed next to the ValueSegments of the computed
+   * columns. For a reference input, the output is a reference table if at least one column is forwarded, so that the
+   * forwarded ReferenceSegments do not need to be materialized. The computed segments are then stored in an internal
+   * Data table, which is referenced by the output.
    */
-  const auto only_projects_columns = std::all_of(expressions.begin(), expressions.end(), [&](const auto& expression) {
+  const auto forwards_columns = std::any_of(expressions.begin(), expressions.end(), [&](const auto& expression) {
     return expression->type == ExpressionType::PQPColumn;
   });
 
-  const auto output_table_type = only_projects_columns ? input_table_left()->type() : TableType::Data;
-  const auto forward_columns = input_table_left()->type() == output_table_type;
+  const auto output_table_type =
+      input_table->type() == TableType::References && forwards_columns ? TableType::References : TableType::Data;
 
   const auto output_table =
-      std::make_shared<Table>(column_definitions, output_table_type, input_table_left()->max_chunk_size());
+      std::make_shared<Table>(column_definitions, output_table_type, input_table->max_chunk_size());
+
+  /**
+   * Evaluate constant subexpressions (e.g., `2 + 3` in `a * (2 + 3)`) once instead of once per chunk
+   */
+  auto evaluated_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  evaluated_expressions.reserve(expressions.size());
+  for (const auto& expression : expressions) {
+    evaluated_expressions.emplace_back(fold_constant_expressions(expression));
+  }
 
   /**
    * Performance hack:
@@ -67,7 +130,7 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   auto uncorrelated_select_results = std::make_shared<ExpressionEvaluator::UncorrelatedSelectResults>();
   {
     auto evaluator = ExpressionEvaluator{};
-    for (const auto& expression : expressions) {
+    for (const auto& expression : evaluated_expressions) {
       visit_expression(expression, [&](const auto& sub_expression) {
         const auto pqp_select_expression = std::dynamic_pointer_cast<PQPSelectExpression>(sub_expression);
         if (pqp_select_expression && !pqp_select_expression->is_correlated()) {
@@ -82,22 +145,93 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   }
 
   /**
-   * Perform the projection
+   * With a row budget, only the prefix of chunks needed to produce that many rows is evaluated.
    */
-  for (auto chunk_id = ChunkID{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
-    Segments output_segments;
-    output_segments.reserve(expressions.size());
-
-    const auto input_chunk = input_table_left()->get_chunk(chunk_id);
-
-    ExpressionEvaluator evaluator(input_table_left(), chunk_id, uncorrelated_select_results);
-    for (const auto& expression : expressions) {
-      // Forward input column if possible
-      if (expression->type == ExpressionType::PQPColumn && forward_columns) {
-        const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
-        output_segments.emplace_back(input_chunk->get_segment(pqp_column_expression->column_id));
-      } else {
-        output_segments.emplace_back(evaluator.evaluate_expression_to_segment(*expression));
+  auto chunk_count = input_table->chunk_count();
+  if (_row_budget) {
+    auto row_count = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      if (row_count >= *_row_budget) {
+        chunk_count = chunk_id;
+        break;
+      }
+      row_count += input_table->get_chunk(chunk_id)->size();
+    }
+  }
+
+  /**
+   * Perform the projection, one job per chunk
+   */
+  auto output_segments_by_chunk = std::vector<Segments>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    auto job_task = std::make_shared<JobTask>([&, chunk_id]() {
+      auto& output_segments = output_segments_by_chunk[chunk_id];
+      output_segments.reserve(evaluated_expressions.size());
+
+      const auto input_chunk = input_table->get_chunk(chunk_id);
+
+      ExpressionEvaluator evaluator(input_table, chunk_id, uncorrelated_select_results);
+      for (const auto& expression : evaluated_expressions) {
+        // Forward input column if possible
+        if (expression->type == ExpressionType::PQPColumn) {
+          const auto pqp_column_expression = std::static_pointer_cast<PQPColumnExpression>(expression);
+          output_segments.emplace_back(input_chunk->get_segment(pqp_column_expression->column_id));
+        } else {
+          output_segments.emplace_back(evaluator.evaluate_expression_to_segment(*expression));
+        }
+      }
+    });
+
+    job_task->set_preferred_node_id(input_table->get_chunk(chunk_id)->home_node_id());
+
+    jobs.push_back(job_task);
+    job_task->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  /**
+   * Assemble the output in the order of the input chunks (e.g., Update relies on the chunks being aligned)
+   */
+  auto computed_table = std::shared_ptr<Table>{};
+  auto computed_column_ids = std::vector<std::optional<ColumnID>>(expressions.size());
+  if (output_table_type == TableType::References) {
+    auto computed_column_definitions = TableColumnDefinitions{};
+    for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+      if (expressions[column_id]->type == ExpressionType::PQPColumn) continue;
+      computed_column_ids[column_id] = static_cast<ColumnID>(computed_column_definitions.size());
+      computed_column_definitions.emplace_back(column_definitions[column_id]);
+    }
+    if (!computed_column_definitions.empty()) {
+      computed_table = std::make_shared<Table>(computed_column_definitions, TableType::Data);
+    }
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    auto& output_segments = output_segments_by_chunk[chunk_id];
+    const auto input_chunk = input_table->get_chunk(chunk_id);
+
+    if (computed_table) {
+      auto computed_segments = Segments{};
+      for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+        if (computed_column_ids[column_id]) computed_segments.emplace_back(output_segments[column_id]);
+      }
+      computed_table->append_chunk(computed_segments);
+
+      const auto computed_chunk_id = ChunkID{computed_table->chunk_count() - 1};
+      auto pos_list = std::make_shared<PosList>(input_chunk->size());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < input_chunk->size(); ++chunk_offset) {
+        (*pos_list)[chunk_offset] = RowID{computed_chunk_id, chunk_offset};
+      }
+
+      for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+        if (!computed_column_ids[column_id]) continue;
+        output_segments[column_id] =
+            std::make_shared<ReferenceSegment>(computed_table, *computed_column_ids[column_id], pos_list);
       }
     }
 
@@ -108,6 +242,37 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   return output_table;
 }
 
+std::shared_ptr<AbstractExpression> Projection::fold_constant_expressions(
+    const std::shared_ptr<AbstractExpression>& expression) {
+  if (expression->type != ExpressionType::Value && expression->type != ExpressionType::Parameter &&
+      is_constant(*expression)) {
+    auto folded_expression = expression;
+    resolve_data_type(expression->data_type(), [&](const auto data_type_t) {
+      using ExpressionDataType = typename decltype(data_type_t)::type;
+      const auto result = ExpressionEvaluator{}.evaluate_expression_to_result<ExpressionDataType>(*expression);
+      // A NULL literal has a different data type than the expression, so NULLs are not folded
+      if (!result->is_null(0)) folded_expression = std::make_shared<ValueExpression>(result->value(0));
+    });
+    return folded_expression;
+  }
+
+  // Only the expressions on the path to folded subexpressions are copied, all others (e.g., PQPSelectExpressions and
+  // ParameterExpressions with their values) are kept
+  auto folded_arguments = expression->arguments;
+  auto arguments_folded = false;
+  for (auto& argument : folded_arguments) {
+    const auto folded_argument = fold_constant_expressions(argument);
+    if (folded_argument == argument) continue;
+    argument = folded_argument;
+    arguments_folded = true;
+  }
+  if (!arguments_folded) return expression;
+
+  auto folded_expression = expression->deep_copy();
+  folded_expression->arguments = folded_arguments;
+  return folded_expression;
+}
+
 // returns the singleton dummy table used for literal projections
 std::shared_ptr<Table> Projection::dummy_table() {
   static auto shared_dummy = std::make_shared<DummyTable>();
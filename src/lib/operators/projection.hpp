@@ -17,6 +17,11 @@ namespace opossum {
 
 /**
  * Operator to evaluate Expressions (except for AggregateExpressions)
+ *
+ * The expressions are evaluated in one JobTask per chunk. Columns that are only projected (PQPColumnExpressions) are
+ * forwarded instead of being evaluated, and constant subexpressions are evaluated once (see
+ * fold_constant_expressions). If the input is a reference table and at least one column is forwarded, the output is a
+ * reference table as well and the computed columns reference an internal table holding their values.
  */
 class Projection : public AbstractReadOnlyOperator {
  public:
@@ -25,6 +30,10 @@ class Projection : public AbstractReadOnlyOperator {
 
   const std::string name() const override;
 
+  // Projections with sub selects or parameters are pipeline breakers. Uncorrelated sub selects are executed once for
+  // all chunks, and ParameterExpressions do not keep their values when the expressions are copied for each chunk.
+  bool is_pipeline_breaker() const override;
+
   /**
    * The dummy table is used for literal projections that have no input table.
    * This was introduce to allow queries like INSERT INTO tbl VALUES (1, 2, 3);
@@ -43,6 +52,11 @@ class Projection : public AbstractReadOnlyOperator {
 
   static std::shared_ptr<Table> dummy_table();
 
+  // Replaces the subexpressions of @param expression that do not depend on the input table (e.g., `2 + 3` or `-1`)
+  // with ValueExpressions holding their value. The expression itself is not modified.
+  static std::shared_ptr<AbstractExpression> fold_constant_expressions(
+      const std::shared_ptr<AbstractExpression>& expression);
+
   const std::vector<std::shared_ptr<AbstractExpression>> expressions;
 
  protected:
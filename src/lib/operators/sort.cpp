@@ -11,6 +11,7 @@
 #include "storage/segment_accessor.hpp"
 #include "storage/segment_iterables/chunk_offset_mapping.hpp"
 #include "storage/value_segment.hpp"
+#include "utils/cancellation_token.hpp"
 
 namespace opossum {
 
@@ -77,6 +78,8 @@ class Sort::SortImplMaterializeOutput {
 
     // Materialize segment-wise
     for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
+      CancellationToken::check_current();
+
       const auto column_data_type = output->column_data_type(column_id);
 
       resolve_data_type(column_data_type, [&](auto type) {
@@ -209,6 +212,8 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
     auto& null_value_rows = *_null_value_rows;
 
     for (ChunkID chunk_id{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
+      CancellationToken::check_current();
+
       auto chunk = _table_in->get_chunk(chunk_id);
 
       auto base_segment = chunk->get_segment(_column_id);
@@ -1,5 +1,6 @@
 #include "table_scan.hpp"
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -19,7 +20,9 @@
 #include "storage/proxy_chunk.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
+#include "table_scan/between_table_scan_impl.hpp"
 #include "table_scan/column_comparison_table_scan_impl.hpp"
+#include "table_scan/in_table_scan_impl.hpp"
 #include "table_scan/is_null_table_scan_impl.hpp"
 #include "table_scan/like_table_scan_impl.hpp"
 #include "table_scan/single_column_table_scan_impl.hpp"
@@ -45,13 +48,20 @@ const std::string TableScan::description(DescriptionMode description_mode) const
 
 const OperatorScanPredicate& TableScan::predicate() const { return _predicate; }
 
+bool TableScan::is_pipeline_breaker() const { return !_excluded_chunk_ids.empty(); }
+
 void TableScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
-  if (!is_parameter_id(_predicate.value)) return;
+  const auto set_parameter = [&](AllParameterVariant& value) {
+    if (!is_parameter_id(value)) return;
+
+    const auto value_iter = parameters.find(boost::get<ParameterID>(value));
+    if (value_iter == parameters.end()) return;
 
-  const auto value_iter = parameters.find(boost::get<ParameterID>(_predicate.value));
-  if (value_iter == parameters.end()) return;
+    value = value_iter->second;
+  };
 
-  _predicate.value = value_iter->second;
+  set_parameter(_predicate.value);
+  if (_predicate.value2) set_parameter(*_predicate.value2);
 }
 
 std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
@@ -69,6 +79,10 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   std::mutex output_mutex;
 
+  // With a row budget, chunks are only scanned until enough matches were found
+  auto match_count = std::atomic<size_t>{0};
+  const auto budget_exhausted = [&]() { return _row_budget && match_count >= *_row_budget; };
+
   const auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
@@ -76,12 +90,16 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   for (ChunkID chunk_id{0u}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
     if (excluded_chunk_set.count(chunk_id)) continue;
+    if (budget_exhausted()) break;
+
+    auto job_task = std::make_shared<JobTask>([=, &output_mutex, &match_count]() {
+      if (budget_exhausted()) return;
 
-    auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
       const auto chunk_guard = _in_table->get_chunk_with_access_counting(chunk_id);
       // The actual scan happens in the sub classes of BaseTableScanImpl
       const auto matches_out = _impl->scan_chunk(chunk_id);
       if (matches_out->empty()) return;
+      match_count += matches_out->size();
 
       // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
       // towards the original chunk.
@@ -139,6 +157,9 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
       _output_table->append_chunk(out_segments, chunk_guard->get_allocator(), chunk_guard->access_counter());
     });
 
+    // Scan the chunk on the node its data resides on
+    job_task->set_preferred_node_id(_in_table->get_chunk(chunk_id)->home_node_id());
+
     jobs.push_back(job_task);
     job_task->schedule();
   }
@@ -177,6 +198,22 @@ void TableScan::_init_scan() {
     return;
   }
 
+  if (condition == PredicateCondition::Between) {
+    Assert(_predicate.value2, "BETWEEN requires an upper bound");
+    Assert(is_variant(parameter) && is_variant(*_predicate.value2), "Bounds of BETWEEN must be values");
+
+    const auto lower_bound = boost::get<AllTypeVariant>(parameter);
+    const auto upper_bound = boost::get<AllTypeVariant>(*_predicate.value2);
+
+    _impl = std::make_unique<BetweenTableScanImpl>(_in_table, column_id, lower_bound, upper_bound);
+    return;
+  }
+
+  if (condition == PredicateCondition::In) {
+    _impl = std::make_unique<InTableScanImpl>(_in_table, column_id, _predicate.value_list);
+    return;
+  }
+
   if (is_variant(parameter)) {
     const auto right_value = boost::get<AllTypeVariant>(parameter);
 
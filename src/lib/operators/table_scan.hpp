@@ -44,6 +44,9 @@ class TableScan : public AbstractReadOnlyOperator {
   const std::string description(DescriptionMode description_mode) const override;
   const OperatorScanPredicate& predicate() const;
 
+  // Chunks excluded by ID cannot be identified when the scan is executed chunk by chunk
+  bool is_pipeline_breaker() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
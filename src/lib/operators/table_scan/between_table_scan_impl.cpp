@@ -0,0 +1,115 @@
+#include "between_table_scan_impl.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/resolve_encoded_segment_type.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
+#include "storage/value_segment.hpp"
+#include "value_id_range_scan.hpp"
+
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+BetweenTableScanImpl::BetweenTableScanImpl(const std::shared_ptr<const Table>& in_table,
+                                           const ColumnID left_column_id, const AllTypeVariant& lower_bound,
+                                           const AllTypeVariant& upper_bound)
+    : BaseSingleColumnTableScanImpl{in_table, left_column_id, PredicateCondition::Between},
+      _lower_bound{lower_bound},
+      _upper_bound{upper_bound} {}
+
+std::shared_ptr<PosList> BetweenTableScanImpl::scan_chunk(ChunkID chunk_id) {
+  // Comparing anything with NULL results in NULL, see SingleColumnTableScanImpl
+  if (variant_is_null(_lower_bound) || variant_is_null(_upper_bound)) return std::make_shared<PosList>();
+
+  return BaseSingleColumnTableScanImpl::scan_chunk(chunk_id);
+}
+
+void BetweenTableScanImpl::handle_segment(const BaseValueSegment& base_segment,
+                                          std::shared_ptr<SegmentVisitorContext> base_context) {
+  auto context = std::static_pointer_cast<Context>(base_context);
+  const auto left_column_type = _in_table->column_data_type(_left_column_id);
+
+  resolve_data_type(left_column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto& left_segment = static_cast<const ValueSegment<ColumnDataType>&>(base_segment);
+    _scan_iterable<ColumnDataType>(create_iterable_from_segment(left_segment), *context);
+  });
+}
+
+void BetweenTableScanImpl::handle_segment(const BaseEncodedSegment& base_segment,
+                                          std::shared_ptr<SegmentVisitorContext> base_context) {
+  auto context = std::static_pointer_cast<Context>(base_context);
+  const auto left_column_type = _in_table->column_data_type(_left_column_id);
+
+  resolve_data_type(left_column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    resolve_encoded_segment_type<ColumnDataType>(base_segment, [&](const auto& typed_segment) {
+      _scan_iterable<ColumnDataType>(create_iterable_from_segment(typed_segment), *context);
+    });
+  });
+}
+
+void BetweenTableScanImpl::handle_segment(const BaseDictionarySegment& base_segment,
+                                          std::shared_ptr<SegmentVisitorContext> base_context) {
+  auto context = std::static_pointer_cast<Context>(base_context);
+  auto& matches_out = context->_matches_out;
+  const auto chunk_id = context->_chunk_id;
+  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
+
+  /**
+   * A value is within [lower, upper] iff its value ID is within [dict.lower_bound(lower), dict.upper_bound(upper)).
+   * INVALID_VALUE_ID (i.e., no value in the dictionary is larger) is the largest ValueID, so it works as an exclusive
+   * upper bound. The NULL value ID (dictionary size) is never within the range, as NULLs are skipped by the scan.
+   */
+  const auto lower_value_id = base_segment.lower_bound(_lower_bound);
+  const auto upper_value_id = base_segment.upper_bound(_upper_bound);
+
+  auto left_iterable = create_iterable_from_attribute_vector(base_segment);
+
+  // Early outs: the range covers all value IDs or no value ID at all
+  if (lower_value_id == ValueID{0u} && upper_value_id == INVALID_VALUE_ID) {
+    left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+      static const auto always_true = [](const auto&) { return true; };
+      this->_unary_scan(always_true, left_it, left_end, chunk_id, matches_out);
+    });
+
+    return;
+  }
+
+  if (lower_value_id == INVALID_VALUE_ID || lower_value_id >= upper_value_id) return;
+
+  // Without a position filter, the attribute vector is scanned by the SIMD kernels. These do not skip NULLs, so the
+  // range has to end at the null value ID.
+  if (!mapped_chunk_offsets) {
+    const auto range_end = std::min(upper_value_id, base_segment.null_value_id());
+    scan_value_id_range(*base_segment.attribute_vector(), lower_value_id, range_end, chunk_id, matches_out);
+    return;
+  }
+
+  left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+    const auto in_range = [&](const ValueID value_id) {
+      return value_id >= lower_value_id && value_id < upper_value_id;
+    };
+    this->_unary_scan(in_range, left_it, left_end, chunk_id, matches_out);
+  });
+}
+
+template <typename ColumnDataType, typename Iterable>
+void BetweenTableScanImpl::_scan_iterable(const Iterable& iterable, Context& context) {
+  const auto lower_bound = type_cast<ColumnDataType>(_lower_bound);
+  const auto upper_bound = type_cast<ColumnDataType>(_upper_bound);
+
+  iterable.with_iterators(context._mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+    const auto in_range = [&](const auto& value) { return value >= lower_bound && value <= upper_bound; };
+    this->_unary_scan(in_range, left_it, left_end, context._chunk_id, context._matches_out);
+  });
+}
+
+}  // namespace opossum
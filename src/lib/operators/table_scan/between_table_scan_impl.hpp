@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+
+#include "base_single_column_table_scan_impl.hpp"
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * @brief Scans for values within the (inclusive) bounds of a BETWEEN in a single pass
+ *
+ * - Value segments and other encoded segments are scanned sequentially, comparing each value with both bounds
+ * - For dictionary segments, the bounds are translated into the value ID range [lower_bound(lower), upper_bound(upper))
+ *   so that only value IDs have to be compared. This also enables us to detect if all or none of the values in the
+ *   segment are within the bounds.
+ */
+class BetweenTableScanImpl : public BaseSingleColumnTableScanImpl {
+ public:
+  BetweenTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID left_column_id,
+                       const AllTypeVariant& lower_bound, const AllTypeVariant& upper_bound);
+
+  std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) override;
+
+  void handle_segment(const BaseValueSegment& base_segment,
+                      std::shared_ptr<SegmentVisitorContext> base_context) override;
+
+  void handle_segment(const BaseDictionarySegment& base_segment,
+                      std::shared_ptr<SegmentVisitorContext> base_context) override;
+
+  void handle_segment(const BaseEncodedSegment& base_segment,
+                      std::shared_ptr<SegmentVisitorContext> base_context) override;
+
+  using BaseSingleColumnTableScanImpl::handle_segment;
+
+ private:
+  template <typename ColumnDataType, typename Iterable>
+  void _scan_iterable(const Iterable& iterable, Context& context);
+
+  const AllTypeVariant _lower_bound;
+  const AllTypeVariant _upper_bound;
+};
+
+}  // namespace opossum
@@ -0,0 +1,111 @@
+#include "in_table_scan_impl.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/resolve_encoded_segment_type.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
+#include "storage/value_segment.hpp"
+
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+InTableScanImpl::InTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID left_column_id,
+                                 const std::vector<AllTypeVariant>& value_list)
+    : BaseSingleColumnTableScanImpl{in_table, left_column_id, PredicateCondition::In}, _value_list{value_list} {
+  DebugAssert(std::none_of(value_list.begin(), value_list.end(),
+                           [](const auto& value) { return variant_is_null(value); }),
+              "IN value list must not contain NULLs");
+}
+
+void InTableScanImpl::handle_segment(const BaseValueSegment& base_segment,
+                                     std::shared_ptr<SegmentVisitorContext> base_context) {
+  auto context = std::static_pointer_cast<Context>(base_context);
+  const auto left_column_type = _in_table->column_data_type(_left_column_id);
+
+  resolve_data_type(left_column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto& left_segment = static_cast<const ValueSegment<ColumnDataType>&>(base_segment);
+    _scan_iterable<ColumnDataType>(create_iterable_from_segment(left_segment), *context);
+  });
+}
+
+void InTableScanImpl::handle_segment(const BaseEncodedSegment& base_segment,
+                                     std::shared_ptr<SegmentVisitorContext> base_context) {
+  auto context = std::static_pointer_cast<Context>(base_context);
+  const auto left_column_type = _in_table->column_data_type(_left_column_id);
+
+  resolve_data_type(left_column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    resolve_encoded_segment_type<ColumnDataType>(base_segment, [&](const auto& typed_segment) {
+      _scan_iterable<ColumnDataType>(create_iterable_from_segment(typed_segment), *context);
+    });
+  });
+}
+
+void InTableScanImpl::handle_segment(const BaseDictionarySegment& base_segment,
+                                     std::shared_ptr<SegmentVisitorContext> base_context) {
+  auto context = std::static_pointer_cast<Context>(base_context);
+  auto& matches_out = context->_matches_out;
+  const auto chunk_id = context->_chunk_id;
+  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
+
+  // Mark the value IDs of all values of the list that are contained in the dictionary
+  const auto unique_values_count = base_segment.unique_values_count();
+  auto value_id_matches = std::vector<bool>(unique_values_count, false);
+  auto match_count = size_t{0};
+
+  for (const auto& value : _value_list) {
+    const auto value_id = base_segment.lower_bound(value);
+    if (value_id == INVALID_VALUE_ID || value_id == base_segment.upper_bound(value)) continue;
+    if (value_id_matches[value_id]) continue;  // Duplicate in the value list
+
+    value_id_matches[value_id] = true;
+    ++match_count;
+  }
+
+  auto left_iterable = create_iterable_from_attribute_vector(base_segment);
+
+  // IN matches all rows
+  if (match_count == unique_values_count) {
+    left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+      static const auto always_true = [](const auto&) { return true; };
+      this->_unary_scan(always_true, left_it, left_end, chunk_id, matches_out);
+    });
+
+    return;
+  }
+
+  // IN matches no rows
+  if (match_count == 0u) return;
+
+  const auto value_id_lookup = [&value_id_matches](const ValueID value_id) { return value_id_matches[value_id]; };
+
+  left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+    this->_unary_scan(value_id_lookup, left_it, left_end, chunk_id, matches_out);
+  });
+}
+
+template <typename ColumnDataType, typename Iterable>
+void InTableScanImpl::_scan_iterable(const Iterable& iterable, Context& context) {
+  auto values = std::vector<ColumnDataType>{};
+  values.reserve(_value_list.size());
+  for (const auto& value : _value_list) {
+    values.emplace_back(type_cast<ColumnDataType>(value));
+  }
+  std::sort(values.begin(), values.end());
+
+  iterable.with_iterators(context._mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+    const auto contained = [&](const auto& value) { return std::binary_search(values.begin(), values.end(), value); };
+    this->_unary_scan(contained, left_it, left_end, context._chunk_id, context._matches_out);
+  });
+}
+
+}  // namespace opossum
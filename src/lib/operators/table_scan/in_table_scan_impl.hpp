@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_single_column_table_scan_impl.hpp"
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * @brief Scans for values contained in the value list of an IN in a single pass
+ *
+ * - The values have to be non-NULL and of the column's data type (see OperatorScanPredicate)
+ * - Value segments and other encoded segments are scanned sequentially, looking up each value in the sorted value list
+ * - For dictionary segments, the value list is translated into a bitmap over the value IDs of the dictionary, so that
+ *   each row costs a single lookup of its value ID. This also enables us to detect if all or none of the values in the
+ *   segment are contained in the value list.
+ */
+class InTableScanImpl : public BaseSingleColumnTableScanImpl {
+ public:
+  InTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID left_column_id,
+                  const std::vector<AllTypeVariant>& value_list);
+
+  void handle_segment(const BaseValueSegment& base_segment,
+                      std::shared_ptr<SegmentVisitorContext> base_context) override;
+
+  void handle_segment(const BaseDictionarySegment& base_segment,
+                      std::shared_ptr<SegmentVisitorContext> base_context) override;
+
+  void handle_segment(const BaseEncodedSegment& base_segment,
+                      std::shared_ptr<SegmentVisitorContext> base_context) override;
+
+  using BaseSingleColumnTableScanImpl::handle_segment;
+
+ private:
+  template <typename ColumnDataType, typename Iterable>
+  void _scan_iterable(const Iterable& iterable, Context& context);
+
+  const std::vector<AllTypeVariant> _value_list;
+};
+
+}  // namespace opossum
@@ -8,6 +8,7 @@
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
+#include "value_id_range_scan.hpp"
 
 #include "resolve_type.hpp"
 #include "type_comparison.hpp"
@@ -135,6 +136,14 @@ void SingleColumnTableScanImpl::handle_segment(const BaseDictionarySegment& base
     return;
   }
 
+  // For all conditions but NotEquals, the matching value IDs form a single range. Without a position filter, the
+  // attribute vector is then scanned by the SIMD kernels, which compare the value IDs without decoding them one by one.
+  if (!mapped_chunk_offsets && _predicate_condition != PredicateCondition::NotEquals) {
+    const auto [lower_value_id, upper_value_id] = _get_search_value_id_range(base_segment, search_value_id);
+    scan_value_id_range(*base_segment.attribute_vector(), lower_value_id, upper_value_id, chunk_id, matches_out);
+    return;
+  }
+
   left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
     this->_with_operator_for_dict_segment_scan(_predicate_condition, [&](auto comparator) {
       this->_unary_scan_with_value(comparator, left_it, left_end, search_value_id, chunk_id, matches_out);
@@ -159,6 +168,26 @@ ValueID SingleColumnTableScanImpl::_get_search_value_id(const BaseDictionarySegm
   }
 }
 
+std::pair<ValueID, ValueID> SingleColumnTableScanImpl::_get_search_value_id_range(
+    const BaseDictionarySegment& segment, const ValueID search_value_id) const {
+  // The early outs guarantee that the ranges are not empty. The null value ID is excluded from all of them.
+  switch (_predicate_condition) {
+    case PredicateCondition::Equals:
+      return {search_value_id, ValueID{search_value_id + 1u}};
+
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+      return {ValueID{0u}, search_value_id};
+
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      return {search_value_id, segment.null_value_id()};
+
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+}
+
 bool SingleColumnTableScanImpl::_right_value_matches_all(const BaseDictionarySegment& segment,
                                                          const ValueID search_value_id) const {
   switch (_predicate_condition) {
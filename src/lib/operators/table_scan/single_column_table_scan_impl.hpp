@@ -19,7 +19,8 @@ namespace opossum {
  * - Value segments are scanned sequentially
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
- *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ *   enables us to detect if all or none of the values in the segment satisfy the expression. The attribute
+ *   vector is scanned with SIMD kernels where possible (see scan_value_id_range).
  */
 class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
  public:
@@ -47,6 +48,10 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
 
   ValueID _get_search_value_id(const BaseDictionarySegment& segment) const;
 
+  // Returns the range [lower, upper) of the matching value IDs. Not applicable to NotEquals.
+  std::pair<ValueID, ValueID> _get_search_value_id_range(const BaseDictionarySegment& segment,
+                                                         const ValueID search_value_id) const;
+
   bool _right_value_matches_all(const BaseDictionarySegment& segment, const ValueID search_value_id) const;
 
   bool _right_value_matches_none(const BaseDictionarySegment& segment, const ValueID search_value_id) const;
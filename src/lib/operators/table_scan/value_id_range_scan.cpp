@@ -0,0 +1,275 @@
+#include "value_id_range_scan.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Appends the positions of the set bits of a bitmask, where bit i stands for the chunk offset base_offset + i
+void append_matches(uint64_t matches, const size_t base_offset, const ChunkID chunk_id, PosList& matches_out) {
+  while (matches != 0u) {
+    const auto bit = __builtin_ctzll(matches);
+    matches_out.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(base_offset + bit)});
+    matches &= matches - 1u;
+  }
+}
+
+/**
+ * Checks 16 consecutive values at once for (value - lower) < width, which is the same as lower <= value < upper when
+ * computed with unsigned integers. SSE2 and AVX2 only provide signed comparisons, which yield the same result if the
+ * sign bit of both sides is flipped. The comparison results are then compressed into one bit per value.
+ */
+template <typename UnsignedIntType>
+class RangeMatcher16;
+
+#if defined(__SSE2__)
+
+template <>
+class RangeMatcher16<uint8_t> {
+ public:
+  RangeMatcher16(const uint8_t lower, const uint8_t width)
+      : _lower{_mm_set1_epi8(static_cast<char>(lower))},
+        _sign_bits{_mm_set1_epi8(static_cast<char>(0x80))},
+        _width{_mm_xor_si128(_mm_set1_epi8(static_cast<char>(width)), _sign_bits)} {}
+
+  uint32_t match(const uint8_t* values) const {
+    const auto offsets = _mm_xor_si128(_mm_sub_epi8(_load(values), _lower), _sign_bits);
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(offsets, _width)));
+  }
+
+ private:
+  static __m128i _load(const uint8_t* values) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values)); }
+
+  const __m128i _lower;
+  const __m128i _sign_bits;
+  const __m128i _width;
+};
+
+#if defined(__AVX2__)
+
+template <>
+class RangeMatcher16<uint16_t> {
+ public:
+  RangeMatcher16(const uint16_t lower, const uint16_t width)
+      : _lower{_mm256_set1_epi16(static_cast<int16_t>(lower))},
+        _sign_bits{_mm256_set1_epi16(static_cast<int16_t>(0x8000))},
+        _width{_mm256_xor_si256(_mm256_set1_epi16(static_cast<int16_t>(width)), _sign_bits)} {}
+
+  uint32_t match(const uint16_t* values) const {
+    const auto offsets = _mm256_xor_si256(_mm256_sub_epi16(_load(values), _lower), _sign_bits);
+    const auto matches = _mm256_cmpgt_epi16(_width, offsets);
+
+    // Packing the two 128-bit lanes leaves one byte per value, in order
+    const auto packed_matches =
+        _mm_packs_epi16(_mm256_castsi256_si128(matches), _mm256_extracti128_si256(matches, 1));
+    return static_cast<uint32_t>(_mm_movemask_epi8(packed_matches));
+  }
+
+ private:
+  static __m256i _load(const uint16_t* values) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+  }
+
+  const __m256i _lower;
+  const __m256i _sign_bits;
+  const __m256i _width;
+};
+
+template <>
+class RangeMatcher16<uint32_t> {
+ public:
+  RangeMatcher16(const uint32_t lower, const uint32_t width)
+      : _lower{_mm256_set1_epi32(static_cast<int32_t>(lower))},
+        _sign_bits{_mm256_set1_epi32(static_cast<int32_t>(0x80000000u))},
+        _width{_mm256_xor_si256(_mm256_set1_epi32(static_cast<int32_t>(width)), _sign_bits)} {}
+
+  uint32_t match(const uint32_t* values) const { return _match_8(values) | (_match_8(values + 8) << 8u); }
+
+ private:
+  uint32_t _match_8(const uint32_t* values) const {
+    const auto values_reg = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+    const auto offsets = _mm256_xor_si256(_mm256_sub_epi32(values_reg, _lower), _sign_bits);
+    return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(_width, offsets))));
+  }
+
+  const __m256i _lower;
+  const __m256i _sign_bits;
+  const __m256i _width;
+};
+
+#else
+
+template <>
+class RangeMatcher16<uint16_t> {
+ public:
+  RangeMatcher16(const uint16_t lower, const uint16_t width)
+      : _lower{_mm_set1_epi16(static_cast<int16_t>(lower))},
+        _sign_bits{_mm_set1_epi16(static_cast<int16_t>(0x8000))},
+        _width{_mm_xor_si128(_mm_set1_epi16(static_cast<int16_t>(width)), _sign_bits)} {}
+
+  uint32_t match(const uint16_t* values) const {
+    const auto packed_matches = _mm_packs_epi16(_match_8(values), _match_8(values + 8));
+    return static_cast<uint32_t>(_mm_movemask_epi8(packed_matches));
+  }
+
+ private:
+  __m128i _match_8(const uint16_t* values) const {
+    const auto values_reg = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+    return _mm_cmplt_epi16(_mm_xor_si128(_mm_sub_epi16(values_reg, _lower), _sign_bits), _width);
+  }
+
+  const __m128i _lower;
+  const __m128i _sign_bits;
+  const __m128i _width;
+};
+
+template <>
+class RangeMatcher16<uint32_t> {
+ public:
+  RangeMatcher16(const uint32_t lower, const uint32_t width)
+      : _lower{_mm_set1_epi32(static_cast<int32_t>(lower))},
+        _sign_bits{_mm_set1_epi32(static_cast<int32_t>(0x80000000u))},
+        _width{_mm_xor_si128(_mm_set1_epi32(static_cast<int32_t>(width)), _sign_bits)} {}
+
+  uint32_t match(const uint32_t* values) const {
+    const auto packed_matches = _mm_packs_epi16(_mm_packs_epi32(_match_4(values), _match_4(values + 4)),
+                                                _mm_packs_epi32(_match_4(values + 8), _match_4(values + 12)));
+    return static_cast<uint32_t>(_mm_movemask_epi8(packed_matches));
+  }
+
+ private:
+  __m128i _match_4(const uint32_t* values) const {
+    const auto values_reg = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+    return _mm_cmplt_epi32(_mm_xor_si128(_mm_sub_epi32(values_reg, _lower), _sign_bits), _width);
+  }
+
+  const __m128i _lower;
+  const __m128i _sign_bits;
+  const __m128i _width;
+};
+
+#endif
+
+#else
+
+template <typename UnsignedIntType>
+class RangeMatcher16 {
+ public:
+  RangeMatcher16(const UnsignedIntType lower, const UnsignedIntType width) : _lower{lower}, _width{width} {}
+
+  uint32_t match(const UnsignedIntType* values) const {
+    auto matches = uint32_t{0u};
+    for (auto index = 0u; index < 16u; ++index) {
+      matches |= uint32_t{static_cast<UnsignedIntType>(values[index] - _lower) < _width} << index;
+    }
+    return matches;
+  }
+
+ private:
+  const UnsignedIntType _lower;
+  const UnsignedIntType _width;
+};
+
+#endif
+
+template <typename UnsignedIntType>
+void scan(const FixedSizeByteAlignedVector<UnsignedIntType>& vector, const uint32_t lower, const uint32_t upper,
+          const ChunkID chunk_id, PosList& matches_out) {
+  const auto& values = vector.data();
+
+  // Clamp the range to the values that the vector can hold
+  constexpr auto MAX_VALUE = uint64_t{std::numeric_limits<UnsignedIntType>::max()};
+  if (lower > MAX_VALUE) return;
+  const auto width = std::min(uint64_t{upper}, MAX_VALUE + 1u) - lower;
+
+  if (width > MAX_VALUE) {
+    // All values are within the range
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+    return;
+  }
+
+  const auto typed_lower = static_cast<UnsignedIntType>(lower);
+  const auto typed_width = static_cast<UnsignedIntType>(width);
+  const auto matcher = RangeMatcher16<UnsignedIntType>{typed_lower, typed_width};
+
+  auto offset = size_t{0};
+  for (; offset + 16u <= values.size(); offset += 16u) {
+    append_matches(matcher.match(values.data() + offset), offset, chunk_id, matches_out);
+  }
+
+  for (; offset < values.size(); ++offset) {
+    if (static_cast<UnsignedIntType>(values[offset] - typed_lower) < typed_width) {
+      matches_out.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(offset)});
+    }
+  }
+}
+
+void scan(const SimdBp128Vector& vector, const uint32_t lower, const uint32_t upper, const ChunkID chunk_id,
+          PosList& matches_out) {
+  using Packing = SimdBp128Packing;
+
+  const auto& data = vector.data();
+  const auto size = vector.size();
+
+  auto data_index = size_t{0};
+  auto meta_info = std::array<uint8_t, Packing::blocks_in_meta_block>{};
+  auto block_matches = std::array<uint64_t, 2>{};
+
+  for (auto meta_block_offset = size_t{0}; meta_block_offset < size; meta_block_offset += Packing::meta_block_size) {
+    Packing::read_meta_info(data.data() + data_index++, meta_info.data());
+
+    for (auto block_index = 0u; block_index < Packing::blocks_in_meta_block; ++block_index) {
+      const auto block_offset = meta_block_offset + block_index * Packing::block_size;
+      if (block_offset >= size) break;
+
+      const auto bit_size = meta_info[block_index];
+
+      // All values of a block are smaller than 2^bit_size. Thus, the block is skipped if the range starts above.
+      if (bit_size == 32u || lower < (uint64_t{1} << bit_size)) {
+        Packing::match_block(data.data() + data_index, bit_size, lower, upper, block_matches.data());
+
+        // The last block is padded with zeros, which must not be part of the result
+        const auto value_count = size - block_offset;
+        if (value_count < 64u) {
+          block_matches[0] &= (uint64_t{1} << value_count) - 1u;
+          block_matches[1] = 0u;
+        } else if (value_count < 128u) {
+          block_matches[1] &= (uint64_t{1} << (value_count - 64u)) - 1u;
+        }
+
+        append_matches(block_matches[0], block_offset, chunk_id, matches_out);
+        append_matches(block_matches[1], block_offset + 64u, chunk_id, matches_out);
+      }
+
+      data_index += bit_size;
+    }
+  }
+}
+
+}  // namespace
+
+void scan_value_id_range(const BaseCompressedVector& attribute_vector, const ValueID lower_value_id,
+                         const ValueID upper_value_id, const ChunkID chunk_id, PosList& matches_out) {
+  DebugAssert(lower_value_id < upper_value_id, "Value ID range must not be empty");
+
+  resolve_compressed_vector_type(attribute_vector, [&](const auto& vector) {
+    scan(vector, lower_value_id, upper_value_id, chunk_id, matches_out);
+  });
+}
+
+}  // namespace opossum
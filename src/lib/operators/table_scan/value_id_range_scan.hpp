@@ -0,0 +1,25 @@
+#pragma once
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Scans the attribute vector of a dictionary segment for a range of value IDs
+ *
+ * Appends the positions of all value IDs within [lower_value_id, upper_value_id) to matches_out. Instead of decoding
+ * the attribute vector value by value, the value IDs are compared in SIMD registers:
+ *
+ * - FixedSizeByteAlignedVectors are compared 16 value IDs at a time, with AVX2 if available and SSE2 otherwise.
+ * - SimdBp128Vectors are evaluated per block of 128 value IDs while these are unpacked (see
+ *   SimdBp128Packing::match_block). Blocks whose bit size rules out any match are not unpacked at all.
+ *
+ * Requires lower_value_id < upper_value_id. As NULLs are not excluded separately, upper_value_id must not exceed the
+ * null value ID of the segment.
+ */
+void scan_value_id_range(const BaseCompressedVector& attribute_vector, const ValueID lower_value_id,
+                         const ValueID upper_value_id, const ChunkID chunk_id, PosList& matches_out);
+
+}  // namespace opossum
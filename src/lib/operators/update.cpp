@@ -40,37 +40,63 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
 
   auto insert_table = std::make_shared<Table>(insert_table_column_definitions, TableType::References);
 
+  // This is either table_to_update or a copy of it created by GetTable, see Delete
+  const auto first_left_chunk = input_table_left()->get_chunk(ChunkID{0});
+  const auto referenced_table =
+      std::static_pointer_cast<const ReferenceSegment>(first_left_chunk->get_segment(ColumnID{0}))->referenced_table();
+
   auto current_row_in_left_chunk = 0u;
   auto current_pos_list = std::shared_ptr<const PosList>();
   auto current_left_chunk_id = ChunkID{0};
 
-  for (ChunkID chunk_id{0}; chunk_id < input_table_right()->chunk_count(); ++chunk_id) {
-    // Build poslists for mixed chunk numbers and sizes.
-    auto pos_list = std::make_shared<PosList>();
-    for (auto i = 0u; i < input_table_right()->get_chunk(chunk_id)->size(); ++i) {
-      if (current_pos_list == nullptr || current_row_in_left_chunk == current_pos_list->size()) {
-        current_row_in_left_chunk = 0u;
-        current_pos_list = std::static_pointer_cast<const ReferenceSegment>(
-                               input_table_left()->get_chunk(current_left_chunk_id)->get_segment(ColumnID{0}))
-                               ->pos_list();
-        current_left_chunk_id++;
+  // If the right input is chunked like the left one (e.g., because it is a Projection of it), the PosLists of the left
+  // input can be used directly. Otherwise, they are rebuilt to match the chunks of the right input.
+  const auto chunks_aligned = [&]() {
+    if (input_table_left()->chunk_count() != input_table_right()->chunk_count()) return false;
+    for (ChunkID chunk_id{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
+      if (input_table_left()->get_chunk(chunk_id)->size() != input_table_right()->get_chunk(chunk_id)->size()) {
+        return false;
       }
+    }
+    return true;
+  }();
 
-      pos_list->emplace_back((*current_pos_list)[current_row_in_left_chunk]);
-      current_row_in_left_chunk++;
+  for (ChunkID chunk_id{0}; chunk_id < input_table_right()->chunk_count(); ++chunk_id) {
+    auto pos_list = std::shared_ptr<const PosList>{};
+
+    if (chunks_aligned) {
+      pos_list = std::static_pointer_cast<const ReferenceSegment>(
+                     input_table_left()->get_chunk(chunk_id)->get_segment(ColumnID{0}))
+                     ->pos_list();
+    } else {
+      // Build poslists for mixed chunk numbers and sizes.
+      auto rebuilt_pos_list = std::make_shared<PosList>();
+      rebuilt_pos_list->reserve(input_table_right()->get_chunk(chunk_id)->size());
+      for (auto i = 0u; i < input_table_right()->get_chunk(chunk_id)->size(); ++i) {
+        if (current_pos_list == nullptr || current_row_in_left_chunk == current_pos_list->size()) {
+          current_row_in_left_chunk = 0u;
+          current_pos_list = std::static_pointer_cast<const ReferenceSegment>(
+                                 input_table_left()->get_chunk(current_left_chunk_id)->get_segment(ColumnID{0}))
+                                 ->pos_list();
+          current_left_chunk_id++;
+        }
+
+        rebuilt_pos_list->emplace_back((*current_pos_list)[current_row_in_left_chunk]);
+        current_row_in_left_chunk++;
+      }
+      pos_list = rebuilt_pos_list;
     }
 
     // Add ReferenceSegments with built poslist.
     Segments insert_table_segments;
     for (ColumnID column_id{0}; column_id < table_to_update->column_count(); ++column_id) {
-      insert_table_segments.push_back(std::make_shared<ReferenceSegment>(table_to_update, column_id, pos_list));
+      insert_table_segments.push_back(std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list));
     }
 
     insert_table->append_chunk(insert_table_segments);
   }
 
   // 2. Replace the columns to update in insert_table with the updated data from input_table_right
-  const auto left_chunk = input_table_left()->get_chunk(ChunkID{0});
   for (ChunkID chunk_id{0}; chunk_id < insert_table->chunk_count(); ++chunk_id) {
     auto insert_chunk = insert_table->get_chunk(chunk_id);
     auto right_chunk = input_table_right()->get_chunk(chunk_id);
@@ -78,7 +104,7 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
     for (ColumnID column_id{0}; column_id < input_table_left()->column_count(); ++column_id) {
       auto right_segment = right_chunk->get_segment(column_id);
 
-      auto left_segment = std::dynamic_pointer_cast<const ReferenceSegment>(left_chunk->get_segment(column_id));
+      auto left_segment = std::dynamic_pointer_cast<const ReferenceSegment>(first_left_chunk->get_segment(column_id));
 
       insert_chunk->replace_segment(left_segment->referenced_column_id(), right_segment);
     }
@@ -110,8 +136,8 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
 
 /**
  * input_table_left must be a table with at least one chunk, containing at least one ReferenceSegment
- * that all reference the table specified by table_to_update_name. The column count and types in input_table_left
- * must match the count and types in input_table_right.
+ * that all reference the table specified by table_to_update_name (or a copy of it sharing its chunks, see GetTable).
+ * The column count and types in input_table_left must match the count and types in input_table_right.
  */
 bool Update::_execution_input_valid(const std::shared_ptr<TransactionContext>& context) const {
   if (context == nullptr) return false;
@@ -128,7 +154,12 @@ bool Update::_execution_input_valid(const std::shared_ptr<TransactionContext>& c
     if (!chunk->references_exactly_one_table()) return false;
 
     const auto first_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
-    if (table_to_update != first_segment->referenced_table()) return false;
+    const auto referenced_table = first_segment->referenced_table();
+    if (table_to_update != referenced_table && (referenced_table->type() != TableType::Data ||
+                                                referenced_table->column_definitions() !=
+                                                    table_to_update->column_definitions())) {
+      return false;
+    }
   }
 
   return true;
@@ -35,6 +35,8 @@ Validate::Validate(const std::shared_ptr<AbstractOperator>& in)
 
 const std::string Validate::name() const { return "Validate"; }
 
+bool Validate::is_pipeline_breaker() const { return false; }
+
 std::shared_ptr<AbstractOperator> Validate::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -56,7 +58,12 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   const auto our_tid = transaction_context->transaction_id();
   const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
 
+  // With a row budget, only the prefix of chunks needed to produce that many visible rows is validated
+  auto output_row_count = size_t{0};
+
   for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
+    if (_row_budget && output_row_count >= *_row_budget) break;
+
     const auto chunk_in = in_table->get_chunk(chunk_id);
 
     Segments output_segments;
@@ -115,6 +122,7 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
 
     if (!pos_list_out->empty() > 0) {
       output->append_chunk(output_segments);
+      output_row_count += pos_list_out->size();
     }
   }
   return output;
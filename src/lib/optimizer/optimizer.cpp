@@ -3,7 +3,7 @@
 #include <memory>
 #include <unordered_set>
 
-#include "cost_model/cost_model_logical.hpp"
+#include "cost_model/cost_model_physical.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_select_expression.hpp"
 #include "logical_query_plan/logical_plan_root_node.hpp"
@@ -80,7 +80,8 @@ void collect_select_expressions_by_lqp(SelectExpressionsByLQP& select_expression
 
 namespace opossum {
 
-std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
+std::shared_ptr<Optimizer> Optimizer::create_default_optimizer(
+    const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
   auto optimizer = std::make_shared<Optimizer>(100);
 
   // Run pruning just once since the rule would otherwise insert the pruning ProjectionNodes multiple times.
@@ -96,7 +97,8 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   RuleBatch final_batch(RuleBatchExecutionPolicy::Once);
   final_batch.add_rule(std::make_shared<ChunkPruningRule>());
   final_batch.add_rule(std::make_shared<ConstantCalculationRule>());
-  final_batch.add_rule(std::make_shared<JoinOrderingRule>(std::make_shared<CostModelLogical>()));
+  final_batch.add_rule(
+      std::make_shared<JoinOrderingRule>(cost_estimator ? cost_estimator : std::make_shared<CostModelPhysical>()));
   final_batch.add_rule(std::make_shared<IndexScanRule>());
   optimizer->add_rule_batch(final_batch);
 
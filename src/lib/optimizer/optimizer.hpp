@@ -7,6 +7,7 @@
 
 namespace opossum {
 
+class AbstractCostEstimator;
 class AbstractRule;
 class AbstractLQPNode;
 
@@ -20,7 +21,9 @@ class AbstractLQPNode;
  */
 class Optimizer final {
  public:
-  static std::shared_ptr<Optimizer> create_default_optimizer();
+  // @param cost_estimator    used for ordering the joins (see JoinOrderingRule), CostModelPhysical if nullptr
+  static std::shared_ptr<Optimizer> create_default_optimizer(
+      const std::shared_ptr<AbstractCostEstimator>& cost_estimator = nullptr);
 
   explicit Optimizer(const uint32_t max_num_iterations);
 
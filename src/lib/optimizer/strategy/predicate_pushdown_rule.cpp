@@ -77,7 +77,8 @@ bool PredicatePushdownRule::apply_to(const std::shared_ptr<AbstractLQPNode>& nod
     return true;
   } else if (input->type == LQPNodeType::Projection) {
     // push below projection if the projection does not generate the column(s) that we are scanning on
-    if (OperatorScanPredicate::from_expression(*predicate_node->predicate, *input->left_input()) != std::nullopt) {
+    if (OperatorScanPredicate::from_expression(*predicate_node->predicate, *input->left_input()) != std::nullopt ||
+        OperatorScanPredicate::single_pass_from_expression(*predicate_node->predicate, *input->left_input())) {
       push_down(node, input);
       return true;
     }
@@ -10,6 +10,7 @@
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
+#include "statistics/cardinality_feedback_store.hpp"
 #include "statistics/table_statistics.hpp"
 #include "utils/assert.hpp"
 
@@ -61,12 +62,21 @@ bool PredicateReorderingRule::_reorder_predicates(std::vector<std::shared_ptr<Ab
   const auto outputs = predicates.front()->outputs();
   const auto input_sides = predicates.front()->get_input_sides();
 
-  const auto sort_predicate = [&](auto& left, auto& right) {
-    return left->derive_statistics_from(input)->row_count() > right->derive_statistics_from(input)->row_count();
+  // Prefer the actual row counts of predicates that were executed directly on the input before
+  const auto& feedback_store = CardinalityFeedbackStore::get();
+  const auto row_count = [&](const auto& predicate) {
+    return feedback_store.adjust_statistics(*predicate, input, nullptr, predicate->derive_statistics_from(input))
+        ->row_count();
   };
 
-  if (std::is_sorted(predicates.begin(), predicates.end(), sort_predicate)) {
-    return false;
+  const auto sort_predicate = [&](auto& left, auto& right) { return row_count(left) > row_count(right); };
+
+  // The key of the input's subplan is looked up for every comparison, build it only once
+  {
+    const auto subplan_key_cache_scope = CardinalityFeedbackStore::ScopedSubplanKeyCache{};
+    if (std::is_sorted(predicates.begin(), predicates.end(), sort_predicate)) {
+      return false;
+    }
   }
 
   // Untie predicates from LQP, so we can freely retie them
@@ -75,7 +85,10 @@ bool PredicateReorderingRule::_reorder_predicates(std::vector<std::shared_ptr<Ab
   }
 
   // Sort in descending order
-  std::sort(predicates.begin(), predicates.end(), sort_predicate);
+  {
+    const auto subplan_key_cache_scope = CardinalityFeedbackStore::ScopedSubplanKeyCache{};
+    std::sort(predicates.begin(), predicates.end(), sort_predicate);
+  }
 
   // Ensure that nodes are chained correctly
   predicates.back()->set_left_input(input);
@@ -8,14 +8,43 @@
 #include "abstract_scheduler.hpp"
 #include "current_scheduler.hpp"
 #include "task_queue.hpp"
+#include "utils/cancellation_token.hpp"
+#include "utils/memory_arena.hpp"
+#include "utils/memory_tracker.hpp"
+#include "utils/query_cancelled_exception.hpp"
 #include "utils/tracing/probes.hpp"
 #include "worker.hpp"
 
 #include "utils/assert.hpp"
 
+namespace {
+
+// The priority class of the Task that is currently executed by this thread
+thread_local auto current_task_query_priority = opossum::QueryPriority::Normal;
+
+// Tasks might be executed inline (e.g., without a Scheduler), so the class of the outer Task is restored afterwards
+struct CurrentQueryPriorityScope {
+  explicit CurrentQueryPriorityScope(const opossum::QueryPriority query_priority)
+      : outer_query_priority(current_task_query_priority) {
+    current_task_query_priority = query_priority;
+  }
+
+  ~CurrentQueryPriorityScope() { current_task_query_priority = outer_query_priority; }
+
+  const opossum::QueryPriority outer_query_priority;
+};
+
+}  // namespace
+
 namespace opossum {
 
-AbstractTask::AbstractTask(SchedulePriority priority, bool stealable) : _priority(priority), _stealable(stealable) {}
+AbstractTask::AbstractTask(SchedulePriority priority, bool stealable)
+    : _query_priority(current_task_query_priority),
+      _memory_tracker(MemoryTracker::current() ? MemoryTracker::current()->shared() : nullptr),
+      _memory_arena(MemoryArena::current() ? MemoryArena::current()->shared_from_this() : nullptr),
+      _cancellation_token(CancellationToken::current() ? CancellationToken::current()->shared_from_this() : nullptr),
+      _priority(priority),
+      _stealable(stealable) {}
 
 TaskID AbstractTask::id() const { return _id; }
 
@@ -49,6 +78,48 @@ const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() con
 
 void AbstractTask::set_node_id(NodeID node_id) { _node_id = node_id; }
 
+void AbstractTask::set_preferred_node_id(NodeID preferred_node_id) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the preferred node after the Task was scheduled");
+
+  _preferred_node_id = preferred_node_id;
+}
+
+NodeID AbstractTask::preferred_node_id() const { return _preferred_node_id; }
+
+void AbstractTask::set_query_priority(QueryPriority query_priority) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the query priority after the Task was scheduled");
+
+  _query_priority = query_priority;
+}
+
+QueryPriority AbstractTask::query_priority() const { return _query_priority; }
+
+QueryPriority AbstractTask::current_query_priority() { return current_task_query_priority; }
+
+void AbstractTask::set_memory_tracker(const std::shared_ptr<MemoryTracker>& memory_tracker) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the memory tracker after the Task was scheduled");
+
+  _memory_tracker = memory_tracker;
+}
+
+const std::shared_ptr<MemoryTracker>& AbstractTask::memory_tracker() const { return _memory_tracker; }
+
+void AbstractTask::set_memory_arena(const std::shared_ptr<MemoryArena>& memory_arena) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the memory arena after the Task was scheduled");
+
+  _memory_arena = memory_arena;
+}
+
+const std::shared_ptr<MemoryArena>& AbstractTask::memory_arena() const { return _memory_arena; }
+
+void AbstractTask::set_cancellation_token(const std::shared_ptr<CancellationToken>& cancellation_token) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the cancellation token after the Task was scheduled");
+
+  _cancellation_token = cancellation_token;
+}
+
+const std::shared_ptr<CancellationToken>& AbstractTask::cancellation_token() const { return _cancellation_token; }
+
 bool AbstractTask::try_mark_as_enqueued() { return !_is_enqueued.exchange(true); }
 
 void AbstractTask::set_done_callback(const std::function<void()>& done_callback) {
@@ -61,6 +132,7 @@ void AbstractTask::schedule(NodeID preferred_node_id) {
   _mark_as_scheduled();
 
   if (CurrentScheduler::is_set()) {
+    if (preferred_node_id == CURRENT_NODE_ID) preferred_node_id = _preferred_node_id;
     CurrentScheduler::get()->schedule(shared_from_this(), preferred_node_id, _priority);
   } else {
     // If the Task isn't ready, it will execute() once its dependency counter reaches 0
@@ -97,7 +169,24 @@ void AbstractTask::execute() {
   DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
-  _on_execute();
+  {
+    const auto query_priority_scope = CurrentQueryPriorityScope{_query_priority};
+    const auto scoped_memory_tracker = ScopedMemoryTracker{_memory_tracker};
+    const auto scoped_memory_arena = ScopedMemoryArena{_memory_arena};
+    const auto scoped_cancellation_token = ScopedCancellationToken{_cancellation_token};
+
+    // Exceptions cannot be propagated across Workers. Thus, a Task of a cancelled query (also of one that exceeded its
+    // memory limit, see MemoryLimitExceededException) just ends, and the thread waiting for it throws (see
+    // CurrentScheduler::wait_for_tasks).
+    if (!_cancellation_token || !_cancellation_token->is_cancelled()) {
+      try {
+        _on_execute();
+      } catch (const QueryCancelledException&) {
+        if (!_cancellation_token) throw;
+      }
+    }
+  }
+  _memory_arena.reset();
 
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
@@ -126,7 +215,11 @@ void AbstractTask::_on_predecessor_done() {
       auto worker = Worker::get_this_thread_worker();
       DebugAssert(static_cast<bool>(worker), "No worker");
 
-      worker->queue()->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::Highest));
+      // Enqueue the Task on its preferred node, if it has one, and on the node of the current worker otherwise
+      const auto& queues = CurrentScheduler::get()->queues();
+      const auto queue = static_cast<size_t>(_preferred_node_id) < queues.size() ? queues[_preferred_node_id]
+                                                                                  : worker->queue();
+      queue->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::Highest));
     } else {
       if (_is_scheduled) execute();
       // Otherwise it will get execute()d once it is scheduled. It is entirely possible for Tasks to "become ready"
@@ -12,6 +12,9 @@
 
 namespace opossum {
 
+class CancellationToken;
+class MemoryArena;
+class MemoryTracker;
 class Worker;
 
 /**
@@ -79,6 +82,50 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_node_id(NodeID node_id);
 
+  /**
+   * The node whose queue the Task is put into when it is scheduled (or becomes ready) without an explicit node, e.g.,
+   * the node owning the data the Task works on. Idle workers of other nodes may still steal the Task if it is
+   * stealable. Defaults to CURRENT_NODE_ID, i.e., the node of the scheduling worker.
+   */
+  void set_preferred_node_id(NodeID preferred_node_id);
+  NodeID preferred_node_id() const;
+
+  /**
+   * The priority class of the query the Task belongs to. Tasks inherit the class of the Task executing on the thread
+   * that created them, so JobTasks spawned by an operator share the class of its OperatorTask.
+   */
+  void set_query_priority(QueryPriority query_priority);
+  QueryPriority query_priority() const;
+
+  /**
+   * @return the priority class of the Task currently executed by the calling thread, QueryPriority::Normal if none
+   */
+  static QueryPriority current_query_priority();
+
+  /**
+   * The MemoryTracker that the allocations of the Task are accounted to. As the query priority, it is inherited from
+   * the Task executing on the thread that created the Task, and installed on the executing thread (see
+   * ScopedMemoryTracker).
+   */
+  void set_memory_tracker(const std::shared_ptr<MemoryTracker>& memory_tracker);
+  const std::shared_ptr<MemoryTracker>& memory_tracker() const;
+
+  /**
+   * The MemoryArena that the transient allocations of the Task are served from, inherited in the same way as the
+   * MemoryTracker. The Task releases its reference once it has been executed, so that the arena is freed as soon as
+   * the operator that owns it does not need it anymore.
+   */
+  void set_memory_arena(const std::shared_ptr<MemoryArena>& memory_arena);
+  const std::shared_ptr<MemoryArena>& memory_arena() const;
+
+  /**
+   * The CancellationToken of the query the Task belongs to, inherited in the same way as the MemoryTracker. Tasks of
+   * cancelled queries are not started. If the query is cancelled while the Task runs, the QueryCancelledException of
+   * the operator ends the Task. It is rethrown by CurrentScheduler::wait_for_tasks.
+   */
+  void set_cancellation_token(const std::shared_ptr<CancellationToken>& cancellation_token);
+  const std::shared_ptr<CancellationToken>& cancellation_token() const;
+
   /**
    * Callback to be executed right after the Task finished.
    * Notice the execution of the callback might happen on ANY thread
@@ -87,6 +134,7 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   /**
    * Schedules the task if a Scheduler is available, otherwise just executes it on the current Thread
+   * If no node is given, the preferred node of the Task is used
    */
   void schedule(NodeID preferred_node_id = CURRENT_NODE_ID);
 
@@ -135,6 +183,11 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   std::atomic<TaskID> _id{INVALID_TASK_ID};
   std::atomic<NodeID> _node_id = INVALID_NODE_ID;
+  NodeID _preferred_node_id = CURRENT_NODE_ID;
+  QueryPriority _query_priority;
+  std::shared_ptr<MemoryTracker> _memory_tracker;
+  std::shared_ptr<MemoryArena> _memory_arena;
+  std::shared_ptr<CancellationToken> _cancellation_token;
   SchedulePriority _priority;
   bool _stealable;
   std::atomic_bool _done{false};
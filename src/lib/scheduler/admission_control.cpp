@@ -0,0 +1,76 @@
+#include "admission_control.hpp"
+
+#include <memory>
+
+#include "worker.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AdmissionControl::ScopedAdmission::ScopedAdmission(QueryPriority query_priority) : _query_priority(query_priority) {
+  AdmissionControl::get().admit(_query_priority);
+}
+
+AdmissionControl::ScopedAdmission::~ScopedAdmission() { AdmissionControl::get().release(_query_priority); }
+
+AdmissionControl& AdmissionControl::get() {
+  static AdmissionControl instance;
+  return instance;
+}
+
+size_t AdmissionControl::max_concurrent_low_priority_queries() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _max_concurrent_low_priority_queries;
+}
+
+void AdmissionControl::set_max_concurrent_low_priority_queries(size_t max_concurrent_low_priority_queries) {
+  Assert(max_concurrent_low_priority_queries > 0, "At least one query has to be admitted");
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _max_concurrent_low_priority_queries = max_concurrent_low_priority_queries;
+  }
+  _condition_variable.notify_all();
+}
+
+void AdmissionControl::admit(QueryPriority query_priority) {
+  if (query_priority != QueryPriority::Low) return;
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  if (_running_low_priority_query_count >= _max_concurrent_low_priority_queries) {
+    // Do not block the processing unit while waiting, the admitted queries need workers to finish. The token is handed
+    // off once, spurious wake-ups and lost races for a free slot only go back to waiting.
+    if (auto worker = Worker::get_this_thread_worker()) worker->_yield_to_replacement_worker();
+
+    ++_waiting_low_priority_query_count;
+    while (_running_low_priority_query_count >= _max_concurrent_low_priority_queries) {
+      _condition_variable.wait(lock);
+    }
+    --_waiting_low_priority_query_count;
+  }
+  ++_running_low_priority_query_count;
+}
+
+void AdmissionControl::release(QueryPriority query_priority) {
+  if (query_priority != QueryPriority::Low) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    DebugAssert(_running_low_priority_query_count > 0, "Released more queries than were admitted");
+    --_running_low_priority_query_count;
+  }
+  _condition_variable.notify_one();
+}
+
+size_t AdmissionControl::running_low_priority_query_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _running_low_priority_query_count;
+}
+
+size_t AdmissionControl::waiting_low_priority_query_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _waiting_low_priority_query_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * The AdmissionControl is a singleton that caps the number of concurrently executing queries of the Low priority
+ * class. Such queries (e.g., reports) run long and spawn many tasks. Even though the TaskQueue prefers tasks of higher
+ * classes, too many of them running at the same time would still hold most workers and memory. Queries of the High and
+ * Normal classes are always admitted immediately.
+ *
+ * Usage:
+ *      {
+ *        const auto admission = AdmissionControl::ScopedAdmission{QueryPriority::Low};
+ *        // schedule and wait for the tasks of the query
+ *      }
+ *
+ * If a query has to wait for admission on a Worker (e.g., in a server task), the Worker hands off its active worker
+ * token first, so that the tasks of the admitted queries keep running.
+ */
+class AdmissionControl : private Noncopyable {
+ public:
+  static constexpr size_t DEFAULT_MAX_CONCURRENT_LOW_PRIORITY_QUERIES = 2;
+
+  // Admits a query on construction (blocking if necessary) and releases it on destruction
+  class ScopedAdmission : private Noncopyable {
+   public:
+    explicit ScopedAdmission(QueryPriority query_priority);
+    ~ScopedAdmission();
+
+   private:
+    const QueryPriority _query_priority;
+  };
+
+  static AdmissionControl& get();
+
+  size_t max_concurrent_low_priority_queries() const;
+  void set_max_concurrent_low_priority_queries(size_t max_concurrent_low_priority_queries);
+
+  // Blocks until a query of the given class may be executed
+  void admit(QueryPriority query_priority);
+
+  // Has to be called once an admitted query finished
+  void release(QueryPriority query_priority);
+
+  size_t running_low_priority_query_count() const;
+  size_t waiting_low_priority_query_count() const;
+
+ private:
+  AdmissionControl() = default;
+
+  mutable std::mutex _mutex;
+  std::condition_variable _condition_variable;
+  size_t _max_concurrent_low_priority_queries{DEFAULT_MAX_CONCURRENT_LOW_PRIORITY_QUERIES};
+  size_t _running_low_priority_query_count{0};
+  size_t _waiting_low_priority_query_count{0};
+};
+
+}  // namespace opossum
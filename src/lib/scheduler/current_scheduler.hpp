@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "utils/assert.hpp"
+#include "utils/cancellation_token.hpp"
 #include "utils/tracing/probes.hpp"
 #include "worker.hpp"
 
@@ -28,6 +29,7 @@ class CurrentScheduler {
   /**
    * If there is an active Scheduler, block execution until all @tasks have finished
    * If there is no active Scheduler, returns immediately since all @tasks have executed when they were scheduled
+   * Throws a QueryCancelledException if the query of one of the @tasks was cancelled
    */
   template <typename TaskType>
   static void wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
@@ -64,6 +66,16 @@ void CurrentScheduler::wait_for_tasks(const std::vector<std::shared_ptr<TaskType
   } else {
     for (auto& task : tasks) task->join();
   }
+
+  // Tasks of a cancelled query might not have been executed (completely), so their results must not be used. Usually,
+  // all tasks share the same token, so that it is only checked once.
+  auto checked_cancellation_token = static_cast<const CancellationToken*>(nullptr);
+  for (auto& task : tasks) {
+    const auto& cancellation_token = task->cancellation_token();
+    if (!cancellation_token || cancellation_token.get() == checked_cancellation_token) continue;
+    cancellation_token->check();
+    checked_cancellation_token = cancellation_token.get();
+  }
 }
 
 template <typename TaskType>
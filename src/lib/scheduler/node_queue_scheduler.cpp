@@ -102,8 +102,9 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   if (!task->is_ready()) return;
 
-  // Lookup node id for current worker.
-  if (preferred_node_id == CURRENT_NODE_ID) {
+  // Lookup node id for current worker. Tasks without a known node (e.g., for chunks without a home node) are treated
+  // the same way.
+  if (preferred_node_id == CURRENT_NODE_ID || preferred_node_id == INVALID_NODE_ID) {
     auto worker = Worker::get_this_thread_worker();
     if (worker) {
       preferred_node_id = worker->queue()->node_id();
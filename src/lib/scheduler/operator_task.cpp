@@ -8,6 +8,7 @@
 
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "operators/operator_pipeline.hpp"
 
 #include "scheduler/job_task.hpp"
 #include "scheduler/processing_unit.hpp"
@@ -24,30 +25,56 @@ std::string OperatorTask::description() const {
 }
 
 const std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_operator(
-    const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries) {
+    const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries,
+    UsePipelining use_pipelining) {
   std::vector<std::shared_ptr<OperatorTask>> tasks;
   std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>> task_by_op;
-  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, cleanup_temporaries);
+
+  std::unordered_map<std::shared_ptr<AbstractOperator>, size_t> consumer_counts;
+  if (use_pipelining == UsePipelining::Yes) {
+    // Visits each operator once, even in diamond shapes
+    const auto count_consumers = [&](const auto& self, const std::shared_ptr<AbstractOperator>& consumer) -> void {
+      for (const auto& input : {consumer->mutable_input_left(), consumer->mutable_input_right()}) {
+        if (input && consumer_counts[input]++ == 0) self(self, input);
+      }
+    };
+    count_consumers(count_consumers, op);
+  }
+
+  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, cleanup_temporaries, use_pipelining, consumer_counts);
   return tasks;
 }
 
 std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
     std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
     std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
-    CleanupTemporaries cleanup_temporaries) {
+    CleanupTemporaries cleanup_temporaries, UsePipelining use_pipelining,
+    const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts) {
   const auto task_by_op_it = task_by_op.find(op);
   if (task_by_op_it != task_by_op.end()) return task_by_op_it->second;
 
   const auto task = std::make_shared<OperatorTask>(op, cleanup_temporaries);
   task_by_op.emplace(op, task);
 
-  if (auto left = op->mutable_input_left()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, cleanup_temporaries);
+  // The task of a pipeline depends on the inputs of the pipeline's first operator
+  auto first_operator = op;
+  if (use_pipelining == UsePipelining::Yes) {
+    const auto pipeline_operators = _find_pipeline(op, consumer_counts);
+    if (pipeline_operators.size() > 1) {
+      task->_pipeline = std::make_shared<OperatorPipeline>(pipeline_operators);
+      first_operator = pipeline_operators.front();
+    }
+  }
+
+  if (auto left = first_operator->mutable_input_left()) {
+    auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, cleanup_temporaries,
+                                                               use_pipelining, consumer_counts);
     subtree_root->set_as_predecessor_of(task);
   }
 
-  if (auto right = op->mutable_input_right()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, cleanup_temporaries);
+  if (auto right = first_operator->mutable_input_right()) {
+    auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, cleanup_temporaries,
+                                                               use_pipelining, consumer_counts);
     subtree_root->set_as_predecessor_of(task);
   }
 
@@ -57,8 +84,29 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
   return task;
 }
 
+std::vector<std::shared_ptr<AbstractOperator>> OperatorTask::_find_pipeline(
+    const std::shared_ptr<AbstractOperator>& op,
+    const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts) {
+  auto pipeline_operators = std::vector<std::shared_ptr<AbstractOperator>>{};
+
+  // Extend the pipeline downwards as long as the input is no pipeline breaker, has an input itself, and is not
+  // consumed by another operator
+  auto current = op;
+  while (!current->is_pipeline_breaker() && current->input_left() && !current->input_right()) {
+    pipeline_operators.insert(pipeline_operators.begin(), current);
+
+    auto input = current->mutable_input_left();
+    if (!input->input_left() || consumer_counts.at(input) > 1) break;
+    current = input;
+  }
+
+  return pipeline_operators;
+}
+
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
+const std::shared_ptr<OperatorPipeline>& OperatorTask::get_pipeline() const { return _pipeline; }
+
 void OperatorTask::_on_execute() {
   auto context = _op->transaction_context();
   if (context) {
@@ -84,7 +132,11 @@ void OperatorTask::_on_execute() {
   }
 
   DTRACE_PROBE2(HYRISE, OPERATOR_TASKS, reinterpret_cast<uintptr_t>(_op.get()), reinterpret_cast<uintptr_t>(this));
-  _op->execute();
+  if (_pipeline) {
+    _pipeline->execute();
+  } else {
+    _op->execute();
+  }
 
   /**
    * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
@@ -9,6 +9,7 @@
 namespace opossum {
 
 class AbstractOperator;
+class OperatorPipeline;
 
 /**
  * Makes an AbstractOperator scheduleable
@@ -21,12 +22,18 @@ class OperatorTask : public AbstractTask {
 
   /**
    * Create tasks recursively from result operator and set task dependencies automatically.
+   * With pipelining, each chain of operators that are no pipeline breakers is executed by a single task as an
+   * OperatorPipeline, i.e., chunk by chunk. The task of such a chain holds its last operator.
    */
   static const std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operator(
-      const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries);
+      const std::shared_ptr<AbstractOperator>& op, CleanupTemporaries cleanup_temporaries,
+      UsePipelining use_pipelining = UsePipelining::No);
 
   const std::shared_ptr<AbstractOperator>& get_operator() const;
 
+  // The pipeline executed instead of the operator alone, nullptr if the task executes only its operator
+  const std::shared_ptr<OperatorPipeline>& get_pipeline() const;
+
   std::string description() const override;
 
  protected:
@@ -35,14 +42,23 @@ class OperatorTask : public AbstractTask {
   /**
    * Create tasks recursively. Called by `make_tasks_from_operator`. Returns the root of the subtree that was added.
    * @param task_by_op  Cache to avoid creating duplicate Tasks for diamond shapes
+   * @param consumer_counts  Number of consumers of each operator, only set when pipelining. Operators with more than
+   *                         one consumer end a pipeline, as their complete output is needed.
    */
   static std::shared_ptr<OperatorTask> _add_tasks_from_operator(
       std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
       std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
-      CleanupTemporaries cleanup_temporaries);
+      CleanupTemporaries cleanup_temporaries, UsePipelining use_pipelining,
+      const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts);
+
+  // Returns the operators of the pipeline ending with @param op, from bottom to top
+  static std::vector<std::shared_ptr<AbstractOperator>> _find_pipeline(
+      const std::shared_ptr<AbstractOperator>& op,
+      const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_counts);
 
  private:
   std::shared_ptr<AbstractOperator> _op;
+  std::shared_ptr<OperatorPipeline> _pipeline;
   CleanupTemporaries _cleanup_temporaries;
 };
 }  // namespace opossum
@@ -39,8 +39,8 @@ bool ProcessingUnit::try_acquire_active_worker_token(WorkerID worker_id) {
   return no_one_active;
 }
 
-void ProcessingUnit::yield_active_worker_token(WorkerID worker_id) {
-  _active_worker_token.compare_exchange_strong(worker_id, INVALID_WORKER_ID);
+bool ProcessingUnit::yield_active_worker_token(WorkerID worker_id) {
+  return _active_worker_token.compare_exchange_strong(worker_id, INVALID_WORKER_ID);
 }
 
 void ProcessingUnit::hibernate_calling_worker() {
@@ -36,8 +36,9 @@ class ProcessingUnit final : public std::enable_shared_from_this<ProcessingUnit>
    * If @worker_id owns the active worker token, it yields it, otherwise nothing happens.
    * It's okay for Workers to call this without actually owning the token, think of Tasks waiting for multiple
    * batches of jobs.
+   * @return whether @worker_id owned the token
    */
-  void yield_active_worker_token(WorkerID worker_id);
+  bool yield_active_worker_token(WorkerID worker_id);
 
   /**
    * Put the Worker into hibernation state, which means it will only wake up when the Scheduler is shutting down or
@@ -1,5 +1,7 @@
 #include "task_queue.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <utility>
 
@@ -21,21 +23,58 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
-  _queues[priority].push(task);
+  _queues[static_cast<uint32_t>(task->query_priority())][query_lane(*task)][priority].push(task);
 
   _num_tasks++;
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull(SchedulePriority min_priority) {
+  for (const auto query_priority : _next_query_priority_order()) {
+    if (auto task = _pull_round_robin(query_priority, min_priority, false)) return task;
+  }
+  return nullptr;
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::steal() {
+  for (const auto query_priority : _next_query_priority_order()) {
+    if (auto task = _pull_round_robin(query_priority, SchedulePriority::Lowest, true)) return task;
+  }
+  return nullptr;
+}
+
+uint32_t TaskQueue::query_lane(const AbstractTask& task) {
+  // The addresses of the tokens are aligned, so their low bits are useless as a hash. Fibonacci hashing mixes all bits.
+  const auto query_id = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(task.cancellation_token().get()));
+  return static_cast<uint32_t>((query_id * 0x9E3779B97F4A7C15ull) >> 32u) % NUM_QUERY_LANES;
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::_pull_round_robin(QueryPriority query_priority, SchedulePriority min_priority,
+                                                           bool stealable_only) {
+  auto& lanes = _queues[static_cast<uint32_t>(query_priority)];
+  auto& next_lane = _next_lanes[static_cast<uint32_t>(query_priority)];
+  const auto first_lane = next_lane.load();
+
   std::shared_ptr<AbstractTask> task;
   for (auto priority :
        {SchedulePriority::JobTask, SchedulePriority::Highest, SchedulePriority::Default, SchedulePriority::Lowest}) {
     if (priority > min_priority) {
       break;
     }
-    auto& queue = _queues[static_cast<uint32_t>(priority)];
 
-    if (queue.try_pop(task)) {
+    for (auto lane_offset = uint32_t{0}; lane_offset < NUM_QUERY_LANES; ++lane_offset) {
+      const auto lane = (first_lane + lane_offset) % NUM_QUERY_LANES;
+      auto& queue = lanes[lane][static_cast<uint32_t>(priority)];
+
+      if (!queue.try_pop(task)) continue;
+
+      if (stealable_only && !task->is_stealable()) {
+        queue.push(task);
+        continue;
+      }
+
+      // The next pull of this class starts with the lane after this one. Concurrent pulls may overwrite each other
+      // here, which only shifts the rotation.
+      next_lane = (lane + 1) % NUM_QUERY_LANES;
       _num_tasks--;
       return task;
     }
@@ -43,22 +82,32 @@ std::shared_ptr<AbstractTask> TaskQueue::pull(SchedulePriority min_priority) {
   return nullptr;
 }
 
-std::shared_ptr<AbstractTask> TaskQueue::steal() {
-  std::shared_ptr<AbstractTask> task;
-  for (auto priority :
-       {SchedulePriority::JobTask, SchedulePriority::Highest, SchedulePriority::Default, SchedulePriority::Lowest}) {
-    auto& queue = _queues[static_cast<uint32_t>(priority)];
+std::array<QueryPriority, TaskQueue::NUM_QUERY_PRIORITIES> TaskQueue::_next_query_priority_order() {
+  // Only look at the counter if tasks of more than one class are queued, so that it advances by actual competition
+  auto non_empty_class_count = uint32_t{0};
+  for (const auto& lanes : _queues) {
+    const auto class_has_tasks = std::any_of(lanes.cbegin(), lanes.cend(), [](const auto& queues) {
+      return std::any_of(queues.cbegin(), queues.cend(), [](const auto& queue) { return !queue.empty(); });
+    });
+    if (class_has_tasks) ++non_empty_class_count;
+  }
+  if (non_empty_class_count <= 1) return {{QueryPriority::High, QueryPriority::Normal, QueryPriority::Low}};
 
-    if (queue.try_pop(task)) {
-      if (task->is_stealable()) {
-        _num_tasks--;
-        return task;
-      } else {
-        queue.push(task);
-      }
-    }
+  // Pick the preferred class, the remaining classes follow in the order of their priority
+  auto slot = _pull_counter++ % (QUERY_PRIORITY_WEIGHTS[0] + QUERY_PRIORITY_WEIGHTS[1] + QUERY_PRIORITY_WEIGHTS[2]);
+  auto preferred_class = uint32_t{0};
+  while (slot >= QUERY_PRIORITY_WEIGHTS[preferred_class]) {
+    slot -= QUERY_PRIORITY_WEIGHTS[preferred_class];
+    ++preferred_class;
   }
-  return nullptr;
+
+  auto order = std::array<QueryPriority, NUM_QUERY_PRIORITIES>{};
+  order[0] = static_cast<QueryPriority>(preferred_class);
+  auto order_index = size_t{1};
+  for (auto query_priority = uint32_t{0}; query_priority < NUM_QUERY_PRIORITIES; ++query_priority) {
+    if (query_priority != preferred_class) order[order_index++] = static_cast<QueryPriority>(query_priority);
+  }
+  return order;
 }
 
 }  // namespace opossum
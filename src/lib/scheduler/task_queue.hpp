@@ -14,10 +14,29 @@ class AbstractTask;
 
 /**
  * Holds a queue of AbstractTasks, usually one of these exists per node
+ *
+ * Tasks are queued by the priority class of their query (see QueryPriority) and, within a class, by their
+ * SchedulePriority. The classes share the workers in a weighted round robin: out of every
+ * sum(QUERY_PRIORITY_WEIGHTS) pulls, QUERY_PRIORITY_WEIGHTS[c] prefer tasks of class c. If there is no task of the
+ * preferred class, the highest class with a task is used instead, so no worker idles while there is work.
+ *
+ * Within a class, the queries take turns as well: each class is split into NUM_QUERY_LANES lanes, a query's tasks all
+ * go to the lane picked by query_lane(), and consecutive pulls of a class start at the lane after the one served
+ * last. Thus, a query that floods the queue with jobs does not hold back the other queries of its class. Queries
+ * that share a lane are still served in FIFO order among each other.
  */
 class TaskQueue {
  public:
   static constexpr uint32_t NUM_PRIORITY_LEVELS = 4;
+  static constexpr uint32_t NUM_QUERY_PRIORITIES = 3;
+  static constexpr std::array<uint32_t, NUM_QUERY_PRIORITIES> QUERY_PRIORITY_WEIGHTS{{8, 4, 1}};
+  static constexpr uint32_t NUM_QUERY_LANES = 4;
+
+  /**
+   * Returns the lane of the task's query within its class. Tasks of the same query share its CancellationToken, tasks
+   * without one all use lane 0.
+   */
+  static uint32_t query_lane(const AbstractTask& task);
 
   explicit TaskQueue(NodeID node_id);
 
@@ -40,9 +59,20 @@ class TaskQueue {
   std::shared_ptr<AbstractTask> steal();
 
  private:
+  // Returns the order in which the classes are checked by the next pull() or steal()
+  std::array<QueryPriority, NUM_QUERY_PRIORITIES> _next_query_priority_order();
+
+  // Pops the next task of a class, going through the lanes round robin. Non-stealable tasks are skipped if requested.
+  std::shared_ptr<AbstractTask> _pull_round_robin(QueryPriority query_priority, SchedulePriority min_priority,
+                                                  bool stealable_only);
+
+  using LaneQueues = std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS>;
+
   NodeID _node_id;
-  std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+  std::array<std::array<LaneQueues, NUM_QUERY_LANES>, NUM_QUERY_PRIORITIES> _queues;
+  std::array<std::atomic_uint, NUM_QUERY_PRIORITIES> _next_lanes{};
   std::atomic_uint _num_tasks{0};
+  std::atomic_uint _pull_counter{0};
 };
 
 }  // namespace opossum
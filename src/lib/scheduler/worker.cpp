@@ -110,6 +110,14 @@ void Worker::operator()() {
   processing_unit->yield_active_worker_token(_id);
 }
 
+void Worker::_yield_to_replacement_worker() {
+  auto processing_unit = _processing_unit.lock();
+  DebugAssert(static_cast<bool>(processing_unit), "Bug: Locking the processing unit failed");
+
+  // A worker that already handed off its token (e.g., while waiting for admission) has no core left to hand over
+  if (processing_unit->yield_active_worker_token(_id)) processing_unit->wake_or_create_worker();
+}
+
 void Worker::_set_affinity() {
 #if HYRISE_NUMA_SUPPORT
   cpu_set_t cpuset;
@@ -17,6 +17,7 @@ class TaskQueue;
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class AbstractTask;
+  friend class AdmissionControl;
   friend class CurrentScheduler;
   friend class NodeQueueScheduler;
 
@@ -46,17 +47,19 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
      * This method blocks the calling thread (worker) until all tasks have been completed.
      * It hands off the active worker token so that another worker can execute tasks while the calling worker is blocked.
      */
-    auto processing_unit = _processing_unit.lock();
-    DebugAssert(static_cast<bool>(processing_unit), "Bug: Locking the processing unit failed");
-
-    processing_unit->yield_active_worker_token(_id);
-    processing_unit->wake_or_create_worker();
+    _yield_to_replacement_worker();
 
     for (auto& task : tasks) {
       task->_join_without_replacement_worker();
     }
   }
 
+  /**
+   * Hands off the active worker token before the calling worker blocks, so that another worker can execute tasks in
+   * the meantime. Does nothing if the calling worker does not hold the token.
+   */
+  void _yield_to_replacement_worker();
+
  private:
   /**
    * Pin a worker to a particular core.
@@ -22,11 +22,8 @@ boost::future<uint32_t> ClientConnection::receive_startup_packet_header() {
   return _receive_bytes_async(STARTUP_HEADER_LENGTH) >> then >> PostgresWireHandler::handle_startup_package;
 }
 
-boost::future<void> ClientConnection::receive_startup_packet_body(uint32_t size) {
-  return _receive_bytes_async(size) >> then >> [](InputPacket p) {
-    // Read these values and ignore them
-    PostgresWireHandler::handle_startup_package_content(p);
-  };
+boost::future<StartupParameters> ClientConnection::receive_startup_packet_body(uint32_t size) {
+  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_startup_package_content;
 }
 
 boost::future<RequestHeader> ClientConnection::receive_packet_header() {
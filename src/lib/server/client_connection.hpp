@@ -4,10 +4,13 @@
 #include <boost/thread/future.hpp>
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 namespace opossum {
 
 using ByteBuffer = std::vector<char>;
+using StartupParameters = std::unordered_map<std::string, std::string>;
 struct InputPacket;
 struct OutputPacket;
 struct RequestHeader;
@@ -29,7 +32,7 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
   explicit ClientConnection(boost::asio::ip::tcp::socket socket);
 
   boost::future<uint32_t> receive_startup_packet_header();
-  boost::future<void> receive_startup_packet_body(uint32_t size);
+  boost::future<StartupParameters> receive_startup_packet_body(uint32_t size);
 
   boost::future<RequestHeader> receive_packet_header();
   boost::future<std::string> receive_simple_query_packet_body(uint32_t size);
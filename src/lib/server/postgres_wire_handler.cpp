@@ -32,9 +32,15 @@ uint32_t PostgresWireHandler::handle_startup_package(const InputPacket& packet)
   }
 }
 
-void PostgresWireHandler::handle_startup_package_content(const InputPacket& packet) {
-  // Ignore the content, because we don't care about the variables that were passed in.
-  read_values<char>(packet, packet.data.size());
+StartupParameters PostgresWireHandler::handle_startup_package_content(const InputPacket& packet) {
+  // The content is a list of null-terminated parameter names and values, terminated by an empty name
+  StartupParameters parameters;
+  while (packet.offset != packet.data.cend()) {
+    auto name = read_string(packet);
+    if (name.empty()) break;
+    parameters[std::move(name)] = read_string(packet);
+  }
+  return parameters;
 }
 
 RequestHeader PostgresWireHandler::handle_header(const InputPacket& packet) {
@@ -3,6 +3,7 @@
 #include <arpa/inet.h>
 #include <algorithm>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "SQLParserResult.h"
@@ -29,6 +30,9 @@ struct OutputPacket {
   ByteBuffer data;
 };
 
+// The parameters (e.g., user, database) a client passes in its startup packet
+using StartupParameters = std::unordered_map<std::string, std::string>;
+
 struct RequestHeader {
   NetworkMessageType message_type;
   uint32_t payload_length;
@@ -51,7 +55,7 @@ class PostgresWireHandler {
   static void write_output_packet_size(OutputPacket& packet);
 
   static uint32_t handle_startup_package(const InputPacket& packet);
-  static void handle_startup_package_content(const InputPacket& packet);
+  static StartupParameters handle_startup_package_content(const InputPacket& packet);
 
   static RequestHeader handle_header(const InputPacket& packet);
 
@@ -44,6 +44,9 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::start() {
         } catch (const std::exception& e) {
           std::cerr << e.what() << std::endl;
         }
+
+        // Abort the queries of the session that are still queued or running
+        self->_cancellation_token->cancel();
       });
 }
 
@@ -56,13 +59,54 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_perform_sessio
     }
 
     return _connection->receive_startup_packet_body(startup_packet_length) >> then >>
-           [=]() { return _connection->send_auth(); } >> then >>
+           [=](StartupParameters startup_parameters) {
+             _set_query_priority(startup_parameters);
+             _set_statement_timeout(startup_parameters);
+             return _connection->send_auth();
+           } >> then >>
            // We need to provide some random server version > 9 here, because some clients require it.
            [=]() { return _connection->send_parameter_status("server_version", "9.5"); } >> then >>
            [=]() { return _connection->send_ready_for_query(); };
   };
 }
 
+template <typename TConnection, typename TTaskRunner>
+void ServerSessionImpl<TConnection, TTaskRunner>::_set_query_priority(const StartupParameters& startup_parameters) {
+  const auto parameter_it = startup_parameters.find("query_priority");
+  if (parameter_it == startup_parameters.end()) return;
+
+  const auto& query_priority = parameter_it->second;
+  if (query_priority == "high") {
+    _query_priority = QueryPriority::High;
+  } else if (query_priority == "normal") {
+    _query_priority = QueryPriority::Normal;
+  } else if (query_priority == "low") {
+    _query_priority = QueryPriority::Low;
+  } else {
+    Fail("Unknown query_priority '" + query_priority + "', expected high, normal, or low.");
+  }
+}
+
+template <typename TConnection, typename TTaskRunner>
+void ServerSessionImpl<TConnection, TTaskRunner>::_set_statement_timeout(const StartupParameters& startup_parameters) {
+  const auto parameter_it = startup_parameters.find("statement_timeout");
+  if (parameter_it == startup_parameters.end()) return;
+
+  auto statement_timeout_ms = int64_t{0};
+  try {
+    statement_timeout_ms = std::stoll(parameter_it->second);
+  } catch (const std::exception&) {
+    Fail("Invalid statement_timeout '" + parameter_it->second + "', expected a number of milliseconds.");
+  }
+  Assert(statement_timeout_ms >= 0, "The statement_timeout must not be negative.");
+
+  if (statement_timeout_ms == 0) {
+    _statement_timeout.reset();
+  } else {
+    _statement_timeout = std::chrono::milliseconds{statement_timeout_ms};
+  }
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_requests() {
   auto process_command = [=](RequestHeader request) {
@@ -173,17 +217,17 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_query_command(const std::string& sql) {
   auto create_sql_pipeline = [=]() {
-    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true));
+    return _task_runner->dispatch_server_task(_make_task<CreatePipelineTask>(sql, true, _statement_timeout));
   };
 
   auto load_table_file = [=](std::string& file_name, std::string& table_name) {
-    auto task = std::make_shared<LoadServerFileTask>(file_name, table_name);
+    auto task = _make_task<LoadServerFileTask>(file_name, table_name);
     return _task_runner->dispatch_server_task(task) >> then >>
            [=]() { return _connection->send_notice("Successfully loaded " + table_name); };
   };
 
   auto execute_sql_pipeline = [=](std::shared_ptr<SQLPipeline> sql_pipeline) {
-    auto task = std::make_shared<ExecuteServerQueryTask>(sql_pipeline);
+    auto task = _make_task<ExecuteServerQueryTask>(sql_pipeline);
     return _task_runner->dispatch_server_task(task) >> then >> [=]() { return sql_pipeline; };
   };
 
@@ -215,7 +259,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_parse_c
     _prepared_statements.erase(statement_it);
   }
 
-  return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(parse_info.query)) >> then >>
+  auto task = _make_task<CreatePipelineTask>(parse_info.query, false, _statement_timeout);
+  return _task_runner->dispatch_server_task(task) >> then >>
          [=](std::unique_ptr<CreatePipelineResult> result) {
            // We know that SQLPipeline is set because the load table command is not allowed in this context
            _prepared_statements.insert(std::make_pair(prepared_statement_name, result->sql_pipeline));
@@ -244,7 +289,7 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_co
 
   auto statement_type = sql_pipeline->get_parsed_sql_statements().front()->getStatements().front()->type();
 
-  auto task = std::make_shared<BindServerPreparedStatementTask>(sql_pipeline, packet.params);
+  auto task = _make_task<BindServerPreparedStatementTask>(sql_pipeline, packet.params);
   return _task_runner->dispatch_server_task(task) >> then >>
          [=](std::unique_ptr<SQLQueryPlan> query_plan) {
            std::shared_ptr<SQLQueryPlan> shared_query_plan = std::move(query_plan);
@@ -292,7 +337,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
 
   query_plan->set_transaction_context(_transaction);
 
-  return _task_runner->dispatch_server_task(std::make_shared<ExecuteServerPreparedStatementTask>(query_plan)) >> then >>
+  auto task = _make_task<ExecuteServerPreparedStatementTask>(query_plan, _statement_timeout);
+  return _task_runner->dispatch_server_task(task) >> then >>
          [=](std::shared_ptr<const Table> result_table) {
            // The behavior is a little different compared to SimpleQueryCommand: Send a 'No Data' response
            if (!result_table)
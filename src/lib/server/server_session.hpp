@@ -4,13 +4,17 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/thread/future.hpp>
 
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <utility>
 
 #include "client_connection.hpp"
 #include "postgres_wire_handler.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "task_runner.hpp"
 #include "types.hpp"
+#include "utils/cancellation_token.hpp"
 
 namespace opossum {
 
@@ -25,6 +29,24 @@ class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<
  protected:
   boost::future<void> _perform_session_startup();
 
+  // Reads the priority class of the session's queries from the "query_priority" startup parameter (high, normal, or
+  // low). Sessions without it use QueryPriority::Normal.
+  void _set_query_priority(const StartupParameters& startup_parameters);
+
+  // Reads the statement timeout of the session in milliseconds from the "statement_timeout" startup parameter. Sessions
+  // without it (or with a timeout of zero, as in PostgreSQL) do not limit the execution time of their statements.
+  void _set_statement_timeout(const StartupParameters& startup_parameters);
+
+  // Creates a server task that belongs to the priority class of the session and that is cancelled when the session
+  // ends. The tasks of the queries it executes inherit both.
+  template <typename TTask, typename... Args>
+  std::shared_ptr<TTask> _make_task(Args&&... args) const {
+    auto task = std::make_shared<TTask>(std::forward<Args>(args)...);
+    task->set_query_priority(_query_priority);
+    task->set_cancellation_token(_cancellation_token);
+    return task;
+  }
+
   boost::future<void> _handle_client_requests();
   boost::future<void> _handle_simple_query_command(const std::string& sql);
   boost::future<void> _handle_parse_command(const ParsePacket& parse_info);
@@ -39,6 +61,10 @@ class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<
   std::shared_ptr<TConnection> _connection;
   std::shared_ptr<TTaskRunner> _task_runner;
 
+  QueryPriority _query_priority{QueryPriority::Normal};
+  std::optional<std::chrono::milliseconds> _statement_timeout;
+  const std::shared_ptr<CancellationToken> _cancellation_token = std::make_shared<CancellationToken>();
+
   std::shared_ptr<TransactionContext> _transaction;
   std::unordered_map<std::string, std::shared_ptr<SQLPipeline>> _prepared_statements;
   // TODO(lawben): The type of _portals will change when prepared statements are supported in the SQLPipeline
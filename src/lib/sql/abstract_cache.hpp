@@ -27,6 +27,9 @@ class AbstractCache {
   // Returns true if the cache holds an item at the given key.
   virtual bool has(const Key& key) const = 0;
 
+  // Removes the item at the given key, if the cache holds one.
+  virtual void remove(const Key& key) = 0;
+
   // Returns the number of elements currently held in the cache.
   virtual size_t size() const = 0;
 
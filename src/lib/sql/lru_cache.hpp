@@ -45,6 +45,14 @@ class LRUCache : public AbstractCache<Key, Value> {
 
   bool has(const Key& key) const { return _map.find(key) != _map.end(); }
 
+  void remove(const Key& key) {
+    auto it = _map.find(key);
+    if (it == _map.end()) return;
+
+    _list.erase(it->second);
+    _map.erase(it);
+  }
+
   // Returns the underlying list of all elements in the cache.
   std::list<KeyValuePair>& list() { return _list; }
 
@@ -99,6 +99,14 @@ class LRUKCache : public AbstractCache<Key, Value> {
 
   bool has(const Key& key) const { return _map.find(key) != _map.end(); }
 
+  void remove(const Key& key) {
+    auto it = _map.find(key);
+    if (it == _map.end()) return;
+
+    _queue.erase(it->second);
+    _map.erase(it);
+  }
+
   size_t size() const { return _map.size(); }
 
   void clear() {
@@ -53,6 +53,20 @@ class RandomCache : public AbstractCache<Key, Value> {
 
   bool has(const Key& key) const { return _map.find(key) != _map.end(); }
 
+  void remove(const Key& key) {
+    auto it = _map.find(key);
+    if (it == _map.end()) return;
+
+    // Move the last element into the gap so that the indices of all other elements stay valid.
+    const auto index = it->second;
+    _map.erase(it);
+    if (index + 1 < _list.size()) {
+      _list[index] = std::move(_list.back());
+      _map[_list[index].first] = index;
+    }
+    _list.pop_back();
+  }
+
   size_t size() const { return _map.size(); }
 
   void clear() {
@@ -16,8 +16,14 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
                          const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
                          const std::shared_ptr<Optimizer>& optimizer,
                          const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                         const CleanupTemporaries cleanup_temporaries)
-    : _transaction_context(transaction_context), _optimizer(optimizer) {
+                         const CleanupTemporaries cleanup_temporaries, const UsePipelining use_pipelining,
+                         const QueryPriority query_priority, const std::optional<size_t>& operator_memory_budget,
+                         const std::optional<size_t>& memory_limit,
+                         const std::shared_ptr<const CancellationToken>& cancellation_token,
+                         const std::optional<std::chrono::milliseconds>& statement_timeout)
+    : _transaction_context(transaction_context),
+      _optimizer(optimizer),
+      _cancellation_token(std::make_shared<CancellationToken>(cancellation_token)) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
   DebugAssert(!_transaction_context || use_mvcc == UseMvcc::Yes,
@@ -76,7 +82,8 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
 
     auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
         statement_string, std::move(parsed_statement), use_mvcc, transaction_context, lqp_translator, optimizer,
-        prepared_statements, cleanup_temporaries);
+        prepared_statements, cleanup_temporaries, use_pipelining, query_priority, operator_memory_budget,
+        memory_limit, _cancellation_token, statement_timeout);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -234,6 +241,8 @@ const SQLPipelineMetrics& SQLPipeline::metrics() {
   return _metrics;
 }
 
+const std::shared_ptr<CancellationToken>& SQLPipeline::cancellation_token() const { return _cancellation_token; }
+
 std::string SQLPipelineMetrics::to_string() const {
   auto total_translate_micros = std::chrono::microseconds::zero();
   auto total_optimize_micros = std::chrono::microseconds::zero();
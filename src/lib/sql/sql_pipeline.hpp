@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
 
 #include "SQLParserResult.h"
 #include "concurrency/transaction_context.hpp"
@@ -46,7 +48,11 @@ class SQLPipeline : public Noncopyable {
   SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
               const std::shared_ptr<LQPTranslator>& lqp_translator, const std::shared_ptr<Optimizer>& optimizer,
               const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-              const CleanupTemporaries cleanup_temporaries);
+              const CleanupTemporaries cleanup_temporaries, const UsePipelining use_pipelining,
+              const QueryPriority query_priority, const std::optional<size_t>& operator_memory_budget,
+              const std::optional<size_t>& memory_limit,
+              const std::shared_ptr<const CancellationToken>& cancellation_token,
+              const std::optional<std::chrono::milliseconds>& statement_timeout);
 
   // Returns the SQL string for each statement.
   const std::vector<std::string>& get_sql_strings();
@@ -87,11 +93,16 @@ class SQLPipeline : public Noncopyable {
 
   const SQLPipelineMetrics& metrics();
 
+  // Cancels the execution of all statements of the pipeline, e.g., from another thread. It is a child of the token
+  // passed to the SQLPipelineBuilder, if any.
+  const std::shared_ptr<CancellationToken>& cancellation_token() const;
+
  private:
   std::vector<std::shared_ptr<SQLPipelineStatement>> _sql_pipeline_statements;
 
   const std::shared_ptr<TransactionContext> _transaction_context;
   const std::shared_ptr<Optimizer> _optimizer;
+  const std::shared_ptr<CancellationToken> _cancellation_token;
 
   // Execution results
   std::vector<std::string> _sql_strings;
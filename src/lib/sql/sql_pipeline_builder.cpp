@@ -1,9 +1,14 @@
 #include "sql_pipeline_builder.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "utils/cancellation_token.hpp"
 #include "utils/tracing/probes.hpp"
 
 namespace opossum {
 
-SQLPipelineBuilder::SQLPipelineBuilder(const std::string& sql) : _sql(sql) {}
+SQLPipelineBuilder::SQLPipelineBuilder(const std::string& sql)
+    : _sql(sql),
+      _query_priority(AbstractTask::current_query_priority()),
+      _cancellation_token(CancellationToken::current() ? CancellationToken::current()->shared_from_this() : nullptr) {}
 
 SQLPipelineBuilder& SQLPipelineBuilder::with_mvcc(const UseMvcc use_mvcc) {
   _use_mvcc = use_mvcc;
@@ -34,6 +39,32 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_transaction_context(
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_query_priority(const QueryPriority query_priority) {
+  _query_priority = query_priority;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_operator_memory_budget(const size_t operator_memory_budget) {
+  _operator_memory_budget = operator_memory_budget;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_memory_limit(const size_t memory_limit) {
+  _memory_limit = memory_limit;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_cancellation_token(
+    const std::shared_ptr<const CancellationToken>& cancellation_token) {
+  _cancellation_token = cancellation_token;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_statement_timeout(const std::chrono::milliseconds& statement_timeout) {
+  _statement_timeout = statement_timeout;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
@@ -41,12 +72,18 @@ SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_pipelining(const UsePipelining use_pipelining) {
+  _use_pipelining = use_pipelining;
+  return *this;
+}
+
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   DTRACE_PROBE1(HYRISE, CREATE_PIPELINE, reinterpret_cast<uintptr_t>(this));
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
   auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _prepared_statements,
-                              _cleanup_temporaries);
+                              _cleanup_temporaries, _use_pipelining, _query_priority, _operator_memory_budget,
+                              _memory_limit, _cancellation_token, _statement_timeout);
   DTRACE_PROBE3(HYRISE, PIPELINE_CREATION_DONE, pipeline.get_sql_strings().size(), _sql.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   return pipeline;
@@ -57,8 +94,20 @@ SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql,      std::move(parsed_sql), _use_mvcc,           _transaction_context, lqp_translator,
-          optimizer, _prepared_statements,  _cleanup_temporaries};
+  return {_sql,
+          std::move(parsed_sql),
+          _use_mvcc,
+          _transaction_context,
+          lqp_translator,
+          optimizer,
+          _prepared_statements,
+          _cleanup_temporaries,
+          _use_pipelining,
+          _query_priority,
+          _operator_memory_budget,
+          _memory_limit,
+          _cancellation_token,
+          _statement_timeout};
 }
 
 }  // namespace opossum
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
@@ -28,6 +30,12 @@ class Optimizer;
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer() is used.
  *  - No JIT operators
+ *  - No pipelining, i.e., operators are executed one after another
+ *  - The priority class of the task creating the pipeline (QueryPriority::Normal outside of the Scheduler)
+ *  - No memory budget for the operators
+ *  - No memory limit for the statements
+ *  - The CancellationToken of the task creating the pipeline, if any
+ *  - No statement timeout
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -42,6 +50,29 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_optimizer(const std::shared_ptr<Optimizer>& optimizer);
   SQLPipelineBuilder& with_prepared_statement_cache(const std::shared_ptr<PreparedStatementCache>& prepared_statements);
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
+  SQLPipelineBuilder& with_query_priority(const QueryPriority query_priority);
+
+  /*
+   * Memory budget (in bytes) of each memory-intensive operator of the query (see AbstractOperator::set_memory_budget)
+   */
+  SQLPipelineBuilder& with_operator_memory_budget(const size_t operator_memory_budget);
+
+  /*
+   * Memory limit (in bytes) of each statement of the query. An allocation that exceeds it aborts the statement with a
+   * MemoryLimitExceededException (see MemoryTracker).
+   */
+  SQLPipelineBuilder& with_memory_limit(const size_t memory_limit);
+
+  /*
+   * Cancelling the token aborts the execution of the pipeline (see CancellationToken)
+   */
+  SQLPipelineBuilder& with_cancellation_token(const std::shared_ptr<const CancellationToken>& cancellation_token);
+
+  /*
+   * Maximum execution time of each statement of the query. A statement that exceeds it is aborted with a
+   * QueryCancelledException.
+   */
+  SQLPipelineBuilder& with_statement_timeout(const std::chrono::milliseconds& statement_timeout);
 
   /**
    * Short for with_mvcc(UseMvcc::No)
@@ -53,6 +84,11 @@ class SQLPipelineBuilder final {
    */
   SQLPipelineBuilder& dont_cleanup_temporaries();
 
+  /*
+   * Execute chains of operators that are no pipeline breakers chunk by chunk (see OperatorPipeline)
+   */
+  SQLPipelineBuilder& with_pipelining(const UsePipelining use_pipelining);
+
   SQLPipeline create_pipeline() const;
 
   /**
@@ -70,6 +106,12 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<PreparedStatementCache> _prepared_statements;
   CleanupTemporaries _cleanup_temporaries{true};
+  UsePipelining _use_pipelining{UsePipelining::No};
+  QueryPriority _query_priority;
+  std::optional<size_t> _operator_memory_budget;
+  std::optional<size_t> _memory_limit;
+  std::shared_ptr<const CancellationToken> _cancellation_token;
+  std::optional<std::chrono::milliseconds> _statement_timeout;
 };
 
 }  // namespace opossum
@@ -10,11 +10,14 @@
 #include "create_sql_parser_error_message.hpp"
 #include "expression/value_expression.hpp"
 #include "optimizer/optimizer.hpp"
+#include "scheduler/admission_control.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_query_plan.hpp"
 #include "sql/sql_translator.hpp"
+#include "statistics/cardinality_feedback_store.hpp"
 #include "utils/assert.hpp"
+#include "utils/query_cancelled_exception.hpp"
 #include "utils/tracing/probes.hpp"
 
 namespace opossum {
@@ -25,7 +28,12 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<LQPTranslator>& lqp_translator,
                                            const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                                           const CleanupTemporaries cleanup_temporaries)
+                                           const CleanupTemporaries cleanup_temporaries,
+                                           const UsePipelining use_pipelining, const QueryPriority query_priority,
+                                           const std::optional<size_t>& operator_memory_budget,
+                                           const std::optional<size_t>& memory_limit,
+                                           const std::shared_ptr<const CancellationToken>& cancellation_token,
+                                           const std::optional<std::chrono::milliseconds>& statement_timeout)
     : _sql_string(sql),
       _use_mvcc(use_mvcc),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
@@ -35,7 +43,13 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
       _prepared_statements(prepared_statements),
-      _cleanup_temporaries(cleanup_temporaries) {
+      _cleanup_temporaries(cleanup_temporaries),
+      _use_pipelining(use_pipelining),
+      _query_priority(query_priority),
+      _operator_memory_budget(operator_memory_budget),
+      _memory_tracker(MemoryTracker::create(memory_limit)),
+      _cancellation_token(std::make_shared<CancellationToken>(cancellation_token)),
+      _statement_timeout(statement_timeout) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
   DebugAssert(!_sql_string.empty(), "An SQLPipelineStatement should always contain a SQL statement string for caching");
@@ -242,7 +256,13 @@ const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_task
               "Physical query plan creation returned no or more than one plan for a single statement.");
 
   const auto& root = query_plan->tree_roots().front();
-  _tasks = OperatorTask::make_tasks_from_operator(root, _cleanup_temporaries);
+  _tasks = OperatorTask::make_tasks_from_operator(root, _cleanup_temporaries, _use_pipelining);
+  for (const auto& task : _tasks) {
+    task->set_query_priority(_query_priority);
+    task->get_operator()->set_memory_budget(_operator_memory_budget);
+    task->set_memory_tracker(_memory_tracker);
+    task->set_cancellation_token(_cancellation_token);
+  }
   return _tasks;
 }
 
@@ -266,7 +286,17 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
 
   DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
                 reinterpret_cast<uintptr_t>(this));
-  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  {
+    const auto admission = AdmissionControl::ScopedAdmission{_query_priority};
+    if (_statement_timeout) _cancellation_token->set_timeout(*_statement_timeout);
+
+    try {
+      CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+    } catch (const QueryCancelledException&) {
+      if (_auto_commit) _transaction_context->rollback();
+      throw;
+    }
+  }
 
   if (_auto_commit) {
     _transaction_context->commit();
@@ -274,11 +304,21 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
 
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics->execution_time_micros = std::chrono::duration_cast<std::chrono::microseconds>(done - started);
+  _metrics->peak_allocated_bytes = _memory_tracker->peak_bytes();
 
   // Get output from the last task
   _result_table = tasks.back()->get_operator()->get_output();
   if (_result_table == nullptr) _query_has_output = false;
 
+  // Feed the actual cardinalities back so that future optimizations of the same subplans can use them. Plans that were
+  // taken from the cache have no optimized LQP. If the cached plan of this statement was built on misestimations, it is
+  // evicted, so that the next execution is optimized with the recorded cardinalities.
+  if (_optimized_logical_plan) {
+    const auto misestimated =
+        CardinalityFeedbackStore::get().record_executed_plan(_optimized_logical_plan, *_lqp_translator);
+    if (misestimated) SQLQueryCache<SQLQueryPlan>::get().remove(_sql_string);
+  }
+
   DTRACE_PROBE8(HYRISE, SUMMARY, _sql_string.c_str(), _metrics->translate_time_micros.count(),
                 _metrics->optimize_time_micros.count(), _metrics->compile_time_micros.count(),
                 _metrics->execution_time_micros.count(), _metrics->query_plan_cache_hit, get_tasks().size(),
@@ -291,4 +331,11 @@ const std::shared_ptr<TransactionContext>& SQLPipelineStatement::transaction_con
 }
 
 const std::shared_ptr<SQLPipelineStatementMetrics>& SQLPipelineStatement::metrics() const { return _metrics; }
+
+const std::shared_ptr<MemoryTracker>& SQLPipelineStatement::memory_tracker() const { return _memory_tracker; }
+
+const std::shared_ptr<CancellationToken>& SQLPipelineStatement::cancellation_token() const {
+  return _cancellation_token;
+}
+
 }  // namespace opossum
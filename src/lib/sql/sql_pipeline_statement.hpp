@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
 #include <string>
 
 #include "SQLParserResult.h"
@@ -9,6 +11,8 @@
 #include "sql/sql_query_cache.hpp"
 #include "sql/sql_query_plan.hpp"
 #include "storage/table.hpp"
+#include "utils/cancellation_token.hpp"
+#include "utils/memory_tracker.hpp"
 
 namespace opossum {
 
@@ -22,6 +26,9 @@ struct SQLPipelineStatementMetrics {
   std::chrono::microseconds execution_time_micros{};
 
   bool query_plan_cache_hit = false;
+
+  // Maximum number of bytes allocated by the operators of the statement at the same time (see MemoryTracker)
+  size_t peak_allocated_bytes = 0;
 };
 
 /**
@@ -47,7 +54,11 @@ class SQLPipelineStatement : public Noncopyable {
                        const std::shared_ptr<LQPTranslator>& lqp_translator,
                        const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<PreparedStatementCache>& prepared_statements,
-                       const CleanupTemporaries cleanup_temporaries);
+                       const CleanupTemporaries cleanup_temporaries, const UsePipelining use_pipelining,
+                       const QueryPriority query_priority, const std::optional<size_t>& operator_memory_budget,
+                       const std::optional<size_t>& memory_limit,
+                       const std::shared_ptr<const CancellationToken>& cancellation_token,
+                       const std::optional<std::chrono::milliseconds>& statement_timeout);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -64,10 +75,16 @@ class SQLPipelineStatement : public Noncopyable {
   // For now, this always uses the optimized LQP.
   const std::shared_ptr<SQLQueryPlan>& get_query_plan();
 
-  // Returns all task sets that need to be executed for this query.
+  // Returns all task sets that need to be executed for this query. They belong to the priority class of the statement,
+  // their operators have the memory budget of the statement, their allocations are accounted to its MemoryTracker, and
+  // they are cancelled with its CancellationToken.
   const std::vector<std::shared_ptr<OperatorTask>>& get_tasks();
 
   // Executes all tasks, waits for them to finish, and returns the resulting table.
+  // Statements of the Low priority class wait for their admission by the AdmissionControl first.
+  // Throws a QueryCancelledException if the statement is cancelled or exceeds its timeout, and a
+  // MemoryLimitExceededException (a subclass of it) if the statement exceeds its memory limit. Auto-committed
+  // transactions are rolled back in these cases.
   const std::shared_ptr<const Table>& get_result_table();
 
   // Returns the TransactionContext that was either passed to or created by the SQLPipelineStatement.
@@ -76,6 +93,12 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<SQLPipelineStatementMetrics>& metrics() const;
 
+  // Accounts the memory allocated by the operators of the statement and enforces its memory limit
+  const std::shared_ptr<MemoryTracker>& memory_tracker() const;
+
+  // Cancels the execution of the statement. It is a child of the token of the SQLPipeline, if any.
+  const std::shared_ptr<CancellationToken>& cancellation_token() const;
+
  private:
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
@@ -108,6 +131,21 @@ class SQLPipelineStatement : public Noncopyable {
 
   // Delete temporary tables
   const CleanupTemporaries _cleanup_temporaries;
+
+  // Execute chains of operators that are no pipeline breakers chunk by chunk
+  const UsePipelining _use_pipelining;
+
+  const QueryPriority _query_priority;
+
+  // See AbstractOperator::set_memory_budget
+  const std::optional<size_t> _operator_memory_budget;
+
+  const std::shared_ptr<MemoryTracker> _memory_tracker;
+
+  const std::shared_ptr<CancellationToken> _cancellation_token;
+
+  // Starts once the tasks of the statement are scheduled
+  const std::optional<std::chrono::milliseconds> _statement_timeout;
 };
 
 }  // namespace opossum
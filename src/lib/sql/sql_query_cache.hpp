@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -15,13 +18,33 @@ namespace opossum {
 
 inline constexpr size_t DefaultCacheCapacity = 1024;
 
+// The capacity is split into at most MaxCacheShardCount shards that hold at least MinCacheShardCapacity entries each.
+// Thus, small caches consist of a single shard and show exactly the behavior of the underlying replacement policy.
+inline constexpr size_t MaxCacheShardCount = 16;
+inline constexpr size_t MinCacheShardCapacity = 64;
+
+struct SQLQueryCacheStatistics {
+  size_t hits{0};
+  size_t misses{0};
+  size_t evictions{0};
+};
+
 // Cache that stores instances of SQLParserResult.
 // Per-default, uses the GDFS cache as underlying storage.
+//
+// The underlying caches are not thread-safe. Instead of guarding a single cache with one mutex, which becomes a point
+// of contention if many sessions run short statements concurrently, the keys are hash-partitioned over several shards.
+// Each shard is an independent cache with its own replacement policy and its own mutex. The statistics are kept in
+// atomic counters.
+//
+// clear() may be called concurrently to the other operations. resize() and replace_cache_impl() re-create the shards
+// and must not run concurrently to them.
 template <typename Value, typename Key = std::string>
 class SQLQueryCache {
  public:
-  explicit SQLQueryCache(size_t capacity = DefaultCacheCapacity)
-      : _cache(std::move(std::make_unique<GDFSCache<Key, Value>>(capacity))) {}
+  explicit SQLQueryCache(size_t capacity = DefaultCacheCapacity) {
+    replace_cache_impl<GDFSCache<Key, Value>>(capacity);
+  }
 
   virtual ~SQLQueryCache() {}
 
@@ -32,56 +55,152 @@ class SQLQueryCache {
 
   // Adds or refreshes the cache entry [query, value].
   void set(const Key& query, const Value& value) {
-    if (_cache->capacity() == 0) return;
-
-    std::lock_guard<std::mutex> lock(_mutex);
-    _cache->set(query, value);
+    if (_capacity == 0) return;
+
+    auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    // The replacement policies do not report evictions. If a new entry does not increase the size, another one has
+    // been evicted.
+    const auto is_new_entry = !shard.cache->has(query);
+    const auto previous_size = shard.cache->size();
+    shard.cache->set(query, value);
+    if (is_new_entry && shard.cache->size() <= previous_size) {
+      _evictions.fetch_add(1, std::memory_order_relaxed);
+    }
   }
 
   // Tries to fetch the cache entry for the query into the result object.
   // Returns true if the entry was found, false otherwise.
   std::optional<Value> try_get(const Key& query) {
-    if (_cache->capacity() == 0) return {};
+    if (_capacity == 0) return {};
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (!_cache->has(query)) {
+    auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.cache->has(query)) {
+      _misses.fetch_add(1, std::memory_order_relaxed);
       return {};
     }
-    return _cache->get(query);
+    _hits.fetch_add(1, std::memory_order_relaxed);
+    return shard.cache->get(query);
   }
 
   // Checks whether an entry for the query exists.
-  bool has(const Key& query) const { return _cache->has(query); }
+  bool has(const Key& query) const {
+    const auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.cache->has(query);
+  }
+
+  // Removes the cache entry for the query, if it exists.
+  void remove(const Key& query) {
+    if (_capacity == 0) return;
+
+    auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.cache->remove(query);
+  }
 
   // Returns and refreshes the cache entry for the given query.
   // Causes undefined behavior if the query is not in the cache.
   Value get(const Key& query) {
-    std::lock_guard<std::mutex> lock(_mutex);
-    return _cache->get(query);
+    auto& shard = _shard(query);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    _hits.fetch_add(1, std::memory_order_relaxed);
+    return shard.cache->get(query);
   }
 
   // Purges all entries from the cache.
-  void clear() { _cache->clear(); }
+  void clear() {
+    for (auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->cache->clear();
+    }
+  }
 
-  void resize(size_t capacity) { _cache->resize(capacity); }
+  // Resizes the shards to the new capacity. If the number of shards changes, the cache is cleared.
+  void resize(size_t capacity) {
+    if (_shard_count(capacity) != _shards.size()) {
+      _create_shards(capacity);
+      return;
+    }
 
-  size_t size() const { return _cache->size(); }
+    _capacity = capacity;
+    for (auto shard_id = size_t{0}; shard_id < _shards.size(); ++shard_id) {
+      _shards[shard_id]->cache->resize(_shard_capacity(shard_id));
+    }
+  }
 
-  // Returns a reference to the underlying cache.
-  AbstractCache<Key, Value>& cache() { return *_cache; }
+  size_t size() const {
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      size += shard->cache->size();
+    }
+    return size;
+  }
 
-  // Replaces the underlying cache by creating a new object
+  size_t capacity() const { return _capacity; }
+
+  size_t shard_count() const { return _shards.size(); }
+
+  SQLQueryCacheStatistics statistics() const {
+    return SQLQueryCacheStatistics{_hits.load(std::memory_order_relaxed), _misses.load(std::memory_order_relaxed),
+                                   _evictions.load(std::memory_order_relaxed)};
+  }
+
+  void reset_statistics() {
+    _hits = 0;
+    _misses = 0;
+    _evictions = 0;
+  }
+
+  // Replaces the underlying caches by creating new objects
   // of the given cache type.
   template <class cache_t>
   void replace_cache_impl(size_t capacity) {
-    _cache = std::make_unique<cache_t>(capacity);
+    _create_cache = [](size_t shard_capacity) { return std::make_unique<cache_t>(shard_capacity); };
+    _create_shards(capacity);
   }
 
  protected:
-  // Underlying cache strategy.
-  std::unique_ptr<AbstractCache<Key, Value>> _cache;
+  struct Shard {
+    std::unique_ptr<AbstractCache<Key, Value>> cache;
+    mutable std::mutex mutex;
+  };
+
+  static size_t _shard_count(size_t capacity) {
+    return std::clamp(capacity / MinCacheShardCapacity, size_t{1}, MaxCacheShardCount);
+  }
+
+  // The first shards get one more entry if the capacity cannot be split evenly
+  size_t _shard_capacity(size_t shard_id) const {
+    return _capacity / _shards.size() + (shard_id < _capacity % _shards.size() ? 1 : 0);
+  }
+
+  Shard& _shard(const Key& query) { return *_shards[std::hash<Key>{}(query) % _shards.size()]; }
+  const Shard& _shard(const Key& query) const { return *_shards[std::hash<Key>{}(query) % _shards.size()]; }
+
+  void _create_shards(size_t capacity) {
+    _capacity = capacity;
+    _shards.clear();
+    _shards.resize(_shard_count(capacity));
+    for (auto shard_id = size_t{0}; shard_id < _shards.size(); ++shard_id) {
+      _shards[shard_id] = std::make_unique<Shard>();
+      _shards[shard_id]->cache = _create_cache(_shard_capacity(shard_id));
+    }
+  }
+
+  // Creates an (empty) underlying cache of the current cache type with the given capacity.
+  std::function<std::unique_ptr<AbstractCache<Key, Value>>(size_t)> _create_cache;
+
+  // Shards are held by pointer, as they contain a mutex and thus cannot be moved.
+  std::vector<std::unique_ptr<Shard>> _shards;
+  size_t _capacity{0};
 
-  std::mutex _mutex;
+  std::atomic<size_t> _hits{0};
+  std::atomic<size_t> _misses{0};
+  std::atomic<size_t> _evictions{0};
 };
 
 }  // namespace opossum
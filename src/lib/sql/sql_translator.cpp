@@ -48,6 +48,7 @@
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/update_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
+#include "operators/operator_scan_predicate.hpp"
 #include "storage/lqp_view.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -380,8 +381,15 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_update(const hsql::Up
     const auto column_expression = translation_state.sql_identifier_resolver->resolve_identifier_relaxed(column_name);
     const auto column_id = selection_lqp->get_column_id(*column_expression);
 
-    update_expressions[column_id] =
-        _translate_hsql_expr(*update_clause->value, translation_state.sql_identifier_resolver);
+    auto value_expression = _translate_hsql_expr(*update_clause->value, translation_state.sql_identifier_resolver);
+
+    // As for INSERT, the type of the new values has to match the column type exactly
+    const auto column_data_type = column_expression->data_type();
+    if (expression_contains_placeholders(value_expression) || value_expression->data_type() != column_data_type) {
+      value_expression = cast_(value_expression, column_data_type);
+    }
+
+    update_expressions[column_id] = value_expression;
   }
 
   return UpdateNode::make((update.table)->name, update_expressions, selection_lqp);
@@ -921,6 +929,11 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_predicate_expression(
       const auto predicate_expression = std::static_pointer_cast<AbstractPredicateExpression>(expression);
 
       if (predicate_expression->predicate_condition == PredicateCondition::In) {
+        // `<column> IN (<value>, ...)` is handled by the TableScan, see OperatorScanPredicate
+        if (OperatorScanPredicate::single_pass_from_expression(*expression, *current_node)) {
+          return PredicateNode::make(expression, current_node);
+        }
+
         current_node = _add_expressions_if_unavailable(current_node, {expression});
         return PredicateNode::make(not_equals_(expression, 0), current_node);
       } else {
@@ -0,0 +1,226 @@
+#include "cardinality_feedback_store.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "operators/abstract_operator.hpp"
+#include "statistics/table_statistics.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Node types whose output row count differs from that of their input(s) and is subject to estimation
+bool is_estimated_node_type(const LQPNodeType type) {
+  return type == LQPNodeType::Predicate || type == LQPNodeType::Join || type == LQPNodeType::Aggregate ||
+         type == LQPNodeType::Validate || type == LQPNodeType::Limit || type == LQPNodeType::Union;
+}
+
+// Set while a ScopedSubplanKeyCache exists on this thread
+thread_local std::unordered_map<const AbstractLQPNode*, std::string>* subplan_key_cache = nullptr;
+
+std::string subplan_key_of(const std::shared_ptr<AbstractLQPNode>& node) {
+  if (!node) return "";
+  return CardinalityFeedbackStore::subplan_key(*node, node->left_input(), node->right_input());
+}
+
+}  // namespace
+
+namespace opossum {
+
+CardinalityFeedbackStore::ScopedSubplanKeyCache::ScopedSubplanKeyCache() {
+  if (subplan_key_cache) return;
+
+  _cache = std::make_unique<std::unordered_map<const AbstractLQPNode*, std::string>>();
+  subplan_key_cache = _cache.get();
+}
+
+CardinalityFeedbackStore::ScopedSubplanKeyCache::~ScopedSubplanKeyCache() {
+  if (_cache) subplan_key_cache = nullptr;
+}
+
+// singleton
+CardinalityFeedbackStore& CardinalityFeedbackStore::get() {
+  static CardinalityFeedbackStore instance;
+  return instance;
+}
+
+void CardinalityFeedbackStore::reset() {
+  auto& instance = get();
+  std::unique_lock<std::shared_mutex> lock(instance._mutex);
+  instance._entries.clear();
+}
+
+std::string CardinalityFeedbackStore::subplan_key(const AbstractLQPNode& node,
+                                                  const std::shared_ptr<AbstractLQPNode>& left_input,
+                                                  const std::shared_ptr<AbstractLQPNode>& right_input) {
+  // Only keys of the plan as it is can be memoized, not those of hypothetical inputs (e.g., while reordering)
+  const auto memoize = subplan_key_cache && left_input == node.left_input() && right_input == node.right_input();
+  if (!memoize) return _build_subplan_key(node, left_input, right_input);
+
+  const auto cache_iter = subplan_key_cache->find(&node);
+  if (cache_iter != subplan_key_cache->end()) return cache_iter->second;
+
+  auto key = _build_subplan_key(node, left_input, right_input);
+  subplan_key_cache->emplace(&node, key);
+  return key;
+}
+
+std::string CardinalityFeedbackStore::_build_subplan_key(const AbstractLQPNode& node,
+                                                         const std::shared_ptr<AbstractLQPNode>& left_input,
+                                                         const std::shared_ptr<AbstractLQPNode>& right_input) {
+  switch (node.type) {
+    case LQPNodeType::Alias:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Sort:
+      // These nodes do not change the cardinality and are therefore transparent
+      return left_input ? subplan_key_of(left_input) : node.description();
+
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Validate: {
+      // Adjacent PredicateNodes/ValidateNodes can be reordered without changing the result, so their descriptions are
+      // sorted. This is the same notion of a predicate chain that the PredicateReorderingRule uses.
+      auto descriptions = std::vector<std::string>{node.description()};
+      auto input = left_input;
+      while (input && (input->type == LQPNodeType::Predicate || input->type == LQPNodeType::Validate) &&
+             input->output_count() <= 1) {
+        descriptions.emplace_back(input->description());
+        input = input->left_input();
+      }
+      std::sort(descriptions.begin(), descriptions.end());
+
+      std::stringstream stream;
+      stream << "{";
+      for (const auto& description : descriptions) {
+        stream << description << ";";
+      }
+      stream << "}(" << subplan_key_of(input) << ")";
+      return stream.str();
+    }
+
+    case LQPNodeType::Join: {
+      auto left_key = subplan_key_of(left_input);
+      auto right_key = subplan_key_of(right_input);
+
+      // Inner and cross joins are commutative
+      const auto join_mode = static_cast<const JoinNode&>(node).join_mode;
+      if ((join_mode == JoinMode::Inner || join_mode == JoinMode::Cross) && right_key < left_key) {
+        std::swap(left_key, right_key);
+      }
+
+      return node.description() + "(" + left_key + "," + right_key + ")";
+    }
+
+    default:
+      return node.description() + "(" + subplan_key_of(left_input) + "," + subplan_key_of(right_input) + ")";
+  }
+}
+
+bool CardinalityFeedbackStore::record_executed_plan(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                    const LQPTranslator& lqp_translator) {
+  const auto subplan_key_cache_scope = ScopedSubplanKeyCache{};
+  auto misestimated = false;
+
+  visit_lqp(lqp, [&](const auto& node) {
+    if (!is_estimated_node_type(node->type)) return LQPVisitation::VisitInputs;
+
+    // Operators with a row budget (i.e., below a LIMIT) may stop before they produced all rows. Operators within an
+    // OperatorPipeline that stopped early because of the budget of its last operator have no output row count.
+    const auto op = lqp_translator.find_operator(node);
+    if (!op || op->row_budget() || !op->performance_data().output_row_count) return LQPVisitation::VisitInputs;
+
+    const auto estimated_statistics = node->derive_statistics_from(node->left_input(), node->right_input());
+    const auto actual_row_count = static_cast<float>(*op->performance_data().output_row_count);
+
+    // The row count the optimizer assumed includes the feedback recorded by previous executions. Nodes are visited
+    // top-down, so the entries of the inputs have not been updated by this execution yet.
+    const auto assumed_row_count =
+        adjust_statistics(*node, node->left_input(), node->right_input(), estimated_statistics)->row_count();
+    const auto misestimation_factor =
+        (std::max(assumed_row_count, actual_row_count) + 1.0f) / (std::min(assumed_row_count, actual_row_count) + 1.0f);
+    if (misestimation_factor > MAX_MISESTIMATION_FACTOR) misestimated = true;
+
+    record(subplan_key(*node, node->left_input(), node->right_input()), estimated_statistics->row_count(),
+           actual_row_count);
+
+    return LQPVisitation::VisitInputs;
+  });
+
+  return misestimated;
+}
+
+void CardinalityFeedbackStore::record(const std::string& subplan_key, const float estimated_row_count,
+                                      const float actual_row_count) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+
+  auto entry_iter = _entries.find(subplan_key);
+  if (entry_iter == _entries.end()) {
+    if (_entries.size() >= MAX_ENTRY_COUNT) _evict_least_recently_used();
+    entry_iter = _entries.try_emplace(subplan_key).first;
+  }
+
+  auto& stored_entry = entry_iter->second;
+  stored_entry.entry.estimated_row_count = estimated_row_count;
+  stored_entry.entry.actual_row_count = actual_row_count;
+  ++stored_entry.entry.execution_count;
+  stored_entry.last_access = ++_access_clock;
+}
+
+void CardinalityFeedbackStore::_evict_least_recently_used() {
+  auto accesses = std::vector<std::pair<uint64_t, const std::string*>>{};
+  accesses.reserve(_entries.size());
+  for (const auto& [key, stored_entry] : _entries) {
+    accesses.emplace_back(stored_entry.last_access.load(), &key);
+  }
+
+  const auto eviction_count = std::min(EVICTION_BATCH_SIZE, accesses.size());
+  std::nth_element(accesses.begin(), accesses.begin() + eviction_count, accesses.end());
+  for (auto access_iter = accesses.begin(); access_iter != accesses.begin() + eviction_count; ++access_iter) {
+    _entries.erase(*access_iter->second);
+  }
+}
+
+std::optional<CardinalityFeedbackStore::Entry> CardinalityFeedbackStore::find(const std::string& subplan_key) const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+
+  const auto entry_iter = _entries.find(subplan_key);
+  if (entry_iter == _entries.end()) return std::nullopt;
+
+  entry_iter->second.last_access = ++_access_clock;
+  return entry_iter->second.entry;
+}
+
+std::shared_ptr<TableStatistics> CardinalityFeedbackStore::adjust_statistics(
+    const AbstractLQPNode& node, const std::shared_ptr<AbstractLQPNode>& left_input,
+    const std::shared_ptr<AbstractLQPNode>& right_input,
+    const std::shared_ptr<TableStatistics>& estimated_statistics) const {
+  if (!is_estimated_node_type(node.type)) return estimated_statistics;
+
+  // Avoid building the key in the common case of an empty store
+  {
+    std::shared_lock<std::shared_mutex> lock(_mutex);
+    if (_entries.empty()) return estimated_statistics;
+  }
+
+  const auto entry = find(subplan_key(node, left_input, right_input));
+  if (!entry) return estimated_statistics;
+
+  return std::make_shared<TableStatistics>(estimated_statistics->table_type(), entry->actual_row_count,
+                                           estimated_statistics->column_statistics());
+}
+
+size_t CardinalityFeedbackStore::size() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _entries.size();
+}
+
+}  // namespace opossum
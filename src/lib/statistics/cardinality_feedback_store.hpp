@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <shared_mutex>  // NOLINT lint thinks this is a C header or something
+#include <string>
+#include <unordered_map>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class LQPTranslator;
+class TableStatistics;
+
+/**
+ * Stores the actual output row counts of executed LQP subplans, so that the cardinality estimation does not repeat
+ * the same misestimations on every execution of a query.
+ *
+ * Subplans are identified by a normalized key (see subplan_key()). After a SQLPipelineStatement executed its plan, the
+ * actual row counts of all (non-leaf) nodes are recorded. AbstractLQPNode::get_statistics() and the
+ * PredicateReorderingRule consult the store via adjust_statistics() and replace the estimated row count by the actual
+ * one if the subplan was executed before. Thus, the optimizer (e.g., DpCcp and the PredicateReorderingRule) bases its
+ * decisions on the actual cardinalities from then on.
+ *
+ * Entries are overwritten by each execution of a subplan, so that they follow changes of the underlying data.
+ * Statements served from the SQLQueryCache are not re-optimized. Therefore, the SQLPipelineStatement evicts a plan from
+ * the cache if its execution showed that the optimizer misestimated it (see record_executed_plan()). The next execution
+ * of the statement is then optimized with the recorded cardinalities and cached again.
+ *
+ * The number of entries is bounded. Keys embed the literals of the predicates, so many entries belong to subplans that
+ * are executed only once. Once the store is full, the least recently used entries are evicted to make room for new
+ * ones.
+ */
+class CardinalityFeedbackStore : private Noncopyable {
+ public:
+  // Upper bound on the number of stored subplans. Once it is reached, the EVICTION_BATCH_SIZE least recently recorded
+  // or found entries are evicted at once, so that the cost of finding them is amortized over many insertions.
+  static constexpr auto MAX_ENTRY_COUNT = size_t{100'000};
+  static constexpr auto EVICTION_BATCH_SIZE = MAX_ENTRY_COUNT / 10;
+
+  // A subplan is considered misestimated if its actual and estimated row counts differ by more than this factor
+  static constexpr auto MAX_MISESTIMATION_FACTOR = 2.0f;
+
+  struct Entry {
+    float estimated_row_count{0.0f};
+    float actual_row_count{0.0f};
+    size_t execution_count{0};
+  };
+
+  /**
+   * While an instance exists, the subplan keys of nodes with their actual inputs are memoized for the calling thread.
+   * Thus, computing the keys of all nodes of a plan bottom-up (as get_statistics() does) builds each input's key only
+   * once instead of once per node above it. The plan must not be modified while an instance exists. Nested instances
+   * use the cache of the outermost one.
+   */
+  class ScopedSubplanKeyCache : private Noncopyable {
+   public:
+    ScopedSubplanKeyCache();
+    ~ScopedSubplanKeyCache();
+
+   private:
+    // Only set for the outermost instance
+    std::unique_ptr<std::unordered_map<const AbstractLQPNode*, std::string>> _cache;
+  };
+
+  static CardinalityFeedbackStore& get();
+  static void reset();
+
+  /**
+   * Normalized key of the subplan formed by @param node if it had the inputs @param left_input and @param right_input.
+   * Subplans that produce the same result have the same key, even if they differ in
+   *    - the order of adjacent PredicateNodes,
+   *    - the order of the inputs of inner and cross joins,
+   *    - the presence of nodes that do not change the cardinality (Projection, Alias, Sort).
+   */
+  static std::string subplan_key(const AbstractLQPNode& node, const std::shared_ptr<AbstractLQPNode>& left_input,
+                                 const std::shared_ptr<AbstractLQPNode>& right_input);
+
+  /**
+   * Record the actual output row counts of all nodes of the executed @param lqp. The operators executing the nodes are
+   * looked up in the @param lqp_translator that translated the LQP. Nodes whose operators did not necessarily produce
+   * their complete output because of a LIMIT (see AbstractOperator::set_row_budget) are not recorded.
+   *
+   * @return whether the actual row count of any recorded node differs from the row count that the optimizer assumed
+   *         (i.e., the estimate adjusted by the entries recorded before) by more than MAX_MISESTIMATION_FACTOR
+   */
+  bool record_executed_plan(const std::shared_ptr<AbstractLQPNode>& lqp, const LQPTranslator& lqp_translator);
+
+  void record(const std::string& subplan_key, const float estimated_row_count, const float actual_row_count);
+
+  std::optional<Entry> find(const std::string& subplan_key) const;
+
+  /**
+   * @return @param estimated_statistics with the row count replaced by the actual row count if the subplan formed by
+   *         @param node with the inputs @param left_input and @param right_input was executed before, otherwise
+   *         @param estimated_statistics unchanged
+   */
+  std::shared_ptr<TableStatistics> adjust_statistics(
+      const AbstractLQPNode& node, const std::shared_ptr<AbstractLQPNode>& left_input,
+      const std::shared_ptr<AbstractLQPNode>& right_input,
+      const std::shared_ptr<TableStatistics>& estimated_statistics) const;
+
+  size_t size() const;
+
+ protected:
+  CardinalityFeedbackStore() = default;
+
+  static std::string _build_subplan_key(const AbstractLQPNode& node, const std::shared_ptr<AbstractLQPNode>& left_input,
+                                        const std::shared_ptr<AbstractLQPNode>& right_input);
+
+  struct StoredEntry {
+    Entry entry;
+
+    // Value of _access_clock at the last record() or find() of the entry. Atomic, as find() updates it under a shared
+    // lock.
+    mutable std::atomic<uint64_t> last_access{0};
+  };
+
+  void _evict_least_recently_used();
+
+  std::unordered_map<std::string, StoredEntry> _entries;
+  mutable std::atomic<uint64_t> _access_clock{0};
+  mutable std::shared_mutex _mutex;
+};
+
+}  // namespace opossum
@@ -13,6 +13,7 @@
 #include "reference_segment.hpp"
 #include "resolve_type.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "table.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -161,6 +162,33 @@ void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
 
 const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const { return _alloc; }
 
+NodeID Chunk::home_node_id() const {
+  if (_home_node_id != INVALID_NODE_ID || column_count() == 0) return _home_node_id;
+
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(get_segment(ColumnID{0}));
+  if (!reference_segment) return INVALID_NODE_ID;
+
+  const auto& pos_list = *reference_segment->pos_list();
+  const auto first_row =
+      std::find_if(pos_list.begin(), pos_list.end(), [](const auto& row_id) { return !row_id.is_null(); });
+  if (first_row == pos_list.end()) return INVALID_NODE_ID;
+
+  return reference_segment->referenced_table()->get_chunk(first_row->chunk_id)->home_node_id();
+}
+
+void Chunk::set_home_node_id(const NodeID home_node_id) { _home_node_id = home_node_id; }
+
+std::optional<CommitID> Chunk::get_cleanup_commit_id() const {
+  const auto cleanup_commit_id = _cleanup_commit_id.load();
+  if (cleanup_commit_id == MvccData::MAX_COMMIT_ID) return std::nullopt;
+  return cleanup_commit_id;
+}
+
+void Chunk::set_cleanup_commit_id(const CommitID cleanup_commit_id) {
+  DebugAssert(has_mvcc_data(), "Only chunks with MVCC data can be cleaned up");
+  _cleanup_commit_id = cleanup_commit_id;
+}
+
 size_t Chunk::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
 
@@ -132,6 +132,15 @@ class Chunk : private Noncopyable {
 
   void migrate(boost::container::pmr::memory_resource* memory_source);
 
+  /**
+   * The NUMA node the chunk's data resides on, as recorded by set_home_node_id (e.g., after migrating the chunk).
+   * Chunks of reference tables report the home node of the chunk their first row points to, so that jobs working
+   * on them can be placed close to the referenced data.
+   * @return INVALID_NODE_ID if unknown
+   */
+  NodeID home_node_id() const;
+  void set_home_node_id(const NodeID home_node_id);
+
   std::shared_ptr<ChunkAccessCounter> access_counter() const { return _access_counter; }
 
   bool references_exactly_one_table() const;
@@ -142,6 +151,15 @@ class Chunk : private Noncopyable {
 
   void set_statistics(const std::shared_ptr<ChunkStatistics>& chunk_statistics);
 
+  /**
+   * Set by the GarbageCollector once all rows of the chunk have been invalidated and, if still valid, moved to the end
+   * of the table. Transactions with a snapshot commit id of at least the cleanup commit id do not see any row of the
+   * chunk, so GetTable excludes it for them.
+   * @return std::nullopt if the chunk has not been compacted
+   */
+  std::optional<CommitID> get_cleanup_commit_id() const;
+  void set_cleanup_commit_id(const CommitID cleanup_commit_id);
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this chunk and its segments
    */
@@ -158,6 +176,8 @@ class Chunk : private Noncopyable {
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
   std::shared_ptr<ChunkStatistics> _statistics;
   bool _is_mutable = true;
+  std::atomic<CommitID> _cleanup_commit_id{MvccData::MAX_COMMIT_ID};
+  std::atomic<NodeID> _home_node_id{INVALID_NODE_ID};
 };
 
 }  // namespace opossum
@@ -59,7 +59,7 @@ class StorageManager : private Noncopyable {
   // Have a look at base_test.hpp to see the correct order of resetting things.
   static void reset();
 
-  // For debugging purposes mostly, dump all tables as csv
+  // For debugging purposes mostly, dump all tables as csv. For consistent, incremental dumps, see Checkpointer.
   void export_all_tables_as_csv(const std::string& path);
 
   StorageManager(StorageManager&&) = delete;
@@ -102,10 +102,14 @@ struct Pack128Bit<bit_size, carry_over, 0u> {
 
 /**
  * @brief Unpacks 128 unsigned integers with the specified bit size
+ *
+ * Each unpacked 128-bit register (i.e., four consecutive integers) is passed to the sink. This way, the integers can
+ * either be stored (see StoreSink) or be processed while they are still in registers (see RangeMatchSink).
  */
 template <uint8_t bit_size, uint8_t carry_over = 0u, uint8_t remaining_recursions = bit_size>
 struct Unpack128Bit {
-  void operator()(const simd_type* in, simd_type* out, simd_type& in_reg, simd_type& out_reg,
+  template <typename Sink>
+  void operator()(const simd_type* in, Sink& sink, simd_type& in_reg, simd_type& out_reg,
                   const simd_type& mask) const {
     constexpr auto BITS_IN_WORD = 32u;
 
@@ -116,11 +120,10 @@ struct Unpack128Bit {
       const auto offset = carry_over + i * bit_size;
 #ifdef __SSE2__
       out_reg = _mm_and_si128(_mm_srli_epi32(in_reg, offset), mask);
-      _mm_storeu_si128(out++, out_reg);
 #else
       out_reg = (in_reg >> offset) & mask;
-      *out++ = out_reg;
 #endif
+      sink(out_reg);
     }
 
     constexpr auto NEXT_OFFSET = carry_over + I_MAX * bit_size;
@@ -133,14 +136,13 @@ struct Unpack128Bit {
       in_reg = _mm_load_si128(in++);
 
       out_reg = _mm_or_si128(out_reg, _mm_and_si128(_mm_slli_epi32(in_reg, NUM_FIRST_BITS), mask));
-      _mm_storeu_si128(out++, out_reg);
 #else
       out_reg = in_reg >> NEXT_OFFSET;
       in_reg = *in++;
 
       out_reg = out_reg | ((in_reg << NUM_FIRST_BITS) & mask);
-      *out++ = out_reg;
 #endif
+      sink(out_reg);
     } else {
       constexpr auto LAST_RECURSION = 1u;
 
@@ -156,13 +158,14 @@ struct Unpack128Bit {
 
     // Calculate the new carry over
     constexpr auto NEW_CARRY_OVER = NEXT_OFFSET < BITS_IN_WORD ? bit_size - NUM_FIRST_BITS : 0u;
-    Unpack128Bit<bit_size, NEW_CARRY_OVER, remaining_recursions - 1u>{}(in, out, in_reg, out_reg, mask);
+    Unpack128Bit<bit_size, NEW_CARRY_OVER, remaining_recursions - 1u>{}(in, sink, in_reg, out_reg, mask);
   }
 };
 
 template <uint8_t bit_size, uint8_t carry_over>
 struct Unpack128Bit<bit_size, carry_over, 0u> {
-  void operator()(const simd_type* in, simd_type* out, simd_type& in_reg, simd_type& out_reg,
+  template <typename Sink>
+  void operator()(const simd_type* in, Sink& sink, simd_type& in_reg, simd_type& out_reg,
                   const simd_type& mask) const {}
 };
 
@@ -171,178 +174,149 @@ void unpack_128_zeros(uint32_t* out) {
   std::fill(out, out + NUM_ZEROES, 0u);
 }
 
-}  // namespace
-
-void SimdBp128Packing::write_meta_info(const uint8_t* in, uint128_t* out) {
-  const auto simd_in = reinterpret_cast<const simd_type*>(in);
-  auto simd_out = reinterpret_cast<simd_type*>(out);
-
-#ifdef __SSE2__
-  const auto meta_block_info_rgtr = _mm_loadu_si128(simd_in);
-  _mm_store_si128(simd_out, meta_block_info_rgtr);
-#else
-  *simd_out = *simd_in;
-#endif
-}
-
-void SimdBp128Packing::read_meta_info(const uint128_t* in, uint8_t* out) {
-  const auto simd_in = reinterpret_cast<const simd_type*>(in);
-  auto simd_out = reinterpret_cast<simd_type*>(out);
-
-#ifdef __SSE2__
-  auto meta_info_block_rgtr = _mm_load_si128(simd_in);
-  _mm_storeu_si128(simd_out, meta_info_block_rgtr);
-#else
-  *simd_out = *simd_in;
-#endif
-}
-
-void SimdBp128Packing::pack_block(const uint32_t* in, uint128_t* out, const uint8_t bit_size) {
+// Unpacks a block with a bit size in the range [1, 32] and passes the unpacked registers to the sink
+template <typename Sink>
+void unpack_block_into_sink(const uint128_t* in, const uint8_t bit_size, Sink& sink) {
   auto simd_in = reinterpret_cast<const simd_type*>(in);
-  auto simd_out = reinterpret_cast<simd_type*>(out);
 
 #ifdef __SSE2__
-  auto in_reg = _mm_setzero_si128();
+  auto in_reg = _mm_load_si128(simd_in++);
   auto out_reg = _mm_setzero_si128();
   const auto mask = _mm_set1_epi32((1ul << bit_size) - 1);
 #else
-  simd_type in_reg = {0, 0, 0, 0};
+  simd_type in_reg = *simd_in++;
   simd_type out_reg = {0, 0, 0, 0};
   unsigned int one_mask = (1ul << bit_size) - 1;
   const simd_type mask = {one_mask, one_mask, one_mask, one_mask};
 #endif
 
   switch (bit_size) {
-    case 0u:
-      // No compression needed, since all values equal to zero.
-      return;
-
     case 1u:
-      Pack128Bit<1u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<1u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 2u:
-      Pack128Bit<2u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<2u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 3u:
-      Pack128Bit<3u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<3u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 4u:
-      Pack128Bit<4u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<4u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 5u:
-      Pack128Bit<5u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<5u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 6u:
-      Pack128Bit<6u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<6u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 7u:
-      Pack128Bit<7u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<7u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 8u:
-      Pack128Bit<8u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<8u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 9u:
-      Pack128Bit<9u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<9u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 10u:
-      Pack128Bit<10u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<10u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 11u:
-      Pack128Bit<11u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<11u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 12u:
-      Pack128Bit<12u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<12u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 13u:
-      Pack128Bit<13u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<13u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 14u:
-      Pack128Bit<14u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<14u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 15u:
-      Pack128Bit<15u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<15u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 16u:
-      Pack128Bit<16u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<16u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 17u:
-      Pack128Bit<17u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<17u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 18u:
-      Pack128Bit<18u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<18u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 19u:
-      Pack128Bit<19u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<19u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 20u:
-      Pack128Bit<20u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<20u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 21u:
-      Pack128Bit<21u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<21u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 22u:
-      Pack128Bit<22u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<22u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 23u:
-      Pack128Bit<23u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<23u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 24u:
-      Pack128Bit<24u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<24u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 25u:
-      Pack128Bit<25u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<25u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 26u:
-      Pack128Bit<26u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<26u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 27u:
-      Pack128Bit<27u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<27u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 28u:
-      Pack128Bit<28u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<28u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 29u:
-      Pack128Bit<29u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<29u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 30u:
-      Pack128Bit<30u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<30u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 31u:
-      Pack128Bit<31u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<31u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     case 32u:
-      Pack128Bit<32u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Unpack128Bit<32u>{}(simd_in, sink, in_reg, out_reg, mask);
       return;
 
     default:
@@ -351,153 +325,233 @@ void SimdBp128Packing::pack_block(const uint32_t* in, uint128_t* out, const uint
   }
 }
 
-void SimdBp128Packing::unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size) {
-  if (bit_size == 0u) {
-    unpack_128_zeros(out);
-    return;
+// Stores the unpacked integers
+struct StoreSink {
+  void operator()(const simd_type& out_reg) {
+#ifdef __SSE2__
+    _mm_storeu_si128(out++, out_reg);
+#else
+    *out++ = out_reg;
+#endif
+  }
+
+  simd_type* out;
+};
+
+// Sets the bits of the integers within [lower, upper) in a bitmask of the 128 integers of a block. Because the integers
+// of a block are packed interleaved, the n-th register holds the integers 4n to 4n+3 in its four lanes.
+struct RangeMatchSink {
+  RangeMatchSink(const uint32_t lower, const uint32_t upper, uint64_t* matches_out) : matches_out{matches_out} {
+    // (value - lower) < (upper - lower), compared as unsigned integers, checks both bounds at once. SSE2 only provides
+    // signed comparisons, which yield the same result if the sign bit of both sides is flipped.
+#ifdef __SSE2__
+    lower_reg = _mm_set1_epi32(lower);
+    sign_bit_reg = _mm_set1_epi32(0x80000000u);
+    width_reg = _mm_xor_si128(_mm_set1_epi32(upper - lower), sign_bit_reg);
+#else
+    lower_reg = simd_type{lower, lower, lower, lower};
+    width_reg = simd_type{upper - lower, upper - lower, upper - lower, upper - lower};
+#endif
+    matches_out[0] = 0u;
+    matches_out[1] = 0u;
+  }
+
+  void operator()(const simd_type& out_reg) {
+#ifdef __SSE2__
+    const auto offsets = _mm_xor_si128(_mm_sub_epi32(out_reg, lower_reg), sign_bit_reg);
+    const auto matches = static_cast<uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(offsets, width_reg))));
+#else
+    const auto in_range = (out_reg - lower_reg) < width_reg;
+    auto matches = uint64_t{0u};
+    for (auto lane = 0u; lane < 4u; ++lane) {
+      matches |= static_cast<uint64_t>(in_range[lane] & 1) << lane;
+    }
+#endif
+    matches_out[register_index / 16u] |= matches << (register_index % 16u * 4u);
+    ++register_index;
   }
 
+  simd_type lower_reg;
+  simd_type width_reg;
+#ifdef __SSE2__
+  simd_type sign_bit_reg;
+#endif
+  uint64_t* matches_out;
+  uint32_t register_index{0u};
+};
+
+}  // namespace
+
+void SimdBp128Packing::write_meta_info(const uint8_t* in, uint128_t* out) {
+  const auto simd_in = reinterpret_cast<const simd_type*>(in);
+  auto simd_out = reinterpret_cast<simd_type*>(out);
+
+#ifdef __SSE2__
+  const auto meta_block_info_rgtr = _mm_loadu_si128(simd_in);
+  _mm_store_si128(simd_out, meta_block_info_rgtr);
+#else
+  *simd_out = *simd_in;
+#endif
+}
+
+void SimdBp128Packing::read_meta_info(const uint128_t* in, uint8_t* out) {
+  const auto simd_in = reinterpret_cast<const simd_type*>(in);
+  auto simd_out = reinterpret_cast<simd_type*>(out);
+
+#ifdef __SSE2__
+  auto meta_info_block_rgtr = _mm_load_si128(simd_in);
+  _mm_storeu_si128(simd_out, meta_info_block_rgtr);
+#else
+  *simd_out = *simd_in;
+#endif
+}
+
+void SimdBp128Packing::pack_block(const uint32_t* in, uint128_t* out, const uint8_t bit_size) {
   auto simd_in = reinterpret_cast<const simd_type*>(in);
   auto simd_out = reinterpret_cast<simd_type*>(out);
 
 #ifdef __SSE2__
-  auto in_reg = _mm_load_si128(simd_in++);
+  auto in_reg = _mm_setzero_si128();
   auto out_reg = _mm_setzero_si128();
   const auto mask = _mm_set1_epi32((1ul << bit_size) - 1);
 #else
-  simd_type in_reg = *simd_in++;
+  simd_type in_reg = {0, 0, 0, 0};
   simd_type out_reg = {0, 0, 0, 0};
   unsigned int one_mask = (1ul << bit_size) - 1;
   const simd_type mask = {one_mask, one_mask, one_mask, one_mask};
 #endif
 
   switch (bit_size) {
+    case 0u:
+      // No compression needed, since all values equal to zero.
+      return;
+
     case 1u:
-      Unpack128Bit<1u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<1u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 2u:
-      Unpack128Bit<2u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<2u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 3u:
-      Unpack128Bit<3u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<3u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 4u:
-      Unpack128Bit<4u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<4u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 5u:
-      Unpack128Bit<5u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<5u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 6u:
-      Unpack128Bit<6u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<6u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 7u:
-      Unpack128Bit<7u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<7u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 8u:
-      Unpack128Bit<8u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<8u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 9u:
-      Unpack128Bit<9u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<9u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 10u:
-      Unpack128Bit<10u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<10u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 11u:
-      Unpack128Bit<11u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<11u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 12u:
-      Unpack128Bit<12u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<12u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 13u:
-      Unpack128Bit<13u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<13u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 14u:
-      Unpack128Bit<14u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<14u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 15u:
-      Unpack128Bit<15u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<15u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 16u:
-      Unpack128Bit<16u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<16u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 17u:
-      Unpack128Bit<17u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<17u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 18u:
-      Unpack128Bit<18u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<18u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 19u:
-      Unpack128Bit<19u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<19u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 20u:
-      Unpack128Bit<20u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<20u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 21u:
-      Unpack128Bit<21u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<21u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 22u:
-      Unpack128Bit<22u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<22u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 23u:
-      Unpack128Bit<23u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<23u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 24u:
-      Unpack128Bit<24u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<24u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 25u:
-      Unpack128Bit<25u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<25u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 26u:
-      Unpack128Bit<26u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<26u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 27u:
-      Unpack128Bit<27u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<27u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 28u:
-      Unpack128Bit<28u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<28u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 29u:
-      Unpack128Bit<29u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<29u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 30u:
-      Unpack128Bit<30u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<30u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 31u:
-      Unpack128Bit<31u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<31u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     case 32u:
-      Unpack128Bit<32u>{}(simd_in, simd_out, in_reg, out_reg, mask);
+      Pack128Bit<32u>{}(simd_in, simd_out, in_reg, out_reg, mask);
       return;
 
     default:
@@ -506,4 +560,28 @@ void SimdBp128Packing::unpack_block(const uint128_t* in, uint32_t* out, const ui
   }
 }
 
+void SimdBp128Packing::unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size) {
+  if (bit_size == 0u) {
+    unpack_128_zeros(out);
+    return;
+  }
+
+  auto sink = StoreSink{reinterpret_cast<simd_type*>(out)};
+  unpack_block_into_sink(in, bit_size, sink);
+}
+
+void SimdBp128Packing::match_block(const uint128_t* in, const uint8_t bit_size, const uint32_t lower,
+                                   const uint32_t upper, uint64_t* matches_out) {
+  if (bit_size == 0u) {
+    // All integers of the block are zero
+    const auto all_match = lower == 0u && upper > 0u ? ~uint64_t{0u} : uint64_t{0u};
+    matches_out[0] = all_match;
+    matches_out[1] = all_match;
+    return;
+  }
+
+  auto sink = RangeMatchSink{lower, upper, matches_out};
+  unpack_block_into_sink(in, bit_size, sink);
+}
+
 }  // namespace opossum
@@ -26,6 +26,14 @@ class SimdBp128Packing {
 
   static void pack_block(const uint32_t* in, uint128_t* out, const uint8_t bit_size);
   static void unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size);
+
+  /**
+   * Evaluates lower <= value < upper for the 128 integers of a block without storing them in memory. Bit i of the
+   * 128-bit mask written to matches_out[0] (integers 0 to 63) and matches_out[1] (integers 64 to 127) is set iff the
+   * i-th integer is within the range. Requires lower < upper.
+   */
+  static void match_block(const uint128_t* in, const uint8_t bit_size, const uint32_t lower, const uint32_t upper,
+                          uint64_t* matches_out);
 };
 
 }  // namespace opossum
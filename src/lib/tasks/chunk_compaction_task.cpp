@@ -0,0 +1,187 @@
+#include "chunk_compaction_task.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/compressed_vector_type.hpp"
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+bool chunk_is_completed(const Chunk& chunk, const uint32_t max_chunk_size) {
+  if (chunk.size() != max_chunk_size) return false;
+
+  const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+  for (const auto begin_cid : mvcc_data->begin_cids) {
+    if (begin_cid == MvccData::MAX_COMMIT_ID) return false;
+  }
+
+  return true;
+}
+
+SegmentEncodingSpec segment_encoding_spec(const std::shared_ptr<const BaseSegment>& segment) {
+  const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(segment);
+  if (!encoded_segment) return SegmentEncodingSpec{EncodingType::Unencoded};
+
+  switch (encoded_segment->compressed_vector_type()) {
+    case CompressedVectorType::FixedSize4ByteAligned:
+    case CompressedVectorType::FixedSize2ByteAligned:
+    case CompressedVectorType::FixedSize1ByteAligned:
+      return SegmentEncodingSpec{encoded_segment->encoding_type(), VectorCompressionType::FixedSizeByteAligned};
+    case CompressedVectorType::SimdBp128:
+      return SegmentEncodingSpec{encoded_segment->encoding_type(), VectorCompressionType::SimdBp128};
+    default:
+      return SegmentEncodingSpec{encoded_segment->encoding_type()};
+  }
+}
+
+}  // namespace
+
+ChunkCompactionTask::ChunkCompactionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
+    : _table_name{table_name}, _chunk_ids{chunk_ids} {}
+
+std::optional<bool> ChunkCompactionTask::succeeded() const { return _succeeded; }
+
+void ChunkCompactionTask::_on_execute() {
+  auto table = StorageManager::get().get_table(_table_name);
+
+  Assert(table != nullptr, "Table does not exist.");
+  Assert(table->has_mvcc() == UseMvcc::Yes, "Only tables with MVCC data can be compacted.");
+
+  _succeeded = _compact(table);
+}
+
+bool ChunkCompactionTask::_compact(const std::shared_ptr<Table>& table) {
+  // Reference all rows of the chunks so that Validate forwards exactly those visible to the compacting transaction
+  auto references_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+
+  for (const auto chunk_id : _chunk_ids) {
+    Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
+
+    const auto chunk = table->get_chunk(chunk_id);
+    DebugAssert(chunk_is_completed(*chunk, table->max_chunk_size()) || !chunk->is_mutable(),
+                "Chunk is not completed and thus can’t be compacted.");
+
+    auto pos_list = std::make_shared<PosList>();
+    pos_list->reserve(chunk->size());
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+    }
+
+    auto segments = Segments{};
+    for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+    }
+    references_table->append_chunk(segments);
+  }
+
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(references_table);
+  const auto validate = std::make_shared<Validate>(table_wrapper);
+  const auto delete_op = std::make_shared<Delete>(_table_name, validate);
+  const auto insert = std::make_shared<Insert>(_table_name, validate);
+  validate->set_transaction_context(transaction_context);
+  delete_op->set_transaction_context(transaction_context);
+  insert->set_transaction_context(transaction_context);
+
+  table_wrapper->execute();
+  validate->execute();
+
+  // The chunks into which the valid rows are re-inserted
+  const auto first_target_chunk_id = ChunkID{table->chunk_count() - 1};
+
+  if (validate->get_output()->row_count() > 0) {
+    delete_op->execute();
+    if (delete_op->execute_failed()) {
+      // A concurrent transaction modified one of the rows
+      transaction_context->rollback();
+      return false;
+    }
+
+    insert->execute();
+  }
+
+  transaction_context->commit();
+
+  /**
+   * Transactions that started before the chunks are marked might already have referenced them (in GetTable), even if
+   * their snapshot is newer than the commit id of the compaction. As such transactions have a snapshot of at most the
+   * last commit id at the time of marking, we finally use that one as the cleanup commit id. The GarbageCollector
+   * does not release the chunks before all transactions with a snapshot up to the cleanup commit id have finished.
+   * Setting the commit id of the compaction first ensures that transactions starting in between exclude the chunks.
+   */
+  for (const auto chunk_id : _chunk_ids) {
+    table->get_chunk(chunk_id)->set_cleanup_commit_id(transaction_context->commit_id());
+  }
+  const auto last_commit_id = TransactionManager::get().last_commit_id();
+  for (const auto chunk_id : _chunk_ids) {
+    table->get_chunk(chunk_id)->set_cleanup_commit_id(last_commit_id);
+  }
+
+  const auto template_chunk = table->get_chunk(_chunk_ids.front());
+  for (auto chunk_id = first_target_chunk_id; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk->is_mutable() || chunk->get_cleanup_commit_id()) continue;
+    if (!chunk_is_completed(*chunk, table->max_chunk_size())) continue;
+
+    _finalize_chunk(table, chunk, template_chunk);
+  }
+
+  return true;
+}
+
+void ChunkCompactionTask::_finalize_chunk(const std::shared_ptr<Table>& table, const std::shared_ptr<Chunk>& chunk,
+                                          const std::shared_ptr<const Chunk>& template_chunk) {
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  for (const auto& segment : template_chunk->segments()) {
+    chunk_encoding_spec.emplace_back(segment_encoding_spec(segment));
+  }
+
+  ChunkEncoder::encode_chunk(chunk, table->column_data_types(), chunk_encoding_spec);
+
+  for (const auto& index_info : table->get_indexes()) {
+    if (chunk->get_index(index_info.type, index_info.column_ids)) continue;
+
+    switch (index_info.type) {
+      case SegmentIndexType::GroupKey:
+        chunk->create_index<GroupKeyIndex>(index_info.column_ids);
+        break;
+      case SegmentIndexType::CompositeGroupKey:
+        chunk->create_index<CompositeGroupKeyIndex>(index_info.column_ids);
+        break;
+      case SegmentIndexType::AdaptiveRadixTree:
+        chunk->create_index<AdaptiveRadixTreeIndex>(index_info.column_ids);
+        break;
+      case SegmentIndexType::BTree:
+        chunk->create_index<BTreeIndex>(index_info.column_ids);
+        break;
+      default:
+        Fail("Unknown index type");
+    }
+  }
+}
+
+}  // namespace opossum
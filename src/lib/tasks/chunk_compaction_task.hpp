@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "scheduler/abstract_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * @brief Moves the still valid rows of completed chunks to the end of their table
+ *
+ * Within a single transaction, all rows of the chunks that are visible to the transaction are deleted and re-inserted
+ * into the table. Once the transaction has committed, no row of the chunks is visible to transactions with a newer
+ * snapshot. The chunks are then marked with a cleanup commit id, so that GetTable excludes them for such transactions
+ * and the GarbageCollector can release their data as soon as no older transaction is active anymore.
+ *
+ * If the transaction conflicts with a concurrent Delete or Update, it is rolled back and the chunks stay unchanged.
+ * They can be compacted in a later run.
+ *
+ * Completed chunks (see ChunkCompressionTask) that were filled by the re-inserted rows are encoded using the encoding
+ * of the first compacted chunk, and the indexes of the table are created for them.
+ */
+class ChunkCompactionTask : public AbstractTask {
+ public:
+  explicit ChunkCompactionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
+
+  // Returns whether the chunks have been compacted, std::nullopt if the task has not been executed yet
+  std::optional<bool> succeeded() const;
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  bool _compact(const std::shared_ptr<Table>& table);
+  void _finalize_chunk(const std::shared_ptr<Table>& table, const std::shared_ptr<Chunk>& chunk,
+                       const std::shared_ptr<const Chunk>& template_chunk);
+
+ private:
+  const std::string _table_name;
+  const std::vector<ChunkID> _chunk_ids;
+  std::optional<bool> _succeeded;
+};
+
+}  // namespace opossum
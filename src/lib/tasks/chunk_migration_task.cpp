@@ -38,6 +38,7 @@ void ChunkMigrationTask::_on_execute() {
                 "Chunk is not completed and thus can’t be migrated.");
 
     chunk->migrate(Topology::get().get_memory_resource(_target_node_id));
+    chunk->set_home_node_id(_target_node_id);
   }
 }
 
@@ -10,7 +10,10 @@ void CreatePipelineTask::_on_execute() {
   auto result = std::make_unique<CreatePipelineResult>();
 
   try {
-    result->sql_pipeline = std::make_shared<SQLPipeline>(SQLPipelineBuilder{_sql}.create_pipeline());
+    // The pipeline is cancelled with the token of this task, i.e., with the session
+    auto builder = SQLPipelineBuilder{_sql};
+    if (_statement_timeout) builder.with_statement_timeout(*_statement_timeout);
+    result->sql_pipeline = std::make_shared<SQLPipeline>(builder.create_pipeline());
   } catch (const std::exception& exception) {
     // Try LOAD file_name table_name
     if (_allow_load_table && _is_load_table()) {
@@ -2,6 +2,9 @@
 
 #include <boost/thread/future.hpp>
 
+#include <chrono>
+#include <optional>
+
 #include "abstract_server_task.hpp"
 
 namespace opossum {
@@ -18,8 +21,9 @@ struct CreatePipelineResult {
 // load on the main server thread to a miminum.
 class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipelineResult>> {
  public:
-  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false)
-      : _sql(sql), _allow_load_table(allow_load_table) {}
+  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false,
+                              std::optional<std::chrono::milliseconds> statement_timeout = std::nullopt)
+      : _sql(sql), _allow_load_table(allow_load_table), _statement_timeout(statement_timeout) {}
 
  protected:
   void _on_execute() override;
@@ -31,6 +35,7 @@ class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipel
 
   const std::string _sql;
   const bool _allow_load_table;
+  const std::optional<std::chrono::milliseconds> _statement_timeout;
 
   std::string _file_name;
   std::string _table_name;
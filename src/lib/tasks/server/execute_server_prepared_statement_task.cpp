@@ -2,15 +2,28 @@
 
 #include "concurrency/transaction_context.hpp"
 #include "concurrency/transaction_manager.hpp"
+#include "scheduler/admission_control.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/sql_query_plan.hpp"
+#include "utils/cancellation_token.hpp"
 
 namespace opossum {
 
 void ExecuteServerPreparedStatementTask::_on_execute() {
   try {
+    // The tasks of the plan inherit the priority class and the cancellation token of this task
     const auto tasks = _prepared_plan->create_tasks();
-    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+    if (_statement_timeout) {
+      const auto cancellation_token = std::make_shared<CancellationToken>(this->cancellation_token());
+      cancellation_token->set_timeout(*_statement_timeout);
+      for (const auto& task : tasks) {
+        task->set_cancellation_token(cancellation_token);
+      }
+    }
+    {
+      const auto admission = AdmissionControl::ScopedAdmission{query_priority()};
+      CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+    }
     auto result_table = tasks.back()->get_operator()->get_output();
     _promise.set_value(std::move(result_table));
   } catch (const std::exception&) {
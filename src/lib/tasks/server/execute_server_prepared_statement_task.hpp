@@ -1,5 +1,8 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
+
 #include "abstract_server_task.hpp"
 
 namespace opossum {
@@ -11,13 +14,15 @@ class Table;
 // This task takes a query plan of a prepared statement and executes it.
 class ExecuteServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<const Table>> {
  public:
-  explicit ExecuteServerPreparedStatementTask(std::shared_ptr<SQLQueryPlan> prepared_plan)
-      : _prepared_plan(std::move(prepared_plan)) {}
+  explicit ExecuteServerPreparedStatementTask(std::shared_ptr<SQLQueryPlan> prepared_plan,
+                                              std::optional<std::chrono::milliseconds> statement_timeout = std::nullopt)
+      : _prepared_plan(std::move(prepared_plan)), _statement_timeout(statement_timeout) {}
 
  protected:
   void _on_execute() override;
 
   std::shared_ptr<SQLQueryPlan> _prepared_plan;
+  const std::optional<std::chrono::milliseconds> _statement_timeout;
 };
 
 }  // namespace opossum
@@ -163,6 +163,11 @@ enum class SchedulePriority {
                 // that wait for JobTasks to do the actual work do not block the execution.
 };
 
+// Priority class of a query. The TaskQueue shares workers between the classes (see TaskQueue), so that long-running
+// Low queries (e.g., reports) cannot starve High ones (e.g., OLTP point queries). The AdmissionControl additionally
+// caps the number of concurrently executing Low queries.
+enum class QueryPriority { High = 0, Normal = 1, Low = 2 };
+
 enum class PredicateCondition {
   Equals,
   NotEquals,
@@ -198,6 +203,7 @@ enum class DescriptionMode { SingleLine, MultiLine };
 
 enum class UseMvcc : bool { Yes = true, No = false };
 enum class CleanupTemporaries : bool { Yes = true, No = false };
+enum class UsePipelining : bool { Yes = true, No = false };
 
 class Noncopyable {
  protected:
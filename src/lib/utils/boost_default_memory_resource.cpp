@@ -5,6 +5,8 @@
 #include <cstdlib>
 #include <iostream>
 
+#include "utils/tracking_memory_resource.hpp"
+
 namespace boost {
 namespace container {
 namespace pmr {
@@ -22,7 +24,8 @@ memory_resource* get_default_resource() BOOST_NOEXCEPT {
   // Yes, this leaks. We have had SO many problems with the default memory resource going out of scope
   // before the other things were cleaned up that we decided to live with the leak, rather than
   // running into races over and over again.
-  static auto* default_resource_instance = new default_resource_impl();  // NOLINT
+  // All allocations through the default resource are accounted to the MemoryTracker of the allocating thread.
+  static auto* default_resource_instance = new opossum::TrackingMemoryResource(new default_resource_impl());  // NOLINT
   return default_resource_instance;
 }
 
@@ -0,0 +1,67 @@
+#include "cancellation_token.hpp"
+
+#include <chrono>
+#include <memory>
+
+#include "utils/memory_limit_exceeded_exception.hpp"
+#include "utils/query_cancelled_exception.hpp"
+
+namespace {
+
+// The token of the query that the current thread works on, see ScopedCancellationToken
+thread_local opossum::CancellationToken* current_cancellation_token = nullptr;
+
+}  // namespace
+
+namespace opossum {
+
+CancellationToken::CancellationToken(const std::shared_ptr<const CancellationToken>& parent) : _parent(parent) {}
+
+CancellationToken* CancellationToken::current() { return current_cancellation_token; }
+
+void CancellationToken::check_current() {
+  if (current_cancellation_token) current_cancellation_token->check();
+}
+
+void CancellationToken::cancel() { _cancelled = true; }
+
+void CancellationToken::cancel_for_memory_limit() {
+  _memory_limit_exceeded = true;
+  _cancelled = true;
+}
+
+void CancellationToken::set_timeout(const std::chrono::milliseconds& timeout) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  _deadline = deadline.time_since_epoch().count();
+}
+
+bool CancellationToken::is_cancelled() const {
+  for (auto token = this; token; token = token->_parent.get()) {
+    if (token->_cancelled.load(std::memory_order_relaxed) || token->_is_timed_out()) return true;
+  }
+  return false;
+}
+
+void CancellationToken::check() const {
+  for (auto token = this; token; token = token->_parent.get()) {
+    if (token->_memory_limit_exceeded.load(std::memory_order_relaxed)) {
+      throw MemoryLimitExceededException("Query exceeded the memory limit");
+    }
+    if (token->_cancelled.load(std::memory_order_relaxed)) throw QueryCancelledException("Query was cancelled");
+    if (token->_is_timed_out()) throw QueryCancelledException("Query exceeded the statement timeout");
+  }
+}
+
+bool CancellationToken::_is_timed_out() const {
+  const auto deadline = _deadline.load(std::memory_order_relaxed);
+  return deadline != 0 && std::chrono::steady_clock::now().time_since_epoch().count() > deadline;
+}
+
+ScopedCancellationToken::ScopedCancellationToken(const std::shared_ptr<CancellationToken>& cancellation_token)
+    : _outer_cancellation_token(current_cancellation_token) {
+  current_cancellation_token = cancellation_token.get();
+}
+
+ScopedCancellationToken::~ScopedCancellationToken() { current_cancellation_token = _outer_cancellation_token; }
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Allows to abort a running query, e.g., because the client disconnected or because the statement timeout expired.
+ *
+ * A token is cancelled if cancel() was called on it, if its timeout expired, or if one of its ancestors is cancelled.
+ * The token of an SQLPipelineStatement is a child of the token of its SQLPipeline. In the server, that is in turn a
+ * child of the token of the session. As the MemoryTracker, a token is installed on the executing thread by the Tasks
+ * of the statement (see ScopedCancellationToken) and inherited by the JobTasks that operators spawn.
+ *
+ * Cancellation is cooperative: Tasks of a cancelled query are not started anymore (see AbstractTask::execute), and
+ * long-running operators call check_current() at chunk or partition boundaries.
+ */
+class CancellationToken : public std::enable_shared_from_this<CancellationToken>, private Noncopyable {
+ public:
+  explicit CancellationToken(const std::shared_ptr<const CancellationToken>& parent = nullptr);
+
+  // @return the token installed on the current thread, nullptr if there is none
+  static CancellationToken* current();
+
+  // Throws a QueryCancelledException if the token installed on the current thread is cancelled
+  static void check_current();
+
+  void cancel();
+
+  // Cancels the token because the query exceeded its memory limit. check() then throws a MemoryLimitExceededException.
+  void cancel_for_memory_limit();
+
+  // Cancels the token once the timeout has expired. The timeout starts when it is set and replaces any previous one.
+  void set_timeout(const std::chrono::milliseconds& timeout);
+
+  bool is_cancelled() const;
+
+  // Throws a QueryCancelledException if the token is cancelled
+  void check() const;
+
+ protected:
+  bool _is_timed_out() const;
+
+  const std::shared_ptr<const CancellationToken> _parent;
+
+  std::atomic_bool _cancelled{false};
+  std::atomic_bool _memory_limit_exceeded{false};
+
+  // Time since the epoch of the steady clock after which the token is cancelled, zero if there is no timeout
+  std::atomic<std::chrono::steady_clock::rep> _deadline{0};
+};
+
+/**
+ * Installs a CancellationToken on the current thread for the lifetime of the ScopedCancellationToken and restores the
+ * previously installed one afterwards.
+ */
+class ScopedCancellationToken : private Noncopyable {
+ public:
+  explicit ScopedCancellationToken(const std::shared_ptr<CancellationToken>& cancellation_token);
+  ~ScopedCancellationToken();
+
+ private:
+  CancellationToken* const _outer_cancellation_token;
+};
+
+}  // namespace opossum
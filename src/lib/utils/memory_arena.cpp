@@ -0,0 +1,46 @@
+#include "memory_arena.hpp"
+
+#include <boost/container/pmr/global_resource.hpp>
+
+#include <memory>
+
+namespace {
+
+// The arena for the transient allocations of the current thread, see ScopedMemoryArena
+thread_local opossum::MemoryArena* current_memory_arena = nullptr;
+
+}  // namespace
+
+namespace opossum {
+
+MemoryArena::MemoryArena() : _upstream(boost::container::pmr::get_default_resource()) {}
+
+MemoryArena* MemoryArena::current() { return current_memory_arena; }
+
+boost::container::pmr::memory_resource* MemoryArena::transient_resource() {
+  if (current_memory_arena) return current_memory_arena;
+  return boost::container::pmr::get_default_resource();
+}
+
+void* MemoryArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+  auto& buffer = _buffers.local();
+  if (!buffer) {
+    buffer = std::make_unique<boost::container::pmr::monotonic_buffer_resource>(INITIAL_BUFFER_SIZE, _upstream);
+  }
+  return buffer->allocate(bytes, alignment);
+}
+
+void MemoryArena::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {}
+
+bool MemoryArena::do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept {
+  return &other == this;
+}
+
+ScopedMemoryArena::ScopedMemoryArena(const std::shared_ptr<MemoryArena>& memory_arena)
+    : _outer_memory_arena(current_memory_arena) {
+  current_memory_arena = memory_arena.get();
+}
+
+ScopedMemoryArena::~ScopedMemoryArena() { current_memory_arena = _outer_memory_arena; }
+
+}  // namespace opossum
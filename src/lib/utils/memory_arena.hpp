@@ -0,0 +1,71 @@
+#pragma once
+
+#include <tbb/enumerable_thread_specific.h>
+
+#include <boost/container/pmr/memory_resource.hpp>
+#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+
+#include <cstddef>
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Monotonic arena for the intermediate results of an operator that do not leave it, e.g., the materialized and
+ * partitioned inputs of joins. Deallocations are no-ops. Instead, the memory is released wholesale when the arena is
+ * destroyed. Each thread allocates from its own monotonic buffers, so that the workers of a query do not contend for
+ * the global heap.
+ *
+ * AbstractOperator::execute() creates an arena for each operator and releases it once the operator has finished.
+ * Operators obtain it via MemoryArena::transient_resource(). As the MemoryTracker, the arena is installed on the
+ * executing thread (see ScopedMemoryArena) and inherited by the JobTasks that the operator spawns. Operators can
+ * install a nested arena for phases whose intermediates should be released earlier, e.g., JoinHash for each pair of
+ * spilled partitions. Outside of an operator, transient_resource() returns the default resource.
+ *
+ * Memory of the arena must never end up in the output of an operator, as the output outlives the arena.
+ */
+class MemoryArena : public boost::container::pmr::memory_resource,
+                    public std::enable_shared_from_this<MemoryArena>,
+                    private Noncopyable {
+ public:
+  // Size of the first buffer of each thread, further buffers grow geometrically
+  static constexpr size_t INITIAL_BUFFER_SIZE = 64 * 1024;
+
+  MemoryArena();
+
+  // @return the arena installed on the current thread, nullptr if there is none
+  static MemoryArena* current();
+
+  // @return the arena installed on the current thread, or the default resource if there is none
+  static boost::container::pmr::memory_resource* transient_resource();
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+
+  bool do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept override;
+
+  // The default resource at the time the arena was created. The buffers are accounted to the MemoryTracker of the
+  // thread that allocates them (see TrackingMemoryResource).
+  boost::container::pmr::memory_resource* const _upstream;
+
+  tbb::enumerable_thread_specific<std::unique_ptr<boost::container::pmr::monotonic_buffer_resource>> _buffers;
+};
+
+/**
+ * Installs a MemoryArena on the current thread for the lifetime of the ScopedMemoryArena and restores the previously
+ * installed one afterwards. Passing nullptr makes transient_resource() return the default resource within the scope.
+ */
+class ScopedMemoryArena : private Noncopyable {
+ public:
+  explicit ScopedMemoryArena(const std::shared_ptr<MemoryArena>& memory_arena);
+  ~ScopedMemoryArena();
+
+ private:
+  MemoryArena* const _outer_memory_arena;
+};
+
+}  // namespace opossum
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+
+#include "utils/query_cancelled_exception.hpp"
+
+namespace opossum {
+
+/*
+ * Thrown by TrackingMemoryResource if an allocation would exceed the limit of a MemoryTracker, e.g., the memory limit
+ * of an SQL statement. Before throwing, the CancellationToken of the query is cancelled. Thus, the exception takes the
+ * same path as a QueryCancelledException: it ends the Task, and the thread that waits for the Tasks of the query
+ * rethrows it (see CancellationToken::cancel_for_memory_limit()).
+ */
+class MemoryLimitExceededException : public QueryCancelledException {
+ public:
+  explicit MemoryLimitExceededException(const std::string& what_arg) : QueryCancelledException(what_arg) {}
+};
+
+}  // namespace opossum
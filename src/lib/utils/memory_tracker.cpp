@@ -0,0 +1,81 @@
+#include "memory_tracker.hpp"
+
+#include <memory>
+#include <optional>
+
+namespace {
+
+// The tracker that allocations of the current thread are accounted to, see ScopedMemoryTracker
+thread_local opossum::MemoryTracker* current_memory_tracker = nullptr;
+
+}  // namespace
+
+namespace opossum {
+
+MemoryTracker::MemoryTracker(MemoryTracker* parent, const std::optional<size_t>& limit)
+    : _parent(parent ? parent->shared() : nullptr), _limit(limit) {}
+
+std::shared_ptr<MemoryTracker> MemoryTracker::create(const std::optional<size_t>& limit) {
+  // The destructor is not public, as trackers delete themselves once they are no longer referenced
+  return std::shared_ptr<MemoryTracker>(new MemoryTracker(current_memory_tracker, limit),
+                                        [](MemoryTracker* memory_tracker) { memory_tracker->_release(); });
+}
+
+MemoryTracker* MemoryTracker::current() { return current_memory_tracker; }
+
+std::shared_ptr<MemoryTracker> MemoryTracker::shared() {
+  _reference_count.fetch_add(1);
+  return std::shared_ptr<MemoryTracker>(this, [](MemoryTracker* memory_tracker) { memory_tracker->_release(); });
+}
+
+bool MemoryTracker::try_track_allocation(const size_t bytes) {
+  if (!_try_add_bytes(bytes)) return false;
+
+  _reference_count.fetch_add(1);
+  return true;
+}
+
+void MemoryTracker::track_deallocation(const size_t bytes) {
+  _remove_bytes(bytes);
+  _release();
+}
+
+size_t MemoryTracker::current_bytes() const { return _current_bytes.load(); }
+
+size_t MemoryTracker::peak_bytes() const { return _peak_bytes.load(); }
+
+const std::optional<size_t>& MemoryTracker::limit() const { return _limit; }
+
+bool MemoryTracker::_try_add_bytes(const size_t bytes) {
+  if (_parent && !_parent->_try_add_bytes(bytes)) return false;
+
+  const auto current_bytes = _current_bytes.fetch_add(bytes) + bytes;
+  if (_limit && current_bytes > *_limit) {
+    _remove_bytes(bytes);
+    return false;
+  }
+
+  auto peak_bytes = _peak_bytes.load();
+  while (current_bytes > peak_bytes && !_peak_bytes.compare_exchange_weak(peak_bytes, current_bytes)) {
+  }
+
+  return true;
+}
+
+void MemoryTracker::_remove_bytes(const size_t bytes) {
+  _current_bytes.fetch_sub(bytes);
+  if (_parent) _parent->_remove_bytes(bytes);
+}
+
+void MemoryTracker::_release() {
+  if (_reference_count.fetch_sub(1) == 1) delete this;
+}
+
+ScopedMemoryTracker::ScopedMemoryTracker(const std::shared_ptr<MemoryTracker>& memory_tracker)
+    : _outer_memory_tracker(current_memory_tracker) {
+  current_memory_tracker = memory_tracker.get();
+}
+
+ScopedMemoryTracker::~ScopedMemoryTracker() { current_memory_tracker = _outer_memory_tracker; }
+
+}  // namespace opossum
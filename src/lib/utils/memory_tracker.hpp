@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Accounts the memory allocated through the TrackingMemoryResource (i.e., through all default-constructed
+ * PolymorphicAllocators) while the tracker is installed on a thread with a ScopedMemoryTracker. Trackers are nested:
+ * a tracker that is created while another one is installed accounts all allocations to its parent as well. This way,
+ * the memory of an operator (see AbstractOperator::execute) is also accounted to the SQL statement it belongs to (see
+ * SQLPipelineStatement::get_tasks). Tasks inherit the tracker of the thread that created them, so that the JobTasks
+ * spawned by an operator are accounted to the operator.
+ *
+ * If a tracker has a limit and an allocation would exceed it, the allocation fails with a
+ * MemoryLimitExceededException.
+ *
+ * Allocations may outlive the scope in which they were made, e.g., the result table of a query. A tracker is thus
+ * kept alive until the last owning pointer is gone and all memory accounted to it has been freed.
+ */
+class MemoryTracker : private Noncopyable {
+ public:
+  // Creates a tracker that is nested into the tracker installed on the current thread, if any
+  static std::shared_ptr<MemoryTracker> create(const std::optional<size_t>& limit = std::nullopt);
+
+  // @return the tracker installed on the current thread, nullptr if allocations are not tracked
+  static MemoryTracker* current();
+
+  // @return another owning pointer to this tracker
+  std::shared_ptr<MemoryTracker> shared();
+
+  // Accounts an allocation to this tracker and its parents. Returns false (and accounts nothing) if the allocation
+  // would exceed the limit of one of them.
+  bool try_track_allocation(const size_t bytes);
+  void track_deallocation(const size_t bytes);
+
+  size_t current_bytes() const;
+  size_t peak_bytes() const;
+  const std::optional<size_t>& limit() const;
+
+ protected:
+  MemoryTracker(MemoryTracker* parent, const std::optional<size_t>& limit);
+  ~MemoryTracker() = default;
+
+  bool _try_add_bytes(const size_t bytes);
+  void _remove_bytes(const size_t bytes);
+
+  void _release();
+
+  const std::shared_ptr<MemoryTracker> _parent;
+  const std::optional<size_t> _limit;
+
+  std::atomic<size_t> _current_bytes{0};
+  std::atomic<size_t> _peak_bytes{0};
+
+  // One reference per owning pointer and one per allocation that has not been freed yet
+  std::atomic<size_t> _reference_count{1};
+};
+
+/**
+ * Installs a MemoryTracker on the current thread for the lifetime of the ScopedMemoryTracker and restores the
+ * previously installed one afterwards. Passing nullptr disables the tracking within the scope.
+ */
+class ScopedMemoryTracker : private Noncopyable {
+ public:
+  explicit ScopedMemoryTracker(const std::shared_ptr<MemoryTracker>& memory_tracker);
+  ~ScopedMemoryTracker();
+
+ private:
+  MemoryTracker* const _outer_memory_tracker;
+};
+
+}  // namespace opossum
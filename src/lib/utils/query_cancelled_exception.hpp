@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+namespace opossum {
+
+/*
+ * Thrown by CancellationToken::check() if a query was cancelled or exceeded its statement timeout. Within a Task, the
+ * exception ends the Task early. The thread that waits for the Tasks of the query rethrows it once they are done (see
+ * CurrentScheduler::wait_for_tasks), which aborts the query.
+ */
+class QueryCancelledException : public std::runtime_error {
+ public:
+  explicit QueryCancelledException(const std::string& what_arg) : std::runtime_error(what_arg) {}
+};
+
+}  // namespace opossum
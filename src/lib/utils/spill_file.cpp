@@ -0,0 +1,41 @@
+#include "spill_file.hpp"
+
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+SpillFile::SpillFile() : _file(std::tmpfile()) { Assert(_file, "Could not create a temporary file for spilling"); }
+
+SpillFile::~SpillFile() { std::fclose(_file); }
+
+void SpillFile::append(const std::vector<char>& buffer) {
+  if (buffer.empty()) return;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  std::fseek(_file, 0, SEEK_END);
+  const auto written_bytes = std::fwrite(buffer.data(), 1, buffer.size(), _file);
+  Assert(written_bytes == buffer.size(), "Could not write to spill file");
+  _size += buffer.size();
+}
+
+std::vector<char> SpillFile::read() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto buffer = std::vector<char>(_size);
+  if (_size == 0) return buffer;
+
+  std::rewind(_file);
+  const auto read_bytes = std::fread(buffer.data(), 1, _size, _file);
+  Assert(read_bytes == _size, "Could not read from spill file");
+  return buffer;
+}
+
+size_t SpillFile::size() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _size;
+}
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Upper bound for the number of SpillFiles that an operator partitions its input into, as all of them are open at the
+// same time
+constexpr size_t MAX_SPILL_FILE_COUNT = 256;
+
+/**
+ * A temporary file to which operators spill intermediate results that exceed their memory budget (see
+ * AbstractOperator::set_memory_budget), e.g., the radix partitions of a JoinHash. The file is created with
+ * std::tmpfile(), so it is removed once the SpillFile is destroyed or the process terminates.
+ *
+ * append() may be called concurrently, e.g., by the per-chunk jobs that partition the input of an operator. Values are
+ * serialized into the appended buffers with write_spilled_value() and read with read_spilled_value().
+ */
+class SpillFile : private Noncopyable {
+ public:
+  SpillFile();
+  ~SpillFile();
+
+  // Appends the content of @param buffer to the file
+  void append(const std::vector<char>& buffer);
+
+  // Reads the complete content of the file
+  std::vector<char> read() const;
+
+  // Size of the file in bytes
+  size_t size() const;
+
+ private:
+  std::FILE* _file;
+  size_t _size{0};
+  mutable std::mutex _mutex;
+};
+
+// Serializes a trivially copyable value (e.g., a number or a RowID) or a string into @param buffer
+template <typename T>
+void write_spilled_value(std::vector<char>& buffer, const T& value) {
+  // clang-format off
+  if constexpr (std::is_same_v<T, std::string>) {
+    write_spilled_value(buffer, value.size());
+    buffer.insert(buffer.end(), value.begin(), value.end());
+  } else {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values and strings can be spilled");
+    const auto bytes = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+  }
+  // clang-format on
+}
+
+// Deserializes a value written by write_spilled_value() at @param offset of @param buffer and advances the offset
+template <typename T>
+T read_spilled_value(const std::vector<char>& buffer, size_t& offset) {
+  // clang-format off
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto size = read_spilled_value<size_t>(buffer, offset);
+    auto value = std::string{buffer.data() + offset, size};
+    offset += size;
+    return value;
+  } else {
+    auto value = T{};
+    std::memcpy(&value, buffer.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return value;
+  }
+  // clang-format on
+}
+
+}  // namespace opossum
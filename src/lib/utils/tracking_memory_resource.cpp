@@ -0,0 +1,55 @@
+#include "tracking_memory_resource.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#include "utils/cancellation_token.hpp"
+#include "utils/format_bytes.hpp"
+#include "utils/memory_limit_exceeded_exception.hpp"
+#include "utils/memory_tracker.hpp"
+
+namespace opossum {
+
+TrackingMemoryResource::TrackingMemoryResource(boost::container::pmr::memory_resource* upstream)
+    : _upstream(upstream) {}
+
+void* TrackingMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  const auto header_size = _header_size(alignment);
+  const auto block = static_cast<char*>(_upstream->allocate(bytes + header_size, alignment));
+
+  auto memory_tracker = MemoryTracker::current();
+  if (memory_tracker && !memory_tracker->try_track_allocation(bytes)) {
+    _upstream->deallocate(block, bytes + header_size, alignment);
+
+    // Cancelling the query stops its other Tasks and lets the thread that waits for them throw, also if this
+    // allocation happens on a Worker, where the exception itself only ends the current Task.
+    if (const auto cancellation_token = CancellationToken::current()) cancellation_token->cancel_for_memory_limit();
+    throw MemoryLimitExceededException("Allocation of " + format_bytes(bytes) + " exceeds the memory limit");
+  }
+
+  // The tracker is stored directly in front of the returned pointer
+  std::memcpy(block + header_size - sizeof(MemoryTracker*), &memory_tracker, sizeof(MemoryTracker*));
+  return block + header_size;
+}
+
+void TrackingMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+  const auto header_size = _header_size(alignment);
+  const auto block = static_cast<char*>(pointer) - header_size;
+
+  auto memory_tracker = static_cast<MemoryTracker*>(nullptr);
+  std::memcpy(&memory_tracker, static_cast<char*>(pointer) - sizeof(MemoryTracker*), sizeof(MemoryTracker*));
+
+  _upstream->deallocate(block, bytes + header_size, alignment);
+  if (memory_tracker) memory_tracker->track_deallocation(bytes);
+}
+
+bool TrackingMemoryResource::do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept {
+  return &other == this;
+}
+
+std::size_t TrackingMemoryResource::_header_size(std::size_t alignment) {
+  return std::max(alignment, alignof(std::max_align_t));
+}
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <cstddef>
+
+namespace opossum {
+
+/**
+ * Memory resource that accounts each allocation to the MemoryTracker installed on the allocating thread (see
+ * ScopedMemoryTracker) and forwards it to an upstream resource. The tracker is stored in a header in front of the
+ * allocated block, so that the deallocation is accounted to the same tracker, regardless of the thread that frees the
+ * memory and of the tracker installed at that time.
+ *
+ * boost::container::pmr::get_default_resource() returns a TrackingMemoryResource layered over the malloc-based default
+ * resource (see boost_default_memory_resource.cpp), so all default-constructed PolymorphicAllocators (e.g., those of
+ * PosLists) are tracked.
+ */
+class TrackingMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  explicit TrackingMemoryResource(boost::container::pmr::memory_resource* upstream);
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+
+  bool do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept override;
+
+  // The header keeps the alignment of the block that the upstream resource returns
+  static std::size_t _header_size(std::size_t alignment);
+
+  boost::container::pmr::memory_resource* const _upstream;
+};
+
+}  // namespace opossum
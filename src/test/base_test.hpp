@@ -9,6 +9,7 @@
 #include "gtest/gtest.h"
 #include "operators/abstract_operator.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "statistics/cardinality_feedback_store.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/numa_placement_manager.hpp"
 #include "storage/segment_encoding_utils.hpp"
@@ -72,6 +73,7 @@ class BaseTestWithParam : public std::conditional<std::is_same<ParamType, void>:
 
     StorageManager::reset();
     TransactionManager::reset();
+    CardinalityFeedbackStore::reset();
   }
 };
 
@@ -0,0 +1,77 @@
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "benchmark_runner.hpp"
+#include "benchmark_utils.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/filesystem.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class BenchmarkRunnerTest : public BaseTest {
+ protected:
+  void SetUp() override { StorageManager::get().add_table("table_a", load_table("src/test/tables/int_float.tbl", 2)); }
+
+  void TearDown() override { filesystem::remove(_report_path); }
+
+  // Runs the queries with two concurrent clients and returns the parsed report
+  nlohmann::json run_concurrently(const size_t max_num_query_runs, const Duration& max_duration) {
+    auto out = std::stringstream{};
+    const auto config = BenchmarkConfig{BenchmarkMode::IndividualQueries,
+                                        false,
+                                        Chunk::MAX_SIZE,
+                                        EncodingConfig{},
+                                        max_num_query_runs,
+                                        max_duration,
+                                        UseMvcc::No,
+                                        _report_path,
+                                        false,
+                                        false,
+                                        2,
+                                        0.0f,
+                                        out};
+    BenchmarkRunner{config, _queries, nlohmann::json::object()}.run();
+
+    auto report_file = std::ifstream{_report_path};
+    return nlohmann::json::parse(report_file);
+  }
+
+  const std::string _report_path = "benchmark_runner_test_report.json";
+  const NamedQueries _queries{{"q1", "SELECT * FROM table_a"}, {"q2", "SELECT a FROM table_a WHERE a > 200"}};
+};
+
+TEST_F(BenchmarkRunnerTest, ConcurrentReport) {
+  const auto report = run_concurrently(4, std::chrono::seconds{60});
+
+  ASSERT_EQ(report["benchmarks"].size(), 2u);
+  for (const auto& benchmark : report["benchmarks"]) {
+    EXPECT_EQ(benchmark["iterations"].get<size_t>(), 4u);
+    EXPECT_EQ(benchmark["iteration_durations"].size(), 4u);
+    EXPECT_GT(benchmark["avg_real_time_per_iteration"].get<int64_t>(), 0);
+    EXPECT_GT(benchmark["items_per_second"].get<float>(), 0.0f);
+    EXPECT_EQ(benchmark["latency_percentiles"].count("p99"), 1u);
+  }
+  EXPECT_GT(report["throughput (queries/s)"].get<float>(), 0.0f);
+}
+
+TEST_F(BenchmarkRunnerTest, ConcurrentReportWithoutIterations) {
+  // No client issues a query before the time limit is reached
+  const auto report = run_concurrently(4, Duration{0});
+
+  ASSERT_EQ(report["benchmarks"].size(), 2u);
+  for (const auto& benchmark : report["benchmarks"]) {
+    EXPECT_EQ(benchmark["iterations"].get<size_t>(), 0u);
+    EXPECT_TRUE(benchmark["iteration_durations"].empty());
+    EXPECT_EQ(benchmark["avg_real_time_per_iteration"].get<int64_t>(), 0);
+    EXPECT_FLOAT_EQ(benchmark["items_per_second"].get<float>(), 0.0f);
+    EXPECT_TRUE(benchmark["latency_percentiles"].empty());
+  }
+  EXPECT_FLOAT_EQ(report["throughput (queries/s)"].get<float>(), 0.0f);
+}
+
+}  // namespace opossum
@@ -0,0 +1,182 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/garbage_collector.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class GarbageCollectorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Three full chunks with the values 0 to 8
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 3, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 9; ++value) {
+      _table->append({value});
+    }
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  void delete_less_than(const int32_t value) {
+    auto transaction_context = TransactionManager::get().new_transaction_context();
+
+    auto get_table = std::make_shared<GetTable>("table_a");
+    auto validate = std::make_shared<Validate>(get_table);
+    auto table_scan =
+        std::make_shared<TableScan>(validate, OperatorScanPredicate{ColumnID{0}, PredicateCondition::LessThan, value});
+    auto delete_op = std::make_shared<Delete>("table_a", table_scan);
+    delete_op->set_transaction_context_recursively(transaction_context);
+
+    get_table->execute();
+    validate->execute();
+    table_scan->execute();
+    delete_op->execute();
+    ASSERT_FALSE(delete_op->execute_failed());
+
+    transaction_context->commit();
+  }
+
+  size_t get_table_chunk_count(const std::shared_ptr<TransactionContext>& transaction_context) {
+    auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->set_transaction_context(transaction_context);
+    get_table->execute();
+    return get_table->get_output()->chunk_count();
+  }
+
+  std::shared_ptr<const Table> get_visible_rows(const std::shared_ptr<TransactionContext>& transaction_context) {
+    auto get_table = std::make_shared<GetTable>("table_a");
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context_recursively(transaction_context);
+
+    get_table->execute();
+    validate->execute();
+    return validate->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(GarbageCollectorTest, LowestActiveSnapshotCommitId) {
+  auto& manager = TransactionManager::get();
+  EXPECT_FALSE(manager.lowest_active_snapshot_commit_id());
+
+  auto transaction_context_a = manager.new_transaction_context();
+  delete_less_than(1);
+  auto transaction_context_b = manager.new_transaction_context();
+  EXPECT_LT(transaction_context_a->snapshot_commit_id(), transaction_context_b->snapshot_commit_id());
+
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), transaction_context_a->snapshot_commit_id());
+
+  transaction_context_a.reset();
+  EXPECT_EQ(manager.lowest_active_snapshot_commit_id(), transaction_context_b->snapshot_commit_id());
+
+  transaction_context_b.reset();
+  EXPECT_FALSE(manager.lowest_active_snapshot_commit_id());
+}
+
+TEST_F(GarbageCollectorTest, CompactsAndReleasesChunksWithManyInvalidRows) {
+  // Two thirds of the first chunk and one third of the second chunk are invalid
+  delete_less_than(2);
+  _table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock()->end_cids[0] = CommitID{1};
+
+  GarbageCollector::get().collect();
+
+  // The valid row of the first chunk was moved to a new chunk
+  ASSERT_EQ(_table->chunk_count(), 4u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+  EXPECT_EQ(_table->get_chunk(ChunkID{3})->size(), 1u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{3})->get_segment(ColumnID{0})->operator[](0), AllTypeVariant{2});
+
+  // New transactions do not see the compacted chunk at all
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+  EXPECT_EQ(get_visible_rows(transaction_context)->row_count(), 6u);
+  EXPECT_EQ(get_table_chunk_count(transaction_context), 3u);
+
+  // The data can be released once no transaction is active anymore
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 3u);
+  GarbageCollector::get().collect();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 3u);
+  transaction_context.reset();
+  GarbageCollector::get().collect();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 0u);
+  EXPECT_EQ(_table->row_count(), 7u);
+  EXPECT_EQ(get_visible_rows(TransactionManager::get().new_transaction_context())->row_count(), 6u);
+}
+
+TEST_F(GarbageCollectorTest, ActiveTransactionsKeepCompactedChunks) {
+  delete_less_than(2);
+  auto old_transaction_context = TransactionManager::get().new_transaction_context();
+
+  GarbageCollector::get().collect();
+  ASSERT_TRUE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+
+  // The old transaction still sees the row in the compacted chunk, but not the moved one
+  EXPECT_EQ(get_visible_rows(old_transaction_context)->row_count(), 7u);
+  EXPECT_EQ(get_table_chunk_count(old_transaction_context), 4u);
+
+  GarbageCollector::get().collect();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 3u);
+
+  old_transaction_context.reset();
+  GarbageCollector::get().collect();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 0u);
+
+  // The released rows were invalid, so only the invalid rows are removed from the statistics
+  const auto table_statistics = _table->table_statistics();
+  EXPECT_FLOAT_EQ(table_statistics->row_count(), 7.0f);
+  EXPECT_EQ(table_statistics->approx_valid_row_count(), 7u);
+}
+
+TEST_F(GarbageCollectorTest, ResultsOfEndedTransactionsKeepCompactedChunks) {
+  delete_less_than(2);
+
+  // This result is computed before the chunk is compacted, so GetTable had no reason to exclude it
+  auto pre_compaction_visible_rows = get_visible_rows(TransactionManager::get().new_transaction_context());
+
+  auto old_transaction_context = TransactionManager::get().new_transaction_context();
+
+  GarbageCollector::get().collect();
+  ASSERT_TRUE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+
+  // The result references the row in the compacted chunk, which must not be released while the result exists
+  auto visible_rows = get_visible_rows(old_transaction_context);
+  old_transaction_context.reset();
+
+  GarbageCollector::get().collect();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 3u);
+  EXPECT_EQ(visible_rows->row_count(), 7u);
+  EXPECT_EQ(visible_rows->get_value<int32_t>(ColumnID{0}, 0u), 2);
+
+  visible_rows.reset();
+  GarbageCollector::get().collect();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 3u);
+  EXPECT_EQ(pre_compaction_visible_rows->row_count(), 7u);
+  EXPECT_EQ(pre_compaction_visible_rows->get_value<int32_t>(ColumnID{0}, 0u), 2);
+
+  pre_compaction_visible_rows.reset();
+  GarbageCollector::get().collect();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 0u);
+}
+
+TEST_F(GarbageCollectorTest, DeleteAfterCompaction) {
+  delete_less_than(2);
+  GarbageCollector::get().collect();
+
+  // GetTable returns a copy without the compacted chunk, so Delete has to map the rows to the stored table
+  delete_less_than(5);
+  EXPECT_EQ(get_visible_rows(TransactionManager::get().new_transaction_context())->row_count(), 4u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,111 @@
+#include "gtest/gtest.h"
+
+#include "base_test.hpp"
+#include "cost_model/cost_model_physical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CostModelPhysicalTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_statistics = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 100.0f, 1, 100);
+
+    node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "a");
+    node_a->set_statistics(std::make_shared<TableStatistics>(
+        TableType::Data, 100, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics}));
+    node_b = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "b");
+    node_b->set_statistics(std::make_shared<TableStatistics>(
+        TableType::Data, 10'000, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics}));
+
+    a_a = node_a->get_column("a");
+    b_a = node_b->get_column("a");
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b;
+  LQPColumnReference a_a, b_a;
+};
+
+TEST_F(CostModelPhysicalTest, JoinImplementation) {
+  // Equi joins will be executed as JoinHash, all other joins as JoinSortMerge
+  auto coefficients = CostModelPhysicalCoefficients{};
+  coefficients.join_hash_build_row = 1.0f;
+  coefficients.join_hash_probe_row = 0.0f;
+  coefficients.join_hash_output_row = 0.0f;
+  coefficients.join_sort_merge_sort_row = 0.0f;
+  coefficients.join_sort_merge_output_row = 2.0f;
+  const auto cost_model = CostModelPhysical{coefficients};
+
+  const auto inner_join = JoinNode::make(JoinMode::Inner, equals_(a_a, b_a), node_a, node_b);
+  const auto semi_join = JoinNode::make(JoinMode::Semi, equals_(a_a, b_a), node_b, node_a);
+  const auto outer_join = JoinNode::make(JoinMode::Outer, equals_(a_a, b_a), node_a, node_b);
+  const auto left_join = JoinNode::make(JoinMode::Left, equals_(a_a, b_a), node_b, node_a);
+  const auto non_equi_join = JoinNode::make(JoinMode::Inner, less_than_(a_a, b_a), node_a, node_b);
+
+  // The smaller input is the build input in all join modes
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(inner_join), 100.0f);
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(semi_join), 100.0f);
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(outer_join), 100.0f);
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(left_join), 100.0f);
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(non_equi_join), 2.0f * non_equi_join->get_statistics()->row_count());
+}
+
+TEST_F(CostModelPhysicalTest, TableScanEncoding) {
+  auto table = load_table("src/test/tables/int_float.tbl", 2);
+  StorageManager::get().add_table("table_a", table);
+
+  auto coefficients = CostModelPhysicalCoefficients{};
+  coefficients.table_scan_data_input_row[EncodingType::Unencoded] = 1.0f;
+  coefficients.table_scan_data_input_row[EncodingType::Dictionary] = 2.0f;
+  coefficients.table_scan_references_input_row = 3.0f;
+  coefficients.table_scan_output_row = 0.0f;
+  const auto cost_model = CostModelPhysical{coefficients};
+
+  const auto stored_table_node = StoredTableNode::make("table_a");
+  const auto a = stored_table_node->get_column("a");
+  const auto predicate_node_a = PredicateNode::make(greater_than_(a, 5), stored_table_node);
+  const auto predicate_node_b = PredicateNode::make(less_than_(a, 100), predicate_node_a);
+  const auto input_row_count = stored_table_node->get_statistics()->row_count();
+
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(predicate_node_a), 1.0f * input_row_count);
+
+  // If only some chunks are encoded, the costs are weighted by the share of the rows per encoding. The first chunk has
+  // two of the three rows, so the costs are (2.0f * 2 / 3 + 1.0f * 1 / 3) per input row.
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(predicate_node_a), 5.0f / 3.0f * input_row_count);
+
+  ChunkEncoder::encode_chunks(table, {ChunkID{1}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(predicate_node_a), 2.0f * input_row_count);
+
+  // The second scan operates on a reference table
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(predicate_node_b),
+                  2.0f * input_row_count + 3.0f * predicate_node_a->get_statistics()->row_count());
+}
+
+TEST_F(CostModelPhysicalTest, CoefficientsJson) {
+  auto coefficients = CostModelPhysicalCoefficients{};
+  coefficients.table_scan_data_input_row[EncodingType::RunLength] = 42.0f;
+  coefficients.sort_row = 13.0f;
+
+  const nlohmann::json json = coefficients;
+  const CostModelPhysicalCoefficients parsed_coefficients = json;
+
+  EXPECT_FLOAT_EQ(parsed_coefficients.table_scan_data_input_row.at(EncodingType::RunLength), 42.0f);
+  EXPECT_FLOAT_EQ(parsed_coefficients.sort_row, 13.0f);
+
+  // Missing values fall back to the defaults
+  const CostModelPhysicalCoefficients partial_coefficients = nlohmann::json{{"sort_row", 7.0f}};
+  EXPECT_FLOAT_EQ(partial_coefficients.sort_row, 7.0f);
+  EXPECT_FLOAT_EQ(partial_coefficients.join_hash_build_row, CostModelPhysicalCoefficients{}.join_hash_build_row);
+}
+
+}  // namespace opossum
@@ -0,0 +1,231 @@
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "import_export/checkpointer.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class CheckpointerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}};
+
+    // Three chunks with the values 0 to 6, the first one is encoded
+    auto table = std::make_shared<Table>(_column_definitions, TableType::Data, 3, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 7; ++value) {
+      table->append({value, value % 2 == 0 ? AllTypeVariant{std::to_string(value)} : NULL_VALUE});
+    }
+    ChunkEncoder::encode_chunks(table, {ChunkID{0}}, EncodingType::Dictionary);
+    StorageManager::get().add_table("table_a", table);
+  }
+
+  void TearDown() override { filesystem::remove_all(_directory); }
+
+  std::shared_ptr<TransactionContext> delete_less_than(const int32_t value, const bool commit = true) {
+    auto transaction_context = TransactionManager::get().new_transaction_context();
+
+    auto get_table = std::make_shared<GetTable>("table_a");
+    auto validate = std::make_shared<Validate>(get_table);
+    auto table_scan =
+        std::make_shared<TableScan>(validate, OperatorScanPredicate{ColumnID{0}, PredicateCondition::LessThan, value});
+    auto delete_op = std::make_shared<Delete>("table_a", table_scan);
+    delete_op->set_transaction_context_recursively(transaction_context);
+
+    get_table->execute();
+    validate->execute();
+    table_scan->execute();
+    delete_op->execute();
+
+    if (commit) transaction_context->commit();
+    return transaction_context;
+  }
+
+  void insert(const int32_t value) {
+    auto values = std::make_shared<Table>(_column_definitions, TableType::Data);
+    values->append({value, NULL_VALUE});
+
+    auto transaction_context = TransactionManager::get().new_transaction_context();
+    auto table_wrapper = std::make_shared<TableWrapper>(values);
+    auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+    insert->set_transaction_context(transaction_context);
+
+    table_wrapper->execute();
+    insert->execute();
+    transaction_context->commit();
+  }
+
+  std::shared_ptr<const Table> get_visible_rows() {
+    auto get_table = std::make_shared<GetTable>("table_a");
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context_recursively(TransactionManager::get().new_transaction_context());
+
+    get_table->execute();
+    validate->execute();
+    return validate->get_output();
+  }
+
+  // Replaces the table by the one from the checkpoint and checks that the visible rows did not change
+  void restore_and_compare(Checkpointer& checkpointer) {
+    const auto expected_rows = get_visible_rows();
+    StorageManager::get().drop_table("table_a");
+
+    EXPECT_EQ(checkpointer.restore(), 1u);
+    EXPECT_TABLE_EQ_UNORDERED(get_visible_rows(), expected_rows);
+  }
+
+  TableColumnDefinitions _column_definitions;
+  const std::string _directory = test_data_path + "checkpoint";
+};
+
+TEST_F(CheckpointerTest, CheckpointAndRestore) {
+  delete_less_than(2);
+
+  auto checkpointer = Checkpointer{_directory};
+  const auto result = checkpointer.checkpoint();
+  EXPECT_EQ(result.written_chunk_count, 3u);
+  EXPECT_EQ(result.reused_chunk_count, 0u);
+
+  auto restoring_checkpointer = Checkpointer{_directory};
+  restore_and_compare(restoring_checkpointer);
+
+  // The ChunkIDs are kept, the invalid rows are not restored
+  const auto table = StorageManager::get().get_table("table_a");
+  ASSERT_EQ(table->chunk_count(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 1u);
+  EXPECT_EQ(table->row_count(), 5u);
+}
+
+TEST_F(CheckpointerTest, OnlyChangedChunksAreWritten) {
+  auto checkpointer = Checkpointer{_directory};
+  EXPECT_EQ(checkpointer.checkpoint().written_chunk_count, 3u);
+
+  auto result = checkpointer.checkpoint();
+  EXPECT_EQ(result.written_chunk_count, 0u);
+  EXPECT_EQ(result.reused_chunk_count, 3u);
+
+  // Invalidating a row changes the first chunk
+  delete_less_than(1);
+  result = checkpointer.checkpoint();
+  EXPECT_EQ(result.written_chunk_count, 1u);
+  EXPECT_EQ(result.reused_chunk_count, 2u);
+
+  // Inserting rows changes the last chunk and adds a new one
+  insert(7);
+  insert(8);
+  insert(9);
+  result = checkpointer.checkpoint();
+  EXPECT_EQ(result.written_chunk_count, 2u);
+  EXPECT_EQ(result.reused_chunk_count, 2u);
+
+  auto restoring_checkpointer = Checkpointer{_directory};
+  restore_and_compare(restoring_checkpointer);
+}
+
+TEST_F(CheckpointerTest, UncommittedChangesAreNotCheckpointed) {
+  auto checkpointer = Checkpointer{_directory};
+  auto transaction_context = delete_less_than(5, false);
+  checkpointer.checkpoint();
+  transaction_context->rollback();
+
+  StorageManager::get().drop_table("table_a");
+  auto restoring_checkpointer = Checkpointer{_directory};
+  restoring_checkpointer.restore();
+  EXPECT_EQ(get_visible_rows()->row_count(), 7u);
+}
+
+TEST_F(CheckpointerTest, CheckpointAfterRestoreIsIncremental) {
+  auto checkpointer = Checkpointer{_directory};
+  checkpointer.checkpoint();
+
+  StorageManager::get().drop_table("table_a");
+  auto restoring_checkpointer = Checkpointer{_directory};
+  restoring_checkpointer.restore();
+
+  auto result = restoring_checkpointer.checkpoint();
+  EXPECT_EQ(result.written_chunk_count, 0u);
+  EXPECT_EQ(result.reused_chunk_count, 3u);
+
+  // Only the files of the latest checkpoint are kept
+  delete_less_than(4);
+  result = restoring_checkpointer.checkpoint();
+  EXPECT_EQ(result.written_chunk_count, 2u);
+
+  auto chunk_file_count = size_t{0};
+  for (const auto& entry : filesystem::directory_iterator(_directory)) {
+    if (entry.path().extension() == ".bin") ++chunk_file_count;
+  }
+  EXPECT_EQ(chunk_file_count, 2u);
+
+  restore_and_compare(restoring_checkpointer);
+}
+
+TEST_F(CheckpointerTest, TableWithoutMvcc) {
+  StorageManager::get().drop_table("table_a");
+
+  auto table = std::make_shared<Table>(_column_definitions, TableType::Data, 3, UseMvcc::No);
+  for (auto value = int32_t{0}; value < 7; ++value) {
+    table->append({value, NULL_VALUE});
+  }
+  StorageManager::get().add_table("table_b", table);
+
+  auto checkpointer = Checkpointer{_directory};
+  EXPECT_EQ(checkpointer.checkpoint().written_chunk_count, 3u);
+  EXPECT_EQ(checkpointer.checkpoint().reused_chunk_count, 3u);
+
+  // Appending changes the last chunk only
+  table->append({7, "7"});
+  const auto result = checkpointer.checkpoint();
+  EXPECT_EQ(result.written_chunk_count, 1u);
+  EXPECT_EQ(result.reused_chunk_count, 2u);
+
+  StorageManager::get().drop_table("table_b");
+  EXPECT_EQ(checkpointer.restore(), 1u);
+
+  const auto restored_table = StorageManager::get().get_table("table_b");
+  EXPECT_EQ(restored_table->has_mvcc(), UseMvcc::No);
+  EXPECT_TABLE_EQ_ORDERED(restored_table, table);
+
+  // Full chunks are finalized, rows can still be appended to the last one
+  ASSERT_EQ(restored_table->chunk_count(), 3u);
+  EXPECT_FALSE(restored_table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_FALSE(restored_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_TRUE(restored_table->get_chunk(ChunkID{2})->is_mutable());
+}
+
+TEST_F(CheckpointerTest, OtherFilesAreKept) {
+  filesystem::create_directories(_directory);
+  for (const auto& file_name : {"data.bin", "table_a.bin", "table_a.0.bin", "table_a.x.0.bin", "notes.txt"}) {
+    std::ofstream{_directory + "/" + file_name} << "not a chunk";
+  }
+
+  auto checkpointer = Checkpointer{_directory};
+  checkpointer.checkpoint();
+  delete_less_than(4);
+  checkpointer.checkpoint();
+
+  for (const auto& file_name : {"data.bin", "table_a.bin", "table_a.0.bin", "table_a.x.0.bin", "notes.txt"}) {
+    EXPECT_TRUE(filesystem::exists(_directory + "/" + file_name));
+  }
+
+  // The chunk files of the first checkpoint were replaced
+  EXPECT_FALSE(filesystem::exists(_directory + "/table_a.1.0.bin"));
+  EXPECT_TRUE(filesystem::exists(_directory + "/table_a.1.1.bin"));
+}
+
+}  // namespace opossum
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ios>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "import_export/ordered_chunk_writer.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+
+namespace opossum {
+
+// Accepts the first capacity bytes and fails all further writes
+class LimitedStreamBuffer : public std::streambuf {
+ public:
+  explicit LimitedStreamBuffer(const size_t capacity) : _capacity(capacity) {}
+
+  const std::string& written() const { return _written; }
+
+ protected:
+  std::streamsize xsputn(const char* data, std::streamsize count) override {
+    const auto accepted = std::min(count, static_cast<std::streamsize>(_capacity - _written.size()));
+    _written.append(data, accepted);
+    return accepted;
+  }
+
+  int_type overflow(int_type character) override { return traits_type::eof(); }
+
+  const size_t _capacity;
+  std::string _written;
+};
+
+class OrderedChunkWriterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Topology::use_fake_numa_topology(8, 4);
+    CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  }
+
+  void TearDown() override {
+    CurrentScheduler::get()->finish();
+    CurrentScheduler::set(nullptr);
+  }
+
+  // Serializes each chunk to two characters, with a delay so that several chunks are serialized concurrently
+  static void serialize_chunk(const ChunkID chunk_id, std::string& buffer) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    buffer.assign(2, static_cast<char>('a' + chunk_id % 26));
+  }
+};
+
+TEST_F(OrderedChunkWriterTest, WriteChunksInOrder) {
+  auto stream = std::stringstream{};
+  write_chunks_in_order(stream, ChunkID{5}, serialize_chunk, 2);
+
+  EXPECT_EQ(stream.str(), "aabbccddee");
+}
+
+TEST_F(OrderedChunkWriterTest, FailingStream) {
+  auto stream_buffer = LimitedStreamBuffer{5};
+  auto stream = std::ostream{&stream_buffer};
+  stream.exceptions(std::ios::badbit);
+
+  auto started_chunk_count = std::atomic<size_t>{0};
+  auto finished_chunk_count = std::atomic<size_t>{0};
+  const auto count_and_serialize_chunk = [&](const ChunkID chunk_id, std::string& buffer) {
+    ++started_chunk_count;
+    serialize_chunk(chunk_id, buffer);
+    ++finished_chunk_count;
+  };
+
+  // The write of the third chunk fails while further chunks are still being serialized
+  EXPECT_THROW(write_chunks_in_order(stream, ChunkID{20}, count_and_serialize_chunk, 8), std::ios_base::failure);
+
+  // All scheduled tasks finished before the exception left the function, so they no longer access the serialization
+  // function, which is destroyed after this test
+  EXPECT_GT(started_chunk_count, 2u);
+  EXPECT_EQ(finished_chunk_count, started_chunk_count);
+  EXPECT_EQ(stream_buffer.written(), "aabbc");
+}
+
+}  // namespace opossum
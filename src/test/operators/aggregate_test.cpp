@@ -15,9 +15,11 @@
 #include "operators/join_hash.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/print.hpp"
+#include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -105,9 +107,7 @@ class OperatorsAggregateTest : public BaseTest {
     EXPECT_NE(expected_result, nullptr) << "Could not load expected result table";
 
     // Test the Aggregate on stored table data
-    auto aggregate = std::make_shared<Aggregate>(in, aggregates, groupby_column_ids);
-    aggregate->execute();
-    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_result);
+    test_strategies(in, aggregates, groupby_column_ids, expected_result);
 
     if (test_aggregate_on_reference_table) {
       // Perform a TableScan to create a reference table
@@ -116,7 +116,34 @@ class OperatorsAggregateTest : public BaseTest {
       table_scan->execute();
 
       // Perform the Aggregate on a reference table
-      const auto aggregate = std::make_shared<Aggregate>(table_scan, aggregates, groupby_column_ids);
+      test_strategies(table_scan, aggregates, groupby_column_ids, expected_result);
+    }
+  }
+
+  // Runs the Aggregate with all AggregateStrategies that can be used for the groupby columns. For the SortBased
+  // strategy, the input is sorted by the groupby columns first.
+  void test_strategies(const std::shared_ptr<AbstractOperator>& in,
+                       const std::vector<AggregateColumnDefinition>& aggregates,
+                       const std::vector<ColumnID>& groupby_column_ids, const std::shared_ptr<Table>& expected_result) {
+    auto aggregate = std::make_shared<Aggregate>(in, aggregates, groupby_column_ids);
+    aggregate->execute();
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_result);
+
+    if (groupby_column_ids.size() == 1) {
+      aggregate = std::make_shared<Aggregate>(in, aggregates, groupby_column_ids, AggregateStrategy::DirectArray);
+      aggregate->execute();
+      EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_result);
+    }
+
+    if (!groupby_column_ids.empty()) {
+      auto sorted_input = in;
+      for (const auto column_id : groupby_column_ids) {
+        sorted_input = std::make_shared<Sort>(sorted_input, column_id);
+        sorted_input->execute();
+      }
+
+      aggregate =
+          std::make_shared<Aggregate>(sorted_input, aggregates, groupby_column_ids, AggregateStrategy::SortBased);
       aggregate->execute();
       EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_result);
     }
@@ -588,4 +615,154 @@ TEST_F(OperatorsAggregateTest, OuterJoinThenAggregate) {
                     "src/test/tables/aggregateoperator/groupby_int_1gb_1agg/outer_join.tbl", 1, false);
 }
 
+TEST_F(OperatorsAggregateTest, SortBasedGroupsSpanChunks) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String}},
+                                       TableType::Data, 2);
+  table->append({1, "x"});
+  table->append({1, "x"});
+  table->append({1, "x"});
+  table->append({1, "y"});
+  table->append({2, "y"});
+  table->append({NULL_VALUE, "y"});
+  table->append({NULL_VALUE, "y"});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count}};
+  const auto groupby_column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}};
+
+  auto aggregate =
+      std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids, AggregateStrategy::SortBased);
+  aggregate->execute();
+
+  auto hash_aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids);
+  hash_aggregate->execute();
+
+  EXPECT_EQ(aggregate->get_output()->row_count(), 4u);
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), hash_aggregate->get_output());
+}
+
+TEST_F(OperatorsAggregateTest, DirectArrayOnIntegralRanges) {
+  // The values -3 to -1 are grouped by their offset, the values of the large range are mapped to IDs
+  for (const auto& values : {std::vector<int32_t>{-1, -3, -1, -3}, std::vector<int32_t>{-1, 2'000'000'000, -1, 5}}) {
+    auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 3);
+    for (const auto value : values) {
+      table->append({value});
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    auto aggregate = std::make_shared<Aggregate>(
+        table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Sum}},
+        std::vector<ColumnID>{ColumnID{0}}, AggregateStrategy::DirectArray);
+    aggregate->execute();
+
+    auto hash_aggregate = std::make_shared<Aggregate>(
+        table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Sum}},
+        std::vector<ColumnID>{ColumnID{0}});
+    hash_aggregate->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), hash_aggregate->get_output());
+  }
+}
+
+TEST_F(OperatorsAggregateTest, UngroupedAggregatesOnEncodedSegments) {
+  // Without groupby columns, encoded segments are aggregated without decoding each value. The results have to match
+  // those on the unencoded table.
+  auto aggregates = std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count}};
+  for (const auto column_id : {ColumnID{0}, ColumnID{1}}) {
+    for (const auto function : {AggregateFunction::Min, AggregateFunction::Max, AggregateFunction::Sum,
+                                AggregateFunction::Avg, AggregateFunction::Count, AggregateFunction::CountDistinct}) {
+      aggregates.emplace_back(column_id, function);
+    }
+  }
+
+  const auto expected_aggregate =
+      std::make_shared<Aggregate>(_table_wrapper_1_1_null, aggregates, std::vector<ColumnID>{});
+  expected_aggregate->execute();
+
+  const auto chunk_encoding_specs = std::vector<ChunkEncodingSpec>{
+      {SegmentEncodingSpec{EncodingType::Dictionary}, SegmentEncodingSpec{EncodingType::Dictionary}},
+      {SegmentEncodingSpec{EncodingType::RunLength}, SegmentEncodingSpec{EncodingType::RunLength}},
+      {SegmentEncodingSpec{EncodingType::FrameOfReference}, SegmentEncodingSpec{EncodingType::Dictionary}}};
+
+  for (const auto& chunk_encoding_spec : chunk_encoding_specs) {
+    auto table = load_table("src/test/tables/aggregateoperator/groupby_int_1gb_1agg/input_null.tbl", 2);
+    ChunkEncoder::encode_all_chunks(table, chunk_encoding_spec);
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    const auto aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, std::vector<ColumnID>{});
+    aggregate->execute();
+    EXPECT_TABLE_EQ_ORDERED(aggregate->get_output(), expected_aggregate->get_output());
+  }
+}
+
+TEST_F(OperatorsAggregateTest, SpillsPartitionsUnderMemoryBudget) {
+  // With a budget of one byte, the rows are spilled into several files by their group-by values and each file is
+  // aggregated on its own
+  const auto test_spilled_output = [](const std::shared_ptr<AbstractOperator>& in,
+                                      const std::vector<AggregateColumnDefinition>& aggregates,
+                                      const std::vector<ColumnID>& groupby_column_ids, const std::string& file_name) {
+    auto aggregate = std::make_shared<Aggregate>(in, aggregates, groupby_column_ids);
+    aggregate->set_memory_budget(1);
+    aggregate->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), load_table(file_name, 1));
+    EXPECT_GT(aggregate->performance_data().spilled_bytes, 0u);
+  };
+
+  test_spilled_output(_table_wrapper_2_2,
+                      {{ColumnID{2}, AggregateFunction::Sum}, {ColumnID{3}, AggregateFunction::Avg}},
+                      {ColumnID{0}, ColumnID{1}}, "src/test/tables/aggregateoperator/groupby_int_2gb_2agg/sum_avg.tbl");
+  test_spilled_output(_table_wrapper_1_1_string_null, {{ColumnID{1}, AggregateFunction::Count}}, {ColumnID{0}},
+                      "src/test/tables/aggregateoperator/groupby_string_1gb_1agg/count_str_null.tbl");
+
+  // Reference inputs are resolved to the referenced table
+  const auto table_scan = std::make_shared<TableScan>(
+      _table_wrapper_2_2, OperatorScanPredicate{ColumnID{0}, PredicateCondition::GreaterThanEquals, 0});
+  table_scan->execute();
+  test_spilled_output(table_scan, {{ColumnID{2}, AggregateFunction::Sum}, {ColumnID{3}, AggregateFunction::Avg}},
+                      {ColumnID{0}, ColumnID{1}}, "src/test/tables/aggregateoperator/groupby_int_2gb_2agg/sum_avg.tbl");
+
+  // Chunks of the input that reference different tables are resolved to their respective table. Every other chunk
+  // references a copy of the table that holds the chunks in reverse order.
+  const auto data_table = _table_wrapper_2_2->get_output();
+  const auto reversed_table = std::make_shared<Table>(data_table->column_definitions(), TableType::Data);
+  for (auto chunk_id = data_table->chunk_count(); chunk_id > 0; --chunk_id) {
+    reversed_table->append_chunk(std::const_pointer_cast<Chunk>(data_table->get_chunk(ChunkID{chunk_id - 1})));
+  }
+
+  const auto mixed_reference_table = std::make_shared<Table>(data_table->column_definitions(), TableType::References);
+  for (ChunkID chunk_id{0}; chunk_id < data_table->chunk_count(); ++chunk_id) {
+    const auto reverse = chunk_id % 2 == 1;
+    const auto referenced_chunk_id = reverse ? ChunkID{data_table->chunk_count() - chunk_id - 1} : chunk_id;
+
+    auto pos_list = std::make_shared<PosList>();
+    for (ChunkOffset chunk_offset{0}; chunk_offset < data_table->get_chunk(chunk_id)->size(); ++chunk_offset) {
+      pos_list->emplace_back(RowID{referenced_chunk_id, chunk_offset});
+    }
+
+    Segments segments;
+    for (ColumnID column_id{0}; column_id < data_table->column_count(); ++column_id) {
+      segments.emplace_back(
+          std::make_shared<ReferenceSegment>(reverse ? reversed_table : data_table, column_id, pos_list));
+    }
+    mixed_reference_table->append_chunk(segments);
+  }
+
+  const auto mixed_table_wrapper = std::make_shared<TableWrapper>(mixed_reference_table);
+  mixed_table_wrapper->execute();
+  test_spilled_output(mixed_table_wrapper,
+                      {{ColumnID{2}, AggregateFunction::Sum}, {ColumnID{3}, AggregateFunction::Avg}},
+                      {ColumnID{0}, ColumnID{1}}, "src/test/tables/aggregateoperator/groupby_int_2gb_2agg/sum_avg.tbl");
+
+  // Without group-by columns, there is a single group and nothing is spilled
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}};
+  auto aggregate = std::make_shared<Aggregate>(_table_wrapper_1_1, aggregates, std::vector<ColumnID>{});
+  aggregate->set_memory_budget(1);
+  aggregate->execute();
+  EXPECT_EQ(aggregate->performance_data().spilled_bytes, 0u);
+}
+
 }  // namespace opossum
@@ -10,9 +10,11 @@
 
 #include "import_export/binary.hpp"
 #include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -372,4 +374,95 @@ TEST_F(OperatorsExportBinaryTest, AllTypesDictionaryNullValues) {
   EXPECT_TRUE(compare_files("src/test/binary/AllTypesDictionaryNullValues.bin", filename));
 }
 
+// Run-length encoded segments are exported in their encoded form and imported as RunLengthSegments
+TEST_F(OperatorsExportBinaryTest, RunLengthSegmentRoundTrip) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::String);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 4);
+  table->append({1, "one"});
+  table->append({1, "one"});
+  table->append({opossum::NULL_VALUE, "two"});
+  table->append({opossum::NULL_VALUE, "two"});
+  table->append({3, "three"});
+
+  ChunkEncoder::encode_all_chunks(table, EncodingType::RunLength);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto ex = std::make_shared<opossum::ExportBinary>(table_wrapper, filename);
+  ex->execute();
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(importer->get_output(), table);
+  const auto segment = importer->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RunLengthSegment<int32_t>>(segment));
+}
+
+// Dictionary segments with an attribute vector that is not byte-aligned are exported with a decompressed one
+TEST_F(OperatorsExportBinaryTest, DictionarySegmentSimdBp128RoundTrip) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::String, true);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  table->append({1, "one"});
+  table->append({opossum::NULL_VALUE, "two"});
+  table->append({3, opossum::NULL_VALUE});
+  table->append({4, "four"});
+
+  ChunkEncoder::encode_all_chunks(table,
+                                  SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto ex = std::make_shared<opossum::ExportBinary>(table_wrapper, filename);
+  ex->execute();
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(importer->get_output(), table);
+}
+
+// Materialized reference segments include the null values of nullable columns
+TEST_F(OperatorsExportBinaryTest, NullableReferenceSegmentRoundTrip) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::Float, true);
+  column_definitions.emplace_back("c", DataType::String, true);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  table->append({1, 1.1f, "one"});
+  table->append({2, opossum::NULL_VALUE, "two"});
+  table->append({3, 3.3f, opossum::NULL_VALUE});
+  table->append({4, opossum::NULL_VALUE, "four"});
+
+  // The reference segments point to segments with different encodings
+  const auto chunk_encoding_spec =
+      ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::FrameOfReference},
+                        SegmentEncodingSpec{EncodingType::RunLength}, SegmentEncodingSpec{EncodingType::Dictionary}};
+  ChunkEncoder::encode_chunk(table->get_chunk(ChunkID{1}), table->column_data_types(), chunk_encoding_spec);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan =
+      std::make_shared<TableScan>(table_wrapper, OperatorScanPredicate{ColumnID{0}, PredicateCondition::NotEquals, 1});
+  scan->execute();
+
+  auto ex = std::make_shared<opossum::ExportBinary>(scan, filename);
+  ex->execute();
+
+  auto importer = std::make_shared<opossum::ImportBinary>(filename);
+  importer->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(importer->get_output(), scan->get_output());
+}
+
 }  // namespace opossum
@@ -266,4 +266,22 @@ TEST_F(OperatorsExportCsvTest, ExportNullValuesMeta) {
   EXPECT_TRUE(meta_information.columns.at(1).nullable);
 }
 
+TEST_F(OperatorsExportCsvTest, EncodedNullValues) {
+  auto table = load_table("src/test/tables/int_float_with_null.tbl", 2);
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, EncodingType::RunLength);
+  ChunkEncoder::encode_chunks(table, {ChunkID{1}}, EncodingType::Dictionary);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto ex = std::make_shared<ExportCsv>(table_wrapper, filename);
+  ex->execute();
+
+  EXPECT_TRUE(compare_file(filename,
+                           "12345,458.7\n"
+                           "123,\n"
+                           ",456.7\n"
+                           "1234,457.7\n"));
+}
+
 }  // namespace opossum
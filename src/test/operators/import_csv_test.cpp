@@ -4,6 +4,7 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "import_export/csv_parser.hpp"
 #include "operators/import_csv.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -120,6 +121,31 @@ TEST_F(OperatorsImportCsvTest, Parallel) {
   CurrentScheduler::set(nullptr);
 }
 
+TEST_F(OperatorsImportCsvTest, SmallBlocks) {
+  // Tiny blocks split chunks, rows, and quoted linebreaks across blocks
+  TableColumnDefinitions column_definitions{{"b", DataType::Float}, {"a", DataType::Int}};
+  auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data, 20);
+  for (int i = 0; i < 100; ++i) {
+    expected_table->append({458.7f, 12345});
+  }
+
+  auto expected_escaped_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String}}, TableType::Data, 5);
+  expected_escaped_table->append({"aa\"\"aa"});
+  expected_escaped_table->append({"xx\"x"});
+  expected_escaped_table->append({"yy,y"});
+  expected_escaped_table->append({"zz\nz"});
+
+  for (const auto block_size : {size_t{1}, size_t{3}, size_t{64}}) {
+    const auto table = CsvParser{block_size, 2}.parse("src/test/csv/float_int_large.csv");
+    EXPECT_EQ(table->chunk_count(), 5u);
+    EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+    const auto escaped_table = CsvParser{block_size, 1}.parse("src/test/csv/string_escaped.csv");
+    EXPECT_TABLE_EQ_ORDERED(escaped_table, expected_escaped_table);
+  }
+}
+
 TEST_F(OperatorsImportCsvTest, SemicolonSeparator) {
   std::string csv_file = "src/test/csv/ints_semicolon_separator.csv";
   auto csv_meta = process_csv_meta_file(csv_file + CsvMeta::META_FILE_EXTENSION);
@@ -133,6 +133,31 @@ TEST_F(OperatorsInsertTest, CompressedChunks) {
   EXPECT_EQ(t->row_count(), 13u);
 }
 
+TEST_F(OperatorsInsertTest, InsertFromEncodedReferenceSegments) {
+  // The values are copied from ReferenceSegments pointing to RunLengthSegments, including NULLs
+  auto source_table = load_table("src/test/tables/int_float_with_null.tbl", 3u);
+  ChunkEncoder::encode_all_chunks(source_table, EncodingType::RunLength);
+  StorageManager::get().add_table("source_table", source_table);
+
+  auto target_table = std::make_shared<Table>(source_table->column_definitions(), TableType::Data, 3u, UseMvcc::Yes);
+  target_table->append_mutable_chunk();
+  StorageManager::get().add_table("target_table", target_table);
+
+  auto context = TransactionManager::get().new_transaction_context();
+  auto get_table = std::make_shared<GetTable>("source_table");
+  auto validate = std::make_shared<Validate>(get_table);
+  auto insert = std::make_shared<Insert>("target_table", validate);
+  insert->set_transaction_context_recursively(context);
+
+  get_table->execute();
+  validate->execute();
+  insert->execute();
+  context->commit();
+
+  EXPECT_EQ(target_table->chunk_count(), 2u);
+  EXPECT_TABLE_EQ_ORDERED(target_table, load_table("src/test/tables/int_float_with_null.tbl", 3u));
+}
+
 TEST_F(OperatorsInsertTest, Rollback) {
   auto t_name = "test3";
 
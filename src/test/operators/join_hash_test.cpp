@@ -1,4 +1,8 @@
+#include <memory>
+#include <optional>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
@@ -6,6 +10,7 @@
 #include "operators/join_hash.hpp"
 #include "operators/join_hash/hash_traits.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -21,7 +26,45 @@ class JoinHashTest : public BaseTest {
     _table_wrapper_small->execute();
   }
 
+  // The smaller input is the build relation. Running a join with both input orders covers both the build and the
+  // probe relation as the outer (or semi/anti output) relation.
+  std::shared_ptr<const Table> join(const std::vector<AllTypeVariant>& left_values,
+                                    const std::vector<AllTypeVariant>& right_values, const JoinMode mode,
+                                    const std::optional<size_t>& memory_budget = std::nullopt) {
+    const auto make_input = [](const std::vector<AllTypeVariant>& values) {
+      auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data, 2);
+      for (const auto& value : values) {
+        table->append({value});
+      }
+      auto table_wrapper = std::make_shared<TableWrapper>(table);
+      table_wrapper->execute();
+      return table_wrapper;
+    };
+
+    auto join = std::make_shared<JoinHash>(make_input(left_values), make_input(right_values), mode,
+                                           ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+    join->set_memory_budget(memory_budget);
+    join->execute();
+    return join->get_output();
+  }
+
+  std::shared_ptr<Table> make_expected_result(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    auto column_definitions = TableColumnDefinitions{};
+    for (auto column_id = size_t{0}; column_id < rows.front().size(); ++column_id) {
+      column_definitions.emplace_back("a", DataType::Int, true);
+    }
+
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+    return table;
+  }
+
   std::shared_ptr<TableWrapper> _table_wrapper_small;
+
+  const std::vector<AllTypeVariant> _small_values{1, 2, NULL_VALUE};
+  const std::vector<AllTypeVariant> _large_values{2, 2, 3, NULL_VALUE, 5};
 };
 
 #define EXPECT_HASH_TYPE(left, right, hash) EXPECT_TRUE((std::is_same_v<hash, JoinHashTraits<left, right>::HashType>))
@@ -124,4 +167,70 @@ TEST_F(JoinHashTest, OperatorName) {
   EXPECT_EQ(join->name(), "JoinHash");
 }
 
+TEST_F(JoinHashTest, OuterJoinsWithBuildAndProbeSideAsOuterRelation) {
+  // NULL values never match, but rows with a NULL value are part of the result if their relation is an outer one
+  const auto small_outer_rows = std::vector<std::vector<AllTypeVariant>>{
+      {1, NULL_VALUE}, {2, 2}, {2, 2}, {NULL_VALUE, NULL_VALUE}};
+  const auto large_outer_rows = std::vector<std::vector<AllTypeVariant>>{
+      {2, 2}, {2, 2}, {NULL_VALUE, 3}, {NULL_VALUE, NULL_VALUE}, {NULL_VALUE, 5}};
+  const auto full_outer_rows = std::vector<std::vector<AllTypeVariant>>{
+      {1, NULL_VALUE}, {2, 2}, {2, 2}, {NULL_VALUE, NULL_VALUE}, {NULL_VALUE, 3}, {NULL_VALUE, NULL_VALUE},
+      {NULL_VALUE, 5}};
+
+  const auto mirrored = [](std::vector<std::vector<AllTypeVariant>> rows) {
+    for (auto& row : rows) {
+      std::swap(row[0], row[1]);
+    }
+    return rows;
+  };
+
+  // Build side as outer relation
+  EXPECT_TABLE_EQ_UNORDERED(join(_small_values, _large_values, JoinMode::Left), make_expected_result(small_outer_rows));
+  EXPECT_TABLE_EQ_UNORDERED(join(_large_values, _small_values, JoinMode::Right),
+                            make_expected_result(mirrored(small_outer_rows)));
+
+  // Probe side as outer relation
+  EXPECT_TABLE_EQ_UNORDERED(join(_small_values, _large_values, JoinMode::Right),
+                            make_expected_result(large_outer_rows));
+  EXPECT_TABLE_EQ_UNORDERED(join(_large_values, _small_values, JoinMode::Left),
+                            make_expected_result(mirrored(large_outer_rows)));
+
+  // Both sides as outer relations
+  EXPECT_TABLE_EQ_UNORDERED(join(_small_values, _large_values, JoinMode::Outer), make_expected_result(full_outer_rows));
+  EXPECT_TABLE_EQ_UNORDERED(join(_large_values, _small_values, JoinMode::Outer),
+                            make_expected_result(mirrored(full_outer_rows)));
+}
+
+TEST_F(JoinHashTest, SemiAndAntiJoinsWithBuildAndProbeSideAsOutput) {
+  // Build side as output relation
+  EXPECT_TABLE_EQ_UNORDERED(join(_small_values, _large_values, JoinMode::Semi), make_expected_result({{2}}));
+  EXPECT_TABLE_EQ_UNORDERED(join(_small_values, _large_values, JoinMode::Anti), make_expected_result({{1}}));
+
+  // Probe side as output relation
+  EXPECT_TABLE_EQ_UNORDERED(join(_large_values, _small_values, JoinMode::Semi), make_expected_result({{2}, {2}}));
+  EXPECT_TABLE_EQ_UNORDERED(join(_large_values, _small_values, JoinMode::Anti), make_expected_result({{3}, {5}}));
+}
+
+TEST_F(JoinHashTest, SpillsInputsUnderMemoryBudget) {
+  // With a budget of one byte, each input is spilled into several files, and each pair of files is joined on its own
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Outer, JoinMode::Semi,
+                          JoinMode::Anti}) {
+    EXPECT_TABLE_EQ_UNORDERED(join(_small_values, _large_values, mode, 1), join(_small_values, _large_values, mode));
+    EXPECT_TABLE_EQ_UNORDERED(join(_large_values, _small_values, mode, 1), join(_large_values, _small_values, mode));
+  }
+
+  auto join = std::make_shared<JoinHash>(_table_wrapper_small, _table_wrapper_small, JoinMode::Inner,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  join->set_memory_budget(1);
+  join->execute();
+  EXPECT_GT(join->performance_data().spilled_bytes, 0u);
+
+  auto join_without_budget = std::make_shared<JoinHash>(_table_wrapper_small, _table_wrapper_small, JoinMode::Inner,
+                                                        ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                        PredicateCondition::Equals);
+  join_without_budget->execute();
+  EXPECT_EQ(join_without_budget->performance_data().spilled_bytes, 0u);
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), join_without_budget->get_output());
+}
+
 }  // namespace opossum
@@ -0,0 +1,205 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/multi_predicate_join_evaluator.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/*
+This contains the tests for joins with secondary predicates, e.g., joins on composite keys.
+*/
+
+template <typename T>
+class JoinMultiPredicateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto left_table =
+        std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int, true}},
+                                TableType::Data, 2);
+    left_table->append({1, 1});
+    left_table->append({1, 2});
+    left_table->append({2, 1});
+    left_table->append({2, 2});
+    left_table->append({3, NULL_VALUE});
+    _table_wrapper_left = std::make_shared<TableWrapper>(left_table);
+    _table_wrapper_left->execute();
+
+    auto right_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int}, {"c", DataType::Int}}, TableType::Data, 2);
+    right_table->append({1, 1, 10});
+    right_table->append({1, 3, 11});
+    right_table->append({2, 2, 12});
+    right_table->append({2, 2, 13});
+    right_table->append({4, 1, 14});
+    _table_wrapper_right = std::make_shared<TableWrapper>(right_table);
+    _table_wrapper_right->execute();
+
+    _output_column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, true},
+                                                        {"a", DataType::Int, true}, {"b", DataType::Int, true},
+                                                        {"c", DataType::Int, true}};
+  }
+
+  std::shared_ptr<const Table> join(const JoinMode mode, const PredicateCondition secondary_predicate_condition) {
+    const auto secondary_predicates =
+        std::vector<OperatorJoinPredicate>{{{ColumnID{1}, ColumnID{1}}, secondary_predicate_condition}};
+    auto join = std::make_shared<T>(_table_wrapper_left, _table_wrapper_right, mode,
+                                    ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals,
+                                    secondary_predicates);
+    join->execute();
+    return join->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left, _table_wrapper_right;
+  TableColumnDefinitions _output_column_definitions;
+};
+
+using JoinMultiPredicateTypes = ::testing::Types<JoinHash, JoinSortMerge>;
+TYPED_TEST_CASE(JoinMultiPredicateTest, JoinMultiPredicateTypes);
+
+TYPED_TEST(JoinMultiPredicateTest, InnerJoinOnCompositeKey) {
+  auto expected_result = std::make_shared<Table>(this->_output_column_definitions, TableType::Data);
+  expected_result->append({1, 1, 1, 1, 10});
+  expected_result->append({2, 2, 2, 2, 12});
+  expected_result->append({2, 2, 2, 2, 13});
+
+  EXPECT_TABLE_EQ_UNORDERED(this->join(JoinMode::Inner, PredicateCondition::Equals), expected_result);
+}
+
+TYPED_TEST(JoinMultiPredicateTest, InnerJoinWithNonEquiSecondaryPredicate) {
+  auto expected_result = std::make_shared<Table>(this->_output_column_definitions, TableType::Data);
+  expected_result->append({1, 1, 1, 3, 11});
+  expected_result->append({1, 2, 1, 3, 11});
+  expected_result->append({2, 1, 2, 2, 12});
+  expected_result->append({2, 1, 2, 2, 13});
+
+  EXPECT_TABLE_EQ_UNORDERED(this->join(JoinMode::Inner, PredicateCondition::LessThan), expected_result);
+}
+
+TYPED_TEST(JoinMultiPredicateTest, LeftJoinOnCompositeKey) {
+  // Rows that match the primary, but not the secondary predicate are padded with NULLs
+  auto expected_result = std::make_shared<Table>(this->_output_column_definitions, TableType::Data);
+  expected_result->append({1, 1, 1, 1, 10});
+  expected_result->append({1, 2, NULL_VALUE, NULL_VALUE, NULL_VALUE});
+  expected_result->append({2, 1, NULL_VALUE, NULL_VALUE, NULL_VALUE});
+  expected_result->append({2, 2, 2, 2, 12});
+  expected_result->append({2, 2, 2, 2, 13});
+  expected_result->append({3, NULL_VALUE, NULL_VALUE, NULL_VALUE, NULL_VALUE});
+
+  EXPECT_TABLE_EQ_UNORDERED(this->join(JoinMode::Left, PredicateCondition::Equals), expected_result);
+}
+
+TYPED_TEST(JoinMultiPredicateTest, RightJoinOnCompositeKey) {
+  auto expected_result = std::make_shared<Table>(this->_output_column_definitions, TableType::Data);
+  expected_result->append({1, 1, 1, 1, 10});
+  expected_result->append({NULL_VALUE, NULL_VALUE, 1, 3, 11});
+  expected_result->append({2, 2, 2, 2, 12});
+  expected_result->append({2, 2, 2, 2, 13});
+  expected_result->append({NULL_VALUE, NULL_VALUE, 4, 1, 14});
+
+  EXPECT_TABLE_EQ_UNORDERED(this->join(JoinMode::Right, PredicateCondition::Equals), expected_result);
+}
+
+TYPED_TEST(JoinMultiPredicateTest, ReferenceInputs) {
+  // The secondary predicates are evaluated on the positions of the reference tables
+  const auto left_scan = std::make_shared<TableScan>(
+      this->_table_wrapper_left, OperatorScanPredicate{ColumnID{0}, PredicateCondition::GreaterThan, 1});
+  left_scan->execute();
+  const auto right_scan = std::make_shared<TableScan>(
+      this->_table_wrapper_right, OperatorScanPredicate{ColumnID{2}, PredicateCondition::GreaterThan, 12});
+  right_scan->execute();
+
+  const auto secondary_predicates =
+      std::vector<OperatorJoinPredicate>{{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals}};
+  auto join = std::make_shared<TypeParam>(left_scan, right_scan, JoinMode::Inner,
+                                          ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals,
+                                          secondary_predicates);
+  join->execute();
+
+  auto expected_result = std::make_shared<Table>(this->_output_column_definitions, TableType::Data);
+  expected_result->append({2, 2, 2, 2, 13});
+
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
+}
+
+class JoinHashMultiPredicateTest : public BaseTest {};
+
+TEST_F(JoinHashMultiPredicateTest, SemiAndAntiJoinOnCompositeKey) {
+  auto left_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int}},
+                                            TableType::Data);
+  left_table->append({1, 1});
+  left_table->append({1, 2});
+  left_table->append({2, 1});
+  const auto table_wrapper_left = std::make_shared<TableWrapper>(left_table);
+  table_wrapper_left->execute();
+
+  auto right_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int}},
+                                             TableType::Data);
+  right_table->append({1, 2});
+  right_table->append({2, 2});
+  const auto table_wrapper_right = std::make_shared<TableWrapper>(right_table);
+  table_wrapper_right->execute();
+
+  const auto secondary_predicates =
+      std::vector<OperatorJoinPredicate>{{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals}};
+
+  auto semi_join = std::make_shared<JoinHash>(table_wrapper_left, table_wrapper_right, JoinMode::Semi,
+                                              ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals,
+                                              secondary_predicates);
+  semi_join->execute();
+
+  auto expected_semi_result = std::make_shared<Table>(left_table->column_definitions(), TableType::Data);
+  expected_semi_result->append({1, 2});
+  EXPECT_TABLE_EQ_UNORDERED(semi_join->get_output(), expected_semi_result);
+
+  auto anti_join = std::make_shared<JoinHash>(table_wrapper_left, table_wrapper_right, JoinMode::Anti,
+                                              ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals,
+                                              secondary_predicates);
+  anti_join->execute();
+
+  auto expected_anti_result = std::make_shared<Table>(left_table->column_definitions(), TableType::Data);
+  expected_anti_result->append({1, 1});
+  expected_anti_result->append({2, 1});
+  EXPECT_TABLE_EQ_UNORDERED(anti_join->get_output(), expected_anti_result);
+}
+
+class MultiPredicateJoinEvaluatorTest : public BaseTest {};
+
+TEST_F(MultiPredicateJoinEvaluatorTest, ChunksReferencingDifferentTables) {
+  auto data_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 2);
+  data_table->append({1});
+  data_table->append({2});
+  data_table->append({3});
+  data_table->append({4});
+
+  // A copy of the table that holds its chunks in reverse order
+  auto reversed_table = std::make_shared<Table>(data_table->column_definitions(), TableType::Data, 2);
+  reversed_table->append_chunk(data_table->get_chunk(ChunkID{1}));
+  reversed_table->append_chunk(data_table->get_chunk(ChunkID{0}));
+
+  // The first chunk references the values 1 and 2 in the table, the second one the values 3 and 4 in the copy
+  const auto pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 1}});
+  auto reference_table = std::make_shared<Table>(data_table->column_definitions(), TableType::References);
+  reference_table->append_chunk(Segments{std::make_shared<ReferenceSegment>(data_table, ColumnID{0}, pos_list)});
+  reference_table->append_chunk(Segments{std::make_shared<ReferenceSegment>(reversed_table, ColumnID{0}, pos_list)});
+
+  const auto evaluator = MultiPredicateJoinEvaluator{
+      *reference_table, *data_table, {{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals}}};
+
+  EXPECT_TRUE(evaluator.satisfies_all_predicates(RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 0}));
+  EXPECT_TRUE(evaluator.satisfies_all_predicates(RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 1}));
+  EXPECT_TRUE(evaluator.satisfies_all_predicates(RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 0}));
+  EXPECT_TRUE(evaluator.satisfies_all_predicates(RowID{ChunkID{1}, 1}, RowID{ChunkID{1}, 1}));
+  EXPECT_FALSE(evaluator.satisfies_all_predicates(RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,137 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/get_table.hpp"
+#include "operators/operator_pipeline.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Four chunks with the values 0 to 11, the first row is invalidated
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Float}},
+                                     TableType::Data, 3, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 12; ++value) {
+      _table->append({value, static_cast<float>(value) / 2});
+    }
+    _table->get_chunk(ChunkID{0})->get_scoped_mvcc_data_lock()->end_cids[0] = CommitID{0};
+    StorageManager::get().add_table("table_a", _table);
+
+    _a = PQPColumnExpression::from_table(*_table, "a");
+    _b = PQPColumnExpression::from_table(*_table, "b");
+  }
+
+  // GetTable -> Validate -> TableScan -> Projection
+  std::vector<std::shared_ptr<AbstractOperator>> make_operators(
+      const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+    auto get_table = std::make_shared<GetTable>("table_a");
+    auto validate = std::make_shared<Validate>(get_table);
+    auto table_scan = std::make_shared<TableScan>(
+        validate, OperatorScanPredicate{ColumnID{0}, PredicateCondition::GreaterThanEquals, 2});
+    auto projection = std::make_shared<Projection>(table_scan, expressions);
+
+    projection->set_transaction_context_recursively(TransactionManager::get().new_transaction_context());
+    return {get_table, validate, table_scan, projection};
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<PQPColumnExpression> _a, _b;
+};
+
+TEST_F(OperatorPipelineTest, ResultMatchesOperatorByOperatorExecution) {
+  const auto expressions = expression_vector(add_(_a, 1), _b);
+
+  const auto operators = make_operators(expressions);
+  for (const auto& op : operators) {
+    op->execute();
+  }
+
+  const auto pipelined_operators = make_operators(expressions);
+  pipelined_operators[0]->execute();
+  auto pipeline = OperatorPipeline{{pipelined_operators[1], pipelined_operators[2], pipelined_operators[3]}};
+  pipeline.execute();
+
+  // The operators inside of the pipeline do not materialize their output
+  EXPECT_EQ(pipelined_operators[1]->get_output(), nullptr);
+  EXPECT_EQ(pipelined_operators[2]->get_output(), nullptr);
+
+  // One chunk per input chunk, in the order of the input chunks
+  const auto output = pipelined_operators[3]->get_output();
+  ASSERT_NE(output, nullptr);
+  EXPECT_EQ(output->chunk_count(), 4u);
+  EXPECT_TABLE_EQ_ORDERED(output, operators[3]->get_output());
+  EXPECT_EQ(pipelined_operators[3]->performance_data().output_row_count, 10u);
+
+  // The operators inside of the pipeline report the rows they emitted for all chunks
+  EXPECT_EQ(pipelined_operators[1]->performance_data().output_row_count, 11u);
+  EXPECT_EQ(pipelined_operators[2]->performance_data().output_row_count, 10u);
+}
+
+TEST_F(OperatorPipelineTest, ReferencesPointToInputTable) {
+  const auto operators = make_operators(expression_vector(_b, _a));
+  operators[0]->execute();
+  auto pipeline = OperatorPipeline{{operators[1], operators[2], operators[3]}};
+  pipeline.execute();
+
+  // The forwarded references point to the stored table with the ChunkIDs of the stored table
+  const auto output = operators[3]->get_output();
+  ASSERT_EQ(output->chunk_count(), 4u);
+  const auto reference_segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(output->get_chunk(ChunkID{2})->get_segment(ColumnID{1}));
+  ASSERT_NE(reference_segment, nullptr);
+  EXPECT_EQ(reference_segment->referenced_table(), operators[0]->get_output());
+  EXPECT_EQ(reference_segment->referenced_column_id(), ColumnID{0});
+  EXPECT_EQ((*reference_segment->pos_list())[0], (RowID{ChunkID{2}, ChunkOffset{0}}));
+}
+
+TEST_F(OperatorPipelineTest, RowBudget) {
+  const auto operators = make_operators(expression_vector(_a));
+  operators[3]->set_row_budget(4);
+  operators[0]->execute();
+  auto pipeline = OperatorPipeline{{operators[1], operators[2], operators[3]}};
+  pipeline.execute();
+
+  // The first chunk contributes one row, the second one three rows. The other chunks are not processed.
+  const auto output = operators[3]->get_output();
+  EXPECT_EQ(output->chunk_count(), 2u);
+  EXPECT_EQ(output->row_count(), 4u);
+
+  // The operators inside of the pipeline did not see all rows
+  EXPECT_FALSE(operators[1]->performance_data().output_row_count);
+  EXPECT_FALSE(operators[2]->performance_data().output_row_count);
+}
+
+TEST_F(OperatorPipelineTest, PipelineBreakers) {
+  const auto operators = make_operators(expression_vector(add_(_a, 1)));
+  EXPECT_TRUE(operators[0]->is_pipeline_breaker());
+  EXPECT_FALSE(operators[1]->is_pipeline_breaker());
+  EXPECT_FALSE(operators[2]->is_pipeline_breaker());
+  EXPECT_FALSE(operators[3]->is_pipeline_breaker());
+
+  auto table_scan =
+      std::make_shared<TableScan>(operators[0], OperatorScanPredicate{ColumnID{0}, PredicateCondition::Equals, 1});
+  table_scan->set_excluded_chunk_ids({ChunkID{1}});
+  EXPECT_TRUE(table_scan->is_pipeline_breaker());
+
+  const auto projection =
+      std::make_shared<Projection>(operators[0], expression_vector(add_(_a, parameter_(ParameterID{0}))));
+  EXPECT_TRUE(projection->is_pipeline_breaker());
+}
+
+}  // namespace opossum
@@ -14,6 +14,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -79,7 +80,9 @@ TEST_F(OperatorsProjectionTest, ForwardsIfPossibleDataTableAndExpression) {
   EXPECT_EQ(input_chunk->get_segment(ColumnID{0}), output_chunk->get_segment(ColumnID{1}));
 }
 
-TEST_F(OperatorsProjectionTest, DontForwardReferencesWithExpression) {
+TEST_F(OperatorsProjectionTest, ForwardsReferencesWithExpression) {
+  // Forwarded ReferenceSegments are kept next to computed columns, which reference an internal table
+
   const auto table_scan = std::make_shared<TableScan>(
       table_wrapper_a, OperatorScanPredicate{ColumnID{0}, PredicateCondition::LessThan, 100'000});
   table_scan->execute();
@@ -87,11 +90,44 @@ TEST_F(OperatorsProjectionTest, DontForwardReferencesWithExpression) {
       std::make_shared<opossum::Projection>(table_scan, expression_vector(a_b, a_a, add_(a_b, a_a)));
   projection->execute();
 
-  const auto input_chunk = table_wrapper_a->get_output()->get_chunk(ChunkID{0});
-  const auto output_chunk = projection->get_output()->get_chunk(ChunkID{0});
+  const auto output_table = projection->get_output();
+  EXPECT_EQ(output_table->type(), TableType::References);
+  EXPECT_EQ(output_table->chunk_count(), table_scan->get_output()->chunk_count());
 
-  EXPECT_NE(input_chunk->get_segment(ColumnID{1}), output_chunk->get_segment(ColumnID{0}));
-  EXPECT_NE(input_chunk->get_segment(ColumnID{0}), output_chunk->get_segment(ColumnID{1}));
+  const auto input_chunk = table_scan->get_output()->get_chunk(ChunkID{0});
+  const auto output_chunk = output_table->get_chunk(ChunkID{0});
+
+  EXPECT_EQ(input_chunk->get_segment(ColumnID{1}), output_chunk->get_segment(ColumnID{0}));
+  EXPECT_EQ(input_chunk->get_segment(ColumnID{0}), output_chunk->get_segment(ColumnID{1}));
+
+  const auto computed_segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(output_chunk->get_segment(ColumnID{2}));
+  ASSERT_NE(computed_segment, nullptr);
+  EXPECT_EQ(computed_segment->referenced_table()->type(), TableType::Data);
+
+  const auto data_projection =
+      std::make_shared<opossum::Projection>(table_wrapper_a, expression_vector(a_b, a_a, add_(a_b, a_a)));
+  data_projection->execute();
+  EXPECT_TABLE_EQ_ORDERED(output_table, data_projection->get_output());
+}
+
+TEST_F(OperatorsProjectionTest, FoldsConstantExpressions) {
+  const auto parameter = parameter_(ParameterID{0});
+  parameter->set_value(3);
+
+  EXPECT_EQ(*Projection::fold_constant_expressions(add_(1, 2)), *value_(3));
+  EXPECT_EQ(*Projection::fold_constant_expressions(mul_(a_a, add_(parameter, 2))), *mul_(a_a, 5));
+  EXPECT_EQ(*Projection::fold_constant_expressions(add_(a_a, a_b)), *add_(a_a, a_b));
+
+  const auto projection =
+      std::make_shared<opossum::Projection>(table_wrapper_a, expression_vector(add_(a_a, 3), add_(a_a, add_(1, 2))));
+  projection->execute();
+
+  const auto& output_table = projection->get_output();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < output_table->row_count(); ++chunk_offset) {
+    EXPECT_EQ(output_table->get_value<int32_t>(ColumnID{0}, chunk_offset),
+              output_table->get_value<int32_t>(ColumnID{1}, chunk_offset));
+  }
 }
 
 TEST_F(OperatorsProjectionTest, ForwardsIfPossibleReferenceTable) {
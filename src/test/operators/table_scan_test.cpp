@@ -316,6 +316,91 @@ TEST_P(OperatorsTableScanTest, ScanOnReferencedCompressedSegments) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, ScanBetweenOnCompressedSegments) {
+  const auto tests = std::vector<std::pair<std::pair<int32_t, int32_t>, std::vector<AllTypeVariant>>>{
+      {{4, 9}, {104, 106, 108, 104, 106, 108}},
+      {{5, 6}, {106, 106}},
+      {{6, 6}, {106, 106}},
+      {{-5, 20}, {100, 102, 104, 106, 108, 110, 112, 100, 102, 104, 106, 108, 110, 112}},
+      {{0, 0}, {100, 100}},
+      {{13, 20}, {}},
+      {{-5, -1}, {}},
+      {{9, 4}, {}}};
+
+  const auto referencing_scan = std::make_shared<TableScan>(
+      _int_int_compressed, OperatorScanPredicate{ColumnID{1}, PredicateCondition::IsNotNull});
+  referencing_scan->execute();
+
+  for (const auto& [bounds, expected] : tests) {
+    const auto predicate = OperatorScanPredicate{ColumnID{0}, PredicateCondition::Between, bounds.first, bounds.second};
+
+    auto scan_int = std::make_shared<TableScan>(_int_int_compressed, predicate);
+    scan_int->execute();
+    ASSERT_COLUMN_EQ(scan_int->get_output(), ColumnID{1}, expected);
+
+    auto scan_int_partly = std::make_shared<TableScan>(_int_int_partly_compressed, predicate);
+    scan_int_partly->execute();
+    ASSERT_COLUMN_EQ(scan_int_partly->get_output(), ColumnID{1}, expected);
+
+    auto scan_int_referenced = std::make_shared<TableScan>(referencing_scan, predicate);
+    scan_int_referenced->execute();
+    ASSERT_COLUMN_EQ(scan_int_referenced->get_output(), ColumnID{1}, expected);
+  }
+}
+
+TEST_P(OperatorsTableScanTest, ScanInOnCompressedSegments) {
+  const auto tests = std::vector<std::pair<std::vector<AllTypeVariant>, std::vector<AllTypeVariant>>>{
+      {{2, 8}, {102, 108, 102, 108}},
+      {{8, 7, 2, 8}, {102, 108, 102, 108}},
+      {{0, 2, 4, 6, 8, 10, 12}, {100, 102, 104, 106, 108, 110, 112, 100, 102, 104, 106, 108, 110, 112}},
+      {{1, 3, 13}, {}},
+      {{}, {}}};
+
+  const auto referencing_scan = std::make_shared<TableScan>(
+      _int_int_compressed, OperatorScanPredicate{ColumnID{1}, PredicateCondition::IsNotNull});
+  referencing_scan->execute();
+
+  for (const auto& [value_list, expected] : tests) {
+    const auto predicate = OperatorScanPredicate{ColumnID{0}, PredicateCondition::In, value_list};
+
+    auto scan_int = std::make_shared<TableScan>(_int_int_compressed, predicate);
+    scan_int->execute();
+    ASSERT_COLUMN_EQ(scan_int->get_output(), ColumnID{1}, expected);
+
+    auto scan_int_partly = std::make_shared<TableScan>(_int_int_partly_compressed, predicate);
+    scan_int_partly->execute();
+    ASSERT_COLUMN_EQ(scan_int_partly->get_output(), ColumnID{1}, expected);
+
+    auto scan_int_referenced = std::make_shared<TableScan>(referencing_scan, predicate);
+    scan_int_referenced->execute();
+    ASSERT_COLUMN_EQ(scan_int_referenced->get_output(), ColumnID{1}, expected);
+  }
+}
+
+TEST_P(OperatorsTableScanTest, ScanBetweenAndInWithNullValues) {
+  auto table = load_table("src/test/tables/int_int_w_null_8_rows.tbl", 4);
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, {_encoding_type});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan_between = std::make_shared<TableScan>(
+      table_wrapper, OperatorScanPredicate{ColumnID{0}, PredicateCondition::Between, 100, 2000});
+  scan_between->execute();
+  ASSERT_COLUMN_EQ(scan_between->get_output(), ColumnID{0}, {123, 1234, 1234});
+
+  auto scan_between_null = std::make_shared<TableScan>(
+      table_wrapper, OperatorScanPredicate{ColumnID{0}, PredicateCondition::Between, 100, NULL_VALUE});
+  scan_between_null->execute();
+  EXPECT_EQ(scan_between_null->get_output()->row_count(), 0u);
+
+  auto scan_in = std::make_shared<TableScan>(
+      table_wrapper,
+      OperatorScanPredicate{ColumnID{0}, PredicateCondition::In, std::vector<AllTypeVariant>{12, 99, 123}});
+  scan_in->execute();
+  ASSERT_COLUMN_EQ(scan_in->get_output(), ColumnID{0}, {123, 12, 12});
+}
+
 TEST_P(OperatorsTableScanTest, ScanWeirdPosList) {
   std::map<PredicateCondition, std::vector<AllTypeVariant>> tests;
   tests[PredicateCondition::Equals] = {110, 110};
@@ -667,6 +752,68 @@ TEST_P(OperatorsTableScanTest, SetParameters) {
   scan_c->set_parameters(parameters);
   EXPECT_EQ(scan_c->predicate().column_id, ColumnID{0});
   EXPECT_EQ(scan_c->predicate().value, AllParameterVariant{ParameterID{4}});
+
+  const auto scan_d = std::make_shared<TableScan>(
+      _int_int_compressed,
+      OperatorScanPredicate{ColumnID{0}, PredicateCondition::Between, ParameterID{3}, ParameterID{2}});
+  scan_d->set_parameters(parameters);
+  EXPECT_EQ(scan_d->predicate().value, AllParameterVariant{5});
+  EXPECT_EQ(scan_d->predicate().value2, AllParameterVariant{6});
+}
+
+TEST_P(OperatorsTableScanTest, RowBudget) {
+  // Three chunks with one row each, all of them match
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 1));
+  table_wrapper->execute();
+
+  // Without a scheduler, the chunks are scanned one after another. The third one is not scanned anymore.
+  auto scan = std::make_shared<TableScan>(table_wrapper,
+                                          OperatorScanPredicate{ColumnID{0}, PredicateCondition::GreaterThan, 0});
+  scan->set_row_budget(2);
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 2u);
+}
+
+class OperatorsTableScanVectorCompressionTest : public BaseTest,
+                                                public ::testing::WithParamInterface<VectorCompressionType> {};
+
+INSTANTIATE_TEST_CASE_P(VectorCompressionTypes, OperatorsTableScanVectorCompressionTest,
+                        ::testing::Values(VectorCompressionType::FixedSizeByteAligned,
+                                          VectorCompressionType::SimdBp128), );  // NOLINT
+
+TEST_P(OperatorsTableScanVectorCompressionTest, ScanOnDictionarySegments) {
+  // Large enough for several SimdBp128 blocks and a 16-bit FixedSizeByteAligned vector. Every seventh value is NULL.
+  const auto create_table = []() {
+    auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+    for (auto index = 0; index < 5'000; ++index) {
+      table->append({index % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index % 300}});
+    }
+    return table;
+  };
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(create_table());
+  table_wrapper->execute();
+
+  const auto encoded_table = create_table();
+  ChunkEncoder::encode_all_chunks(encoded_table, SegmentEncodingSpec{EncodingType::Dictionary, GetParam()});
+  const auto encoded_table_wrapper = std::make_shared<TableWrapper>(encoded_table);
+  encoded_table_wrapper->execute();
+
+  const auto predicates = std::vector<OperatorScanPredicate>{
+      {ColumnID{0}, PredicateCondition::Equals, 150},       {ColumnID{0}, PredicateCondition::NotEquals, 150},
+      {ColumnID{0}, PredicateCondition::LessThan, 150},     {ColumnID{0}, PredicateCondition::LessThanEquals, 150},
+      {ColumnID{0}, PredicateCondition::GreaterThan, 150},  {ColumnID{0}, PredicateCondition::GreaterThanEquals, 0},
+      {ColumnID{0}, PredicateCondition::Between, 100, 200}, {ColumnID{0}, PredicateCondition::Between, 250, 1000}};
+
+  for (const auto& predicate : predicates) {
+    const auto scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    scan->execute();
+
+    const auto encoded_scan = std::make_shared<TableScan>(encoded_table_wrapper, predicate);
+    encoded_scan->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(encoded_scan->get_output(), scan->get_output());
+  }
 }
 
 }  // namespace opossum
@@ -255,6 +255,51 @@ TEST_F(LQPTranslatorTest, PredicateNodeBetween) {
   EXPECT_EQ(get_table_op->table_name(), "table_int_float");
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodeBetweenValues) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float WHERE a BETWEEN 5 AND 10;
+   */
+  const auto predicate_node = PredicateNode::make(between(int_float_a, 5, 10), int_float_node);
+  const auto pqp = LQPTranslator{}.translate_node(predicate_node);
+
+  /**
+   * Check PQP - BETWEEN with values as bounds is handled by a single TableScan
+   */
+  const auto table_scan_op = std::dynamic_pointer_cast<const TableScan>(pqp);
+  ASSERT_TRUE(table_scan_op);
+  EXPECT_EQ(table_scan_op->predicate().column_id, ColumnID{0});
+  EXPECT_EQ(table_scan_op->predicate().predicate_condition, PredicateCondition::Between);
+  EXPECT_EQ(table_scan_op->predicate().value, AllParameterVariant(5));
+  EXPECT_EQ(table_scan_op->predicate().value2, AllParameterVariant(10));
+
+  const auto get_table_op = std::dynamic_pointer_cast<const GetTable>(pqp->input_left());
+  ASSERT_TRUE(get_table_op);
+  EXPECT_EQ(get_table_op->table_name(), "table_int_float");
+}
+
+TEST_F(LQPTranslatorTest, PredicateNodeInList) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float WHERE a IN (1, 3, 5);
+   */
+  const auto predicate_node = PredicateNode::make(in_(int_float_a, list_(1, 3, 5)), int_float_node);
+  const auto pqp = LQPTranslator{}.translate_node(predicate_node);
+
+  /**
+   * Check PQP
+   */
+  const auto table_scan_op = std::dynamic_pointer_cast<const TableScan>(pqp);
+  ASSERT_TRUE(table_scan_op);
+  EXPECT_EQ(table_scan_op->predicate().column_id, ColumnID{0});
+  EXPECT_EQ(table_scan_op->predicate().predicate_condition, PredicateCondition::In);
+  EXPECT_EQ(table_scan_op->predicate().value_list, std::vector<AllTypeVariant>({1, 3, 5}));
+}
+
 TEST_F(LQPTranslatorTest, SelectExpressionCorrelated) {
   /**
    * Build LQP and translate to PQP
@@ -408,6 +453,52 @@ TEST_F(LQPTranslatorTest, LimitLiteral) {
   EXPECT_EQ(get_table->table_name(), "table_int_float");
 }
 
+TEST_F(LQPTranslatorTest, LimitSetsRowBudget) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT a + 1 FROM int_float WHERE b > 42 LIMIT 10
+   */
+  const auto predicate_node = PredicateNode::make(greater_than_(int_float_b, 42), int_float_node);
+  const auto lqp = LimitNode::make(value_(static_cast<int64_t>(10)),
+                                   ProjectionNode::make(expression_vector(add_(int_float_a, 1)), predicate_node));
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP: The Projection outputs one row per input row, so the budget is passed on to the TableScan, but not to
+   * the input of the TableScan
+   */
+  const auto projection = pqp->input_left();
+  ASSERT_EQ(projection->type(), OperatorType::Projection);
+  EXPECT_EQ(projection->row_budget(), 10u);
+
+  const auto table_scan = projection->input_left();
+  ASSERT_EQ(table_scan->type(), OperatorType::TableScan);
+  EXPECT_EQ(table_scan->row_budget(), 10u);
+  EXPECT_FALSE(table_scan->input_left()->row_budget());
+}
+
+TEST_F(LQPTranslatorTest, LimitDoesNotSetRowBudgetOfSharedInputs) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   (SELECT * FROM int_float WHERE b > 42 LIMIT 10) UNION (SELECT * FROM int_float WHERE b > 42)
+   */
+  const auto predicate_node = PredicateNode::make(greater_than_(int_float_b, 42), int_float_node);
+  const auto limit_node = LimitNode::make(value_(static_cast<int64_t>(10)), predicate_node);
+  const auto union_node = UnionNode::make(UnionMode::Positions, limit_node, predicate_node);
+  const auto pqp = LQPTranslator{}.translate_node(union_node);
+
+  /**
+   * Check PQP
+   */
+  const auto table_scan = pqp->input_right();
+  ASSERT_EQ(table_scan->type(), OperatorType::TableScan);
+  EXPECT_FALSE(table_scan->row_budget());
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeUnaryScan) {
   /**
    * Build LQP and translate to PQP
@@ -515,15 +606,10 @@ TEST_F(LQPTranslatorTest, PredicateNodeBinaryIndexScan) {
   ASSERT_TRUE(table_scan_op);
   EXPECT_EQ(get_excluded_chunk_ids(table_scan_op), index_chunk_ids);
   EXPECT_EQ(table_scan_op->predicate().column_id, ColumnID{1} /* "a" */);
-  EXPECT_EQ(table_scan_op->predicate().predicate_condition, PredicateCondition::LessThanEquals);
-  EXPECT_EQ(table_scan_op->predicate().value, AllParameterVariant(1337));
-
-  const auto table_scan_op2 = std::dynamic_pointer_cast<const TableScan>(table_scan_op->input_left());
-  ASSERT_TRUE(table_scan_op2);
-  EXPECT_EQ(get_excluded_chunk_ids(table_scan_op2), index_chunk_ids);
-  EXPECT_EQ(table_scan_op2->predicate().column_id, ColumnID{1} /* "a" */);
-  EXPECT_EQ(table_scan_op2->predicate().predicate_condition, PredicateCondition::GreaterThanEquals);
-  EXPECT_EQ(table_scan_op2->predicate().value, AllParameterVariant(42));
+  EXPECT_EQ(table_scan_op->predicate().predicate_condition, PredicateCondition::Between);
+  EXPECT_EQ(table_scan_op->predicate().value, AllParameterVariant(42));
+  EXPECT_EQ(table_scan_op->predicate().value2, AllParameterVariant(1337));
+  EXPECT_EQ(table_scan_op->input_left()->type(), OperatorType::GetTable);
 }
 
 TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
@@ -575,7 +661,7 @@ TEST_F(LQPTranslatorTest, JoinNode) {
   /**
    * Check PQP
    */
-  const auto join_op = std::dynamic_pointer_cast<JoinSortMerge>(op);
+  const auto join_op = std::dynamic_pointer_cast<JoinHash>(op);
   ASSERT_TRUE(join_op);
   EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{1}, ColumnID{0}));
   EXPECT_EQ(join_op->predicate_condition(), PredicateCondition::Equals);
@@ -638,6 +724,38 @@ TEST_F(LQPTranslatorTest, AggregateNodeSimple) {
   EXPECT_EQ(aggregate_definition.function, AggregateFunction::Sum);
 }
 
+TEST_F(LQPTranslatorTest, AggregateNodeStrategy) {
+  const auto translate_aggregate = [](const std::shared_ptr<AbstractLQPNode>& lqp) {
+    const auto aggregate_op = std::dynamic_pointer_cast<Aggregate>(LQPTranslator{}.translate_node(lqp));
+    EXPECT_TRUE(aggregate_op);
+    return aggregate_op ? aggregate_op->strategy() : AggregateStrategy::Hash;
+  };
+  const auto order_by_modes = std::vector<OrderByMode>{OrderByMode::Ascending, OrderByMode::Descending};
+
+  // The input is sorted by the group-by columns, in a different order
+  // clang-format off
+  EXPECT_EQ(translate_aggregate(
+    AggregateNode::make(expression_vector(int_float_b, int_float_a), expression_vector(),
+      ProjectionNode::make(expression_vector(int_float_a, int_float_b),
+        SortNode::make(expression_vector(int_float_a, int_float_b), order_by_modes,
+          int_float_node)))), AggregateStrategy::SortBased);
+
+  // The input is sorted by another column first
+  EXPECT_EQ(translate_aggregate(
+    AggregateNode::make(expression_vector(int_float_a), expression_vector(sum_(int_float_b)),
+      SortNode::make(expression_vector(int_float_b, int_float_a), order_by_modes,
+        int_float_node))), AggregateStrategy::DirectArray);
+
+  EXPECT_EQ(translate_aggregate(
+    AggregateNode::make(expression_vector(int_float_a, int_float_b), expression_vector(),
+      int_float_node)), AggregateStrategy::Hash);
+
+  EXPECT_EQ(translate_aggregate(
+    AggregateNode::make(expression_vector(), expression_vector(sum_(int_float_b)),
+      int_float_node)), AggregateStrategy::Hash);
+  // clang-format on
+}
+
 TEST_F(LQPTranslatorTest, MultipleNodesHierarchy) {
   /**
    * Build LQP and translate to PQP
@@ -674,6 +792,39 @@ TEST_F(LQPTranslatorTest, MultipleNodesHierarchy) {
   EXPECT_EQ(get_table_op_right->table_name(), "table_int_float2");
 }
 
+TEST_F(LQPTranslatorTest, JoinWithSecondaryPredicates) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(less_than_(int_float2_b, int_float_b),
+    PredicateNode::make(equals_(int_float_b, int_float2_b),
+      JoinNode::make(JoinMode::Inner, greater_than_(int_float_a, int_float2_a),
+        int_float_node,
+        int_float2_node)));
+  // clang-format on
+
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP - the predicates are evaluated by the join, the equi predicate becomes the primary predicate
+   */
+  const auto join_op = std::dynamic_pointer_cast<const JoinHash>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{1}, ColumnID{1}));
+  EXPECT_EQ(join_op->predicate_condition(), PredicateCondition::Equals);
+
+  ASSERT_EQ(join_op->secondary_predicates().size(), 2u);
+  EXPECT_EQ(join_op->secondary_predicates()[0].column_ids, ColumnIDPair(ColumnID{1}, ColumnID{1}));
+  EXPECT_EQ(join_op->secondary_predicates()[0].predicate_condition, PredicateCondition::GreaterThan);
+  EXPECT_EQ(join_op->secondary_predicates()[1].column_ids, ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_op->secondary_predicates()[1].predicate_condition, PredicateCondition::GreaterThan);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(join_op->input_left()));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(join_op->input_right()));
+}
+
 TEST_F(LQPTranslatorTest, LimitNode) {
   /**
    * Build LQP and translate to PQP
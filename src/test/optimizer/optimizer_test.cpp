@@ -1,13 +1,19 @@
 #include "gtest/gtest.h"
 
+#include "cost_model/cost_model_logical.hpp"
+#include "cost_model/cost_model_physical.hpp"
 #include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/limit_node.hpp"
 #include "logical_query_plan/logical_plan_root_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/projection_node.hpp"
 #include "optimizer/optimizer.hpp"
 #include "optimizer/strategy/abstract_rule.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "testing_assert.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -210,4 +216,68 @@ TEST_F(OptimizerTest, OptimizesSubqueriesExactlyOnce) {
   EXPECT_LQP_EQ(select_b_a->lqp, select_lqp_b);
 }
 
+TEST_F(OptimizerTest, DefaultOptimizerOrdersJoinsByCostEstimator) {
+  /**
+   * A is joined with B and C. Joining A and B first yields the smaller intermediate result, which CostModelLogical
+   * prefers. With a CostModelPhysical that only accounts for the build inputs of the JoinHashes, joining A and C first
+   * is cheaper: B is the smaller input of the second join then.
+   */
+  const auto make_column_statistics = [](const float distinct_count) {
+    return std::make_shared<ColumnStatistics<int32_t>>(0.0f, distinct_count, 0, 99);
+  };
+
+  const auto node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "x"}, {DataType::Int, "y"}}, "a");
+  node_a->set_statistics(std::make_shared<TableStatistics>(
+      TableType::Data, 100,
+      std::vector<std::shared_ptr<const BaseColumnStatistics>>{make_column_statistics(5),
+                                                               make_column_statistics(100)}));
+  const auto node_b = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "x"}}, "b");
+  node_b->set_statistics(std::make_shared<TableStatistics>(
+      TableType::Data, 10, std::vector<std::shared_ptr<const BaseColumnStatistics>>{make_column_statistics(5)}));
+  const auto node_c = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "y"}}, "c");
+  node_c->set_statistics(std::make_shared<TableStatistics>(
+      TableType::Data, 1'000, std::vector<std::shared_ptr<const BaseColumnStatistics>>{make_column_statistics(100)}));
+
+  const auto a_x = node_a->get_column("x");
+  const auto a_y = node_a->get_column("y");
+  const auto b_x = node_b->get_column("x");
+  const auto c_y = node_c->get_column("y");
+
+  // Returns whether @param node is an input of the lowest JoinNode of the optimized LQP
+  const auto joined_first = [&](const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                                const std::shared_ptr<AbstractLQPNode>& node) {
+    // clang-format off
+    const auto lqp =
+    JoinNode::make(JoinMode::Inner, equals_(a_x, b_x),
+      JoinNode::make(JoinMode::Inner, equals_(a_y, c_y),
+        node_a,
+        node_c),
+      node_b);
+    // clang-format on
+
+    auto join_node = std::shared_ptr<AbstractLQPNode>{};
+    visit_lqp(Optimizer::create_default_optimizer(cost_estimator)->optimize(lqp), [&](const auto& visited_node) {
+      if (visited_node->type == LQPNodeType::Join) join_node = visited_node;
+      return LQPVisitation::VisitInputs;
+    });
+
+    auto found = false;
+    visit_lqp(join_node, [&](const auto& visited_node) {
+      found |= visited_node == node;
+      return LQPVisitation::VisitInputs;
+    });
+    return found;
+  };
+
+  EXPECT_TRUE(joined_first(std::make_shared<CostModelLogical>(), node_b));
+
+  auto coefficients = CostModelPhysicalCoefficients{};
+  coefficients.join_hash_build_row = 1.0f;
+  coefficients.join_hash_probe_row = 0.0f;
+  coefficients.join_hash_output_row = 0.0f;
+  coefficients.other_input_row = 0.0f;
+  coefficients.other_output_row = 0.0f;
+  EXPECT_TRUE(joined_first(std::make_shared<CostModelPhysical>(coefficients), node_c));
+}
+
 }  // namespace opossum
@@ -1,4 +1,5 @@
 #include <memory>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -6,12 +7,17 @@
 
 #include "operators/get_table.hpp"
 #include "operators/table_scan.hpp"
+#include "scheduler/admission_control.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/task_queue.hpp"
 #include "scheduler/topology.hpp"
+#include "scheduler/worker.hpp"
 #include "storage/storage_manager.hpp"
+#include "utils/cancellation_token.hpp"
+#include "utils/query_cancelled_exception.hpp"
 
 namespace opossum {
 
@@ -209,4 +215,176 @@ TEST_F(SchedulerTest, MultipleOperators) {
   EXPECT_TABLE_EQ_UNORDERED(ts->get_output(), expected_result);
 }
 
+TEST_F(SchedulerTest, TasksRunOnPreferredNode) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // Non-stealable tasks have to be executed by a worker of their preferred node, both when they are scheduled
+  // directly and when they become ready after their predecessor finished
+  std::vector<NodeID> executing_node_ids(4, INVALID_NODE_ID);
+  std::vector<NodeID> successor_node_ids(4, INVALID_NODE_ID);
+  for (auto node_id = NodeID{0}; node_id < 4; ++node_id) {
+    auto task = std::make_shared<JobTask>(
+        [&, node_id]() { executing_node_ids[node_id] = Worker::get_this_thread_worker()->queue()->node_id(); }, false);
+    auto successor = std::make_shared<JobTask>(
+        [&, node_id]() { successor_node_ids[node_id] = Worker::get_this_thread_worker()->queue()->node_id(); }, false);
+    task->set_as_predecessor_of(successor);
+
+    task->set_preferred_node_id(node_id);
+    successor->set_preferred_node_id(NodeID{3 - node_id});
+    EXPECT_EQ(task->preferred_node_id(), node_id);
+
+    successor->schedule();
+    task->schedule();
+  }
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  for (auto node_id = NodeID{0}; node_id < 4; ++node_id) {
+    EXPECT_EQ(executing_node_ids[node_id], node_id);
+    EXPECT_EQ(successor_node_ids[node_id], NodeID{3 - node_id});
+  }
+}
+
+TEST_F(SchedulerTest, TaskQueueSharesWorkersBetweenQueryPriorities) {
+  auto task_queue = TaskQueue{NodeID{0}};
+  for (auto query_priority : {QueryPriority::Low, QueryPriority::Normal, QueryPriority::High}) {
+    for (auto index = 0; index < 20; ++index) {
+      auto task = std::make_shared<JobTask>([]() {});
+      task->set_query_priority(query_priority);
+      task_queue.push(task, static_cast<uint32_t>(SchedulePriority::Default));
+    }
+  }
+
+  // Out of 13 pulls, 8 prefer High, 4 Normal, and 1 Low tasks
+  auto pull_counts = std::array<size_t, TaskQueue::NUM_QUERY_PRIORITIES>{};
+  for (auto index = 0; index < 13; ++index) {
+    ++pull_counts[static_cast<uint32_t>(task_queue.pull()->query_priority())];
+  }
+  EXPECT_EQ(pull_counts, (std::array<size_t, TaskQueue::NUM_QUERY_PRIORITIES>{8, 4, 1}));
+
+  // Without competition, the remaining class gets all pulls
+  for (auto index = 0; index < 47; ++index) task_queue.pull();
+  EXPECT_TRUE(task_queue.empty());
+}
+
+TEST_F(SchedulerTest, TaskQueueSharesWorkersBetweenQueriesOfAClass) {
+  auto task_queue = TaskQueue{NodeID{0}};
+
+  const auto make_task = [](const std::shared_ptr<CancellationToken>& cancellation_token) {
+    auto task = std::make_shared<JobTask>([]() {});
+    task->set_cancellation_token(cancellation_token);
+    return task;
+  };
+
+  // Find a second query that does not share the lane of the first one
+  const auto flooding_query = std::make_shared<CancellationToken>();
+  auto other_query = std::make_shared<CancellationToken>();
+  while (TaskQueue::query_lane(*make_task(other_query)) == TaskQueue::query_lane(*make_task(flooding_query))) {
+    other_query = std::make_shared<CancellationToken>();
+  }
+
+  for (auto index = 0; index < 20; ++index) {
+    task_queue.push(make_task(flooding_query), static_cast<uint32_t>(SchedulePriority::Default));
+  }
+  task_queue.push(make_task(other_query), static_cast<uint32_t>(SchedulePriority::Default));
+
+  // The task of the other query does not wait for the 20 tasks that were queued before it
+  const auto first_task = task_queue.pull();
+  const auto second_task = task_queue.pull();
+  EXPECT_NE(first_task->cancellation_token(), second_task->cancellation_token());
+}
+
+TEST_F(SchedulerTest, QueryPriorityIsInheritedBySubtasks) {
+  auto subtask_query_priority = QueryPriority::Normal;
+
+  auto task = std::make_shared<JobTask>([&]() {
+    EXPECT_EQ(AbstractTask::current_query_priority(), QueryPriority::Low);
+    auto subtask = std::make_shared<JobTask>([]() {});
+    subtask_query_priority = subtask->query_priority();
+  });
+  task->set_query_priority(QueryPriority::Low);
+  task->schedule();
+
+  EXPECT_EQ(subtask_query_priority, QueryPriority::Low);
+  EXPECT_EQ(AbstractTask::current_query_priority(), QueryPriority::Normal);
+}
+
+TEST_F(SchedulerTest, CancelledTasksAreNotExecuted) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+
+  std::atomic_uint executed_subtask_count{0};
+  auto task = std::make_shared<JobTask>([&]() {
+    // Subtasks inherit the token of the query. Those that were not started before the cancellation are skipped.
+    auto subtasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto index = 0; index < 10; ++index) {
+      subtasks.emplace_back(std::make_shared<JobTask>([&]() { ++executed_subtask_count; }));
+      EXPECT_EQ(subtasks.back()->cancellation_token(), cancellation_token);
+    }
+
+    cancellation_token->cancel();
+    CurrentScheduler::schedule_and_wait_for_tasks(subtasks);
+    ADD_FAILURE() << "Waiting for the tasks of a cancelled query must throw";
+  });
+  task->set_cancellation_token(cancellation_token);
+  task->schedule();
+
+  EXPECT_THROW(CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task}),
+               QueryCancelledException);
+  EXPECT_EQ(executed_subtask_count, 0u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, CancellationTokenTimeout) {
+  const auto parent_cancellation_token = std::make_shared<CancellationToken>();
+  const auto cancellation_token = std::make_shared<CancellationToken>(parent_cancellation_token);
+  EXPECT_FALSE(cancellation_token->is_cancelled());
+  EXPECT_NO_THROW(cancellation_token->check());
+
+  parent_cancellation_token->set_timeout(std::chrono::milliseconds{0});
+  std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  EXPECT_TRUE(cancellation_token->is_cancelled());
+  EXPECT_THROW(cancellation_token->check(), QueryCancelledException);
+
+  // Operators check the token of the current thread
+  const auto scoped_cancellation_token = ScopedCancellationToken{cancellation_token};
+  EXPECT_EQ(CancellationToken::current(), cancellation_token.get());
+  EXPECT_THROW(CancellationToken::check_current(), QueryCancelledException);
+}
+
+TEST_F(SchedulerTest, AdmissionControlCapsLowPriorityQueries) {
+  auto& admission_control = AdmissionControl::get();
+  admission_control.set_max_concurrent_low_priority_queries(1);
+
+  std::atomic_bool second_query_admitted{false};
+  auto second_query = std::thread{};
+  {
+    const auto admission = AdmissionControl::ScopedAdmission{QueryPriority::Low};
+
+    second_query = std::thread([&]() {
+      const auto second_admission = AdmissionControl::ScopedAdmission{QueryPriority::Low};
+      second_query_admitted = true;
+    });
+
+    while (admission_control.waiting_low_priority_query_count() == 0) std::this_thread::yield();
+    EXPECT_FALSE(second_query_admitted);
+    EXPECT_EQ(admission_control.running_low_priority_query_count(), 1u);
+
+    // Queries of other classes are not affected
+    { const auto high_admission = AdmissionControl::ScopedAdmission{QueryPriority::High}; }
+  }
+
+  // The second query is admitted once the first one finished
+  second_query.join();
+  EXPECT_TRUE(second_query_admitted);
+  EXPECT_EQ(admission_control.running_low_priority_query_count(), 0u);
+
+  admission_control.set_max_concurrent_low_priority_queries(
+      AdmissionControl::DEFAULT_MAX_CONCURRENT_LOW_PRIORITY_QUERIES);
+}
+
 }  // namespace opossum
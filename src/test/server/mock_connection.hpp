@@ -8,7 +8,7 @@ namespace opossum {
 class MockConnection {
  public:
   MOCK_METHOD0(receive_startup_packet_header, boost::future<uint32_t>());
-  MOCK_METHOD1(receive_startup_packet_body, boost::future<void>(uint32_t size));
+  MOCK_METHOD1(receive_startup_packet_body, boost::future<StartupParameters>(uint32_t size));
 
   MOCK_METHOD0(receive_packet_header, boost::future<RequestHeader>());
   MOCK_METHOD1(receive_simple_query_packet_body, boost::future<std::string>(uint32_t size));
@@ -58,6 +58,17 @@ TEST_F(PostgresWireHandlerTest, HandleStartupPackage) {
   ASSERT_EQ(result, 92ul);  // 100 - 2 * sizeof(uint32_t)
 }
 
+TEST_F(PostgresWireHandlerTest, HandleStartupPackageContent) {
+  const auto content = std::string{"user\0postgres\0query_priority\0low\0\0", 34};
+  _input_packet.data = ByteBuffer(content.begin(), content.end());
+  _input_packet.offset = _input_packet.data.cbegin();
+
+  const auto parameters = postgres_wire_handler.handle_startup_package_content(_input_packet);
+  ASSERT_EQ(parameters.size(), 2u);
+  EXPECT_EQ(parameters.at("user"), "postgres");
+  EXPECT_EQ(parameters.at("query_priority"), "low");
+}
+
 TEST_F(PostgresWireHandlerTest, WriteString) {
   std::string value("Response");
 
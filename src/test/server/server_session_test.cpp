@@ -46,7 +46,8 @@ class ServerSessionTest : public BaseTest {
   void _configure_startup() {
     ON_CALL(*_connection, receive_startup_packet_header())
         .WillByDefault(Return(ByMove(boost::make_ready_future(uint32_t(32)))));
-    ON_CALL(*_connection, receive_startup_packet_body(_)).WillByDefault(Return(ByMove(boost::make_ready_future())));
+    ON_CALL(*_connection, receive_startup_packet_body(_))
+        .WillByDefault(Return(ByMove(boost::make_ready_future(StartupParameters{}))));
   }
 
   void _configure_termination() {
@@ -130,7 +131,7 @@ TEST_F(ServerSessionTest, SessionHandlesConnectionErrorsDuringStartup) {
 
   auto exception = std::logic_error("Some connection problem");
   EXPECT_CALL(*_connection, receive_startup_packet_body(_))
-      .WillOnce(Return(ByMove(boost::make_exceptional_future<void>(boost::copy_exception(exception)))));
+      .WillOnce(Return(ByMove(boost::make_exceptional_future<StartupParameters>(boost::copy_exception(exception)))));
 
   EXPECT_NO_THROW(_session->start().wait());
 }
@@ -179,6 +180,63 @@ TEST_F(ServerSessionTest, SessionShutsDownOnErrorReceivingPacketHeader) {
   EXPECT_NO_THROW(_session->start().wait());
 }
 
+TEST_F(ServerSessionTest, SessionTasksUseQueryPriorityFromStartup) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, receive_startup_packet_body(_))
+      .WillOnce(Return(ByMove(boost::make_ready_future(StartupParameters{{"query_priority", "low"}}))));
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("SELECT * FROM foo;")))));
+
+  // The task creating the SQLPipeline (and thus the pipeline itself) belongs to the priority class of the session
+  auto exception = std::logic_error("Stop after creating the task");
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Invoke([&](std::shared_ptr<CreatePipelineTask> task) {
+        EXPECT_EQ(task->query_priority(), QueryPriority::Low);
+        return boost::make_exceptional_future<std::unique_ptr<CreatePipelineResult>>(boost::copy_exception(exception));
+      }));
+
+  EXPECT_CALL(*_connection, send_error(exception.what()));
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionCancelsItsTasksWhenItEnds) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, receive_startup_packet_body(_))
+      .WillOnce(Return(ByMove(boost::make_ready_future(StartupParameters{{"statement_timeout", "1000"}}))));
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("SELECT * FROM foo;")))));
+
+  auto cancellation_token = std::shared_ptr<CancellationToken>{};
+  auto exception = std::logic_error("Stop after creating the task");
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Invoke([&](std::shared_ptr<CreatePipelineTask> task) {
+        cancellation_token = task->cancellation_token();
+        return boost::make_exceptional_future<std::unique_ptr<CreatePipelineResult>>(boost::copy_exception(exception));
+      }));
+
+  EXPECT_CALL(*_connection, send_error(exception.what()));
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+
+  ASSERT_TRUE(cancellation_token);
+  EXPECT_TRUE(cancellation_token->is_cancelled());
+}
+
 TEST_F(ServerSessionTest, SessionRecoversFromErrorsDuringCommandProcessing) {
   InSequence s;
 
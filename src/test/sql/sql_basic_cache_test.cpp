@@ -302,4 +302,28 @@ TYPED_TEST(CacheTest, ResizeShrink) {
   ASSERT_EQ(cache.get(3), 6);
 }
 
+TYPED_TEST(CacheTest, Remove) {
+  TypeParam cache(3);
+
+  cache.set(1, 2);
+  cache.set(2, 4);
+  cache.set(3, 6);
+
+  cache.remove(1);
+  cache.remove(4);  // Not cached, no-op.
+
+  ASSERT_EQ(2u, cache.size());
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_EQ(cache.get(2), 4);
+  ASSERT_EQ(cache.get(3), 6);
+
+  // The freed slot is reused without evicting another entry
+  cache.set(4, 8);
+
+  ASSERT_EQ(3u, cache.size());
+  ASSERT_TRUE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+  ASSERT_EQ(cache.get(4), 8);
+}
+
 }  // namespace opossum
@@ -18,6 +18,9 @@
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "storage/storage_manager.hpp"
+#include "utils/cancellation_token.hpp"
+#include "utils/memory_limit_exceeded_exception.hpp"
+#include "utils/query_cancelled_exception.hpp"
 
 namespace {
 // This function is a slightly hacky way to check whether an LQP was optimized. This relies on JoinDetectionRule and
@@ -415,6 +418,67 @@ TEST_F(SQLPipelineStatementTest, GetTasksNotValidated) {
   EXPECT_FALSE(_contains_validate(tasks));
 }
 
+TEST_F(SQLPipelineStatementTest, GetTasksWithQueryPriority) {
+  auto sql_pipeline =
+      SQLPipelineBuilder{_select_query_a}.with_query_priority(QueryPriority::High).create_pipeline_statement();
+
+  for (const auto& task : sql_pipeline.get_tasks()) {
+    EXPECT_EQ(task->query_priority(), QueryPriority::High);
+  }
+  EXPECT_TABLE_EQ_UNORDERED(sql_pipeline.get_result_table(), _table_a);
+}
+
+TEST_F(SQLPipelineStatementTest, GetResultTableWithMemoryLimit) {
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline_statement();
+  sql_pipeline.get_result_table();
+  EXPECT_GT(sql_pipeline.metrics()->peak_allocated_bytes, 0u);
+
+  // The operators allocate more than a single byte, so the statement is aborted
+  auto limited_sql_pipeline = SQLPipelineBuilder{_join_query}.with_memory_limit(1).create_pipeline_statement();
+  EXPECT_THROW(limited_sql_pipeline.get_result_table(), MemoryLimitExceededException);
+  EXPECT_TRUE(limited_sql_pipeline.cancellation_token()->is_cancelled());
+  EXPECT_EQ(limited_sql_pipeline.transaction_context()->phase(), TransactionPhase::RolledBack);
+}
+
+TEST_F(SQLPipelineStatementTest, GetResultTableWithMemoryLimitAndScheduler) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // The limit is exceeded on a Worker. Only the statement is aborted, the Workers keep running.
+  auto limited_sql_pipeline = SQLPipelineBuilder{_join_query}.with_memory_limit(1).create_pipeline_statement();
+  EXPECT_THROW(limited_sql_pipeline.get_result_table(), MemoryLimitExceededException);
+  EXPECT_EQ(limited_sql_pipeline.transaction_context()->phase(), TransactionPhase::RolledBack);
+
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline_statement();
+  EXPECT_TABLE_EQ_UNORDERED(sql_pipeline.get_result_table(), _join_result);
+}
+
+TEST_F(SQLPipelineStatementTest, GetResultTableOfCancelledStatement) {
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  auto sql_pipeline =
+      SQLPipelineBuilder{_join_query}.with_cancellation_token(cancellation_token).create_pipeline_statement();
+  EXPECT_EQ(sql_pipeline.get_tasks().front()->cancellation_token(), sql_pipeline.cancellation_token());
+
+  cancellation_token->cancel();
+  EXPECT_TRUE(sql_pipeline.cancellation_token()->is_cancelled());
+  EXPECT_THROW(sql_pipeline.get_result_table(), QueryCancelledException);
+
+  // The auto-committed transaction of the statement is rolled back
+  EXPECT_EQ(sql_pipeline.transaction_context()->phase(), TransactionPhase::RolledBack);
+}
+
+TEST_F(SQLPipelineStatementTest, GetResultTableWithStatementTimeout) {
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}
+                          .with_statement_timeout(std::chrono::milliseconds{0})
+                          .create_pipeline_statement();
+  EXPECT_THROW(sql_pipeline.get_result_table(), QueryCancelledException);
+
+  auto unlimited_sql_pipeline = SQLPipelineBuilder{_join_query}
+                                    .with_statement_timeout(std::chrono::hours{1})
+                                    .create_pipeline_statement();
+  EXPECT_NO_THROW(unlimited_sql_pipeline.get_result_table());
+}
+
 TEST_F(SQLPipelineStatementTest, GetResultTable) {
   auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline_statement();
   const auto& table = sql_pipeline.get_result_table();
@@ -1,6 +1,8 @@
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 
@@ -154,4 +156,64 @@ TEST_F(SQLQueryPlanCacheTest, AutomaticQueryOperatorCacheLRUK2) {
   EXPECT_EQ(5u, _query_plan_cache_hits);
 }
 
+TEST_F(SQLQueryPlanCacheTest, Statistics) {
+  auto cache = SQLQueryCache<int, int>{2};
+  cache.replace_cache_impl<LRUCache<int, int>>(2);
+
+  EXPECT_FALSE(cache.try_get(1));  // Miss.
+  cache.set(1, 10);
+  cache.set(2, 20);
+  EXPECT_EQ(cache.try_get(1), 10);  // Hit.
+  cache.set(3, 30);                 // Evict 2.
+  cache.set(3, 31);                 // Refresh, no eviction.
+  EXPECT_FALSE(cache.try_get(2));   // Miss.
+
+  const auto statistics = cache.statistics();
+  EXPECT_EQ(statistics.hits, 1u);
+  EXPECT_EQ(statistics.misses, 2u);
+  EXPECT_EQ(statistics.evictions, 1u);
+
+  cache.reset_statistics();
+  EXPECT_EQ(cache.statistics().hits, 0u);
+}
+
+TEST_F(SQLQueryPlanCacheTest, Sharding) {
+  // Small caches have a single shard, so that they behave like the underlying cache
+  EXPECT_EQ(SQLQueryCache<int>{2}.shard_count(), 1u);
+  EXPECT_EQ(SQLQueryCache<int>{MinCacheShardCapacity * 4}.shard_count(), 4u);
+  EXPECT_EQ(SQLQueryCache<int>{DefaultCacheCapacity * 1024}.shard_count(), MaxCacheShardCount);
+
+  auto cache = SQLQueryCache<int, int>{MinCacheShardCapacity * 4};
+  cache.replace_cache_impl<LRUCache<int, int>>(MinCacheShardCapacity * 4);
+  EXPECT_EQ(cache.capacity(), MinCacheShardCapacity * 4);
+
+  // Concurrent accesses from several threads
+  const auto thread_count = 8;
+  const auto keys_per_thread = 1000;
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto key = thread_id * keys_per_thread; key < (thread_id + 1) * keys_per_thread; ++key) {
+        cache.set(key, key);
+        const auto value = cache.try_get(key);
+        if (value) EXPECT_EQ(*value, key);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // No shard exceeds its capacity
+  EXPECT_LE(cache.size(), cache.capacity());
+  const auto statistics = cache.statistics();
+  EXPECT_EQ(statistics.hits + statistics.misses, static_cast<size_t>(thread_count * keys_per_thread));
+  EXPECT_EQ(statistics.evictions, thread_count * keys_per_thread - cache.size());
+
+  // Resizing to a capacity that needs fewer shards re-creates the shards
+  cache.resize(2);
+  EXPECT_EQ(cache.shard_count(), 1u);
+  EXPECT_EQ(cache.size(), 0u);
+}
+
 }  // namespace opossum
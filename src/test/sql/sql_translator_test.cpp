@@ -647,6 +647,19 @@ TEST_F(SQLTranslatorTest, InArray) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(SQLTranslatorTest, InColumnValueList) {
+  // Scanned by the TableScan directly, no Projection needed
+  const auto actual_lqp = compile_query("SELECT * FROM int_float WHERE a IN (1, 2)");
+
+  // clang-format off
+  const auto expected_lqp =
+  PredicateNode::make(in_(int_float_a, list_(1, 2)),
+    stored_table_node_int_float);
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
 TEST_F(SQLTranslatorTest, InSelect) {
   const auto actual_lqp = compile_query("SELECT * FROM int_float WHERE a + 7 IN (SELECT * FROM int_float2)");
 
@@ -1297,6 +1310,19 @@ TEST_F(SQLTranslatorTest, UpdateConditional) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(SQLTranslatorTest, UpdateCast) {
+  const auto actual_lqp = compile_query("UPDATE int_float SET a = b, b = 3 WHERE a > 1;");
+
+  // clang-format off
+  const auto expected_lqp =
+  UpdateNode::make("int_float", expression_vector(cast_(int_float_b, DataType::Int), cast_(3, DataType::Float)),
+    PredicateNode::make(greater_than_(int_float_a, 1),
+      stored_table_node_int_float));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
 TEST_F(SQLTranslatorTest, CreateView) {
   const auto query = "CREATE VIEW my_first_view AS SELECT a, b, a + b, a*b AS t FROM int_float WHERE a = 'b';";
   const auto result_node = compile_query(query);
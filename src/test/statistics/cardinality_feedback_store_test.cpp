@@ -0,0 +1,200 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "sql/sql_query_cache.hpp"
+#include "sql/sql_query_plan.hpp"
+#include "statistics/cardinality_feedback_store.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CardinalityFeedbackStoreTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("src/test/tables/int_float.tbl", 2));
+    StorageManager::get().add_table("table_b", load_table("src/test/tables/int_float2.tbl", 2));
+
+    stored_table_node_a = StoredTableNode::make("table_a");
+    stored_table_node_b = StoredTableNode::make("table_b");
+    a_a = stored_table_node_a->get_column("a");
+    a_b = stored_table_node_a->get_column("b");
+    b_a = stored_table_node_b->get_column("a");
+  }
+
+  std::shared_ptr<StoredTableNode> stored_table_node_a, stored_table_node_b;
+  LQPColumnReference a_a, a_b, b_a;
+};
+
+TEST_F(CardinalityFeedbackStoreTest, SubplanKeyNormalization) {
+  const auto predicate_node_a = PredicateNode::make(greater_than_(a_a, 5), stored_table_node_a);
+  const auto predicate_node_b = PredicateNode::make(less_than_(a_b, 100), predicate_node_a);
+  const auto predicate_node_c = PredicateNode::make(less_than_(a_b, 100), stored_table_node_a);
+  const auto predicate_node_d = PredicateNode::make(greater_than_(a_a, 5), predicate_node_c);
+
+  const auto key = [](const auto& node) {
+    return CardinalityFeedbackStore::subplan_key(*node, node->left_input(), node->right_input());
+  };
+
+  // The order of adjacent predicates does not matter
+  EXPECT_EQ(key(predicate_node_b), key(predicate_node_d));
+  EXPECT_NE(key(predicate_node_a), key(predicate_node_c));
+  EXPECT_NE(key(predicate_node_a), key(predicate_node_d));
+
+  // Nor does the order of the inputs of inner joins or the presence of projections
+  const auto join_node_a = JoinNode::make(JoinMode::Inner, equals_(a_a, b_a), stored_table_node_a, stored_table_node_b);
+  const auto join_node_b = JoinNode::make(JoinMode::Inner, equals_(a_a, b_a), stored_table_node_b,
+                                          ProjectionNode::make(expression_vector(a_a), stored_table_node_a));
+  EXPECT_EQ(key(join_node_a), key(join_node_b));
+
+  const auto left_join_node_a = JoinNode::make(JoinMode::Left, equals_(a_a, b_a), stored_table_node_a,
+                                               stored_table_node_b);
+  const auto left_join_node_b = JoinNode::make(JoinMode::Left, equals_(a_a, b_a), stored_table_node_b,
+                                               stored_table_node_a);
+  EXPECT_NE(key(left_join_node_a), key(left_join_node_b));
+
+  // Hypothetical inputs are used instead of the actual ones
+  EXPECT_EQ(CardinalityFeedbackStore::subplan_key(*predicate_node_b, stored_table_node_a, nullptr),
+            key(predicate_node_c));
+}
+
+TEST_F(CardinalityFeedbackStoreTest, SubplanKeyCache) {
+  const auto predicate_node = PredicateNode::make(greater_than_(a_a, 5), stored_table_node_a);
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(a_a, b_a), predicate_node, stored_table_node_b);
+
+  const auto key = [](const auto& node, const std::shared_ptr<AbstractLQPNode>& left_input) {
+    return CardinalityFeedbackStore::subplan_key(*node, left_input, node->right_input());
+  };
+
+  const auto uncached_join_key = key(join_node, predicate_node);
+  const auto uncached_predicate_key = key(predicate_node, stored_table_node_a);
+  const auto hypothetical_predicate_key = key(predicate_node, stored_table_node_b);
+
+  // Cached keys equal the uncached ones, keys for hypothetical inputs are not taken from the cache
+  const auto subplan_key_cache_scope = CardinalityFeedbackStore::ScopedSubplanKeyCache{};
+  EXPECT_EQ(key(join_node, predicate_node), uncached_join_key);
+  EXPECT_EQ(key(predicate_node, stored_table_node_a), uncached_predicate_key);
+  EXPECT_EQ(key(predicate_node, stored_table_node_b), hypothetical_predicate_key);
+  EXPECT_NE(hypothetical_predicate_key, uncached_predicate_key);
+}
+
+TEST_F(CardinalityFeedbackStoreTest, RecordAndAdjust) {
+  const auto predicate_node = PredicateNode::make(greater_than_(a_a, 5), stored_table_node_a);
+  const auto estimated_row_count = predicate_node->get_statistics()->row_count();
+
+  const auto key = CardinalityFeedbackStore::subplan_key(*predicate_node, stored_table_node_a, nullptr);
+  CardinalityFeedbackStore::get().record(key, estimated_row_count, 42.0f);
+  CardinalityFeedbackStore::get().record(key, estimated_row_count, 2.0f);
+
+  const auto entry = CardinalityFeedbackStore::get().find(key);
+  ASSERT_TRUE(entry);
+  EXPECT_FLOAT_EQ(entry->estimated_row_count, estimated_row_count);
+  EXPECT_FLOAT_EQ(entry->actual_row_count, 2.0f);
+  EXPECT_EQ(entry->execution_count, 2u);
+
+  EXPECT_FLOAT_EQ(predicate_node->get_statistics()->row_count(), 2.0f);
+
+  // Other subplans are not affected
+  const auto other_predicate_node = PredicateNode::make(greater_than_(a_a, 6), stored_table_node_a);
+  EXPECT_FLOAT_EQ(other_predicate_node->get_statistics()->row_count(),
+                  other_predicate_node->derive_statistics_from(stored_table_node_a)->row_count());
+
+  CardinalityFeedbackStore::reset();
+  EXPECT_EQ(CardinalityFeedbackStore::get().size(), 0u);
+  EXPECT_FLOAT_EQ(predicate_node->get_statistics()->row_count(), estimated_row_count);
+}
+
+TEST_F(CardinalityFeedbackStoreTest, RecordExecutedPipeline) {
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 200"}.disable_mvcc().create_pipeline();
+  const auto result_table = sql_pipeline.get_result_table();
+  ASSERT_EQ(result_table->row_count(), 2u);
+
+  EXPECT_GT(CardinalityFeedbackStore::get().size(), 0u);
+
+  const auto predicate_node = PredicateNode::make(greater_than_(a_a, 200), stored_table_node_a);
+  EXPECT_FLOAT_EQ(predicate_node->get_statistics()->row_count(), 2.0f);
+}
+
+TEST_F(CardinalityFeedbackStoreTest, DoNotRecordOperatorsWithRowBudget) {
+  // The TableScan stops after the first match, so its output row count is not the cardinality of the predicate
+  auto sql_pipeline =
+      SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 200 LIMIT 1"}.disable_mvcc().create_pipeline();
+  const auto result_table = sql_pipeline.get_result_table();
+  ASSERT_EQ(result_table->row_count(), 1u);
+
+  const auto predicate_node = PredicateNode::make(greater_than_(a_a, 200), stored_table_node_a);
+  EXPECT_FALSE(CardinalityFeedbackStore::get().find(
+      CardinalityFeedbackStore::subplan_key(*predicate_node, stored_table_node_a, nullptr)));
+}
+
+TEST_F(CardinalityFeedbackStoreTest, EvictLeastRecentlyUsedEntries) {
+  auto& store = CardinalityFeedbackStore::get();
+  const auto key = [](const size_t index) { return std::to_string(index); };
+
+  for (auto index = size_t{0}; index < CardinalityFeedbackStore::MAX_ENTRY_COUNT; ++index) {
+    store.record(key(index), 1.0f, 2.0f);
+  }
+  EXPECT_EQ(store.size(), CardinalityFeedbackStore::MAX_ENTRY_COUNT);
+
+  // Looking up the oldest entry protects it from the eviction
+  EXPECT_TRUE(store.find(key(0)));
+
+  // A full store still records new subplans and evicts the least recently used entries for them
+  store.record("new", 1.0f, 2.0f);
+  EXPECT_EQ(store.size(),
+            CardinalityFeedbackStore::MAX_ENTRY_COUNT - CardinalityFeedbackStore::EVICTION_BATCH_SIZE + 1);
+  EXPECT_TRUE(store.find("new"));
+  EXPECT_TRUE(store.find(key(0)));
+  EXPECT_FALSE(store.find(key(1)));
+  EXPECT_FALSE(store.find(key(CardinalityFeedbackStore::EVICTION_BATCH_SIZE)));
+  EXPECT_TRUE(store.find(key(CardinalityFeedbackStore::EVICTION_BATCH_SIZE + 1)));
+}
+
+TEST_F(CardinalityFeedbackStoreTest, EvictMisestimatedPlansFromCache) {
+  // Assuming a uniform distribution between the minimum and the maximum, almost all rows are estimated to qualify
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int);
+  const auto skewed_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (auto value = 0; value < 99; ++value) {
+    skewed_table->append({value});
+  }
+  skewed_table->append({10'000});
+  StorageManager::get().add_table("skewed_table", skewed_table);
+
+  auto& cache = SQLQueryCache<SQLQueryPlan>::get();
+  cache.clear();
+
+  const auto query = std::string{"SELECT * FROM skewed_table WHERE a > 100"};
+  const auto execute = [&]() {
+    auto sql_pipeline = SQLPipelineBuilder{query}.disable_mvcc().create_pipeline_statement();
+    EXPECT_EQ(sql_pipeline.get_result_table()->row_count(), 1u);
+    return sql_pipeline.metrics()->query_plan_cache_hit;
+  };
+
+  // The plan of the first execution is based on the misestimation and therefore not kept
+  EXPECT_FALSE(execute());
+  EXPECT_FALSE(cache.has(query));
+
+  // The second execution is optimized with the recorded cardinality. As it matches, the plan is cached and reused.
+  EXPECT_FALSE(execute());
+  EXPECT_TRUE(cache.has(query));
+  EXPECT_TRUE(execute());
+  EXPECT_TRUE(cache.has(query));
+
+  cache.clear();
+}
+
+}  // namespace opossum
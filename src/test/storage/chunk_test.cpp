@@ -8,7 +8,9 @@
 #include "storage/chunk.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -204,4 +206,25 @@ TEST_F(StorageChunkTest, RemoveIndex) {
             indices_for_segment_0.cend());
 }
 
+TEST_F(StorageChunkTest, HomeNodeId) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 2);
+  table->append({1});
+  table->append({2});
+  table->append({3});
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->home_node_id(), INVALID_NODE_ID);
+
+  table->get_chunk(ChunkID{0})->set_home_node_id(NodeID{1});
+  table->get_chunk(ChunkID{1})->set_home_node_id(NodeID{2});
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->home_node_id(), NodeID{1});
+
+  // Reference chunks are located on the node of the chunk their first non-null row points to
+  auto pos_list = std::make_shared<PosList>(PosList{NULL_ROW_ID, RowID{ChunkID{1}, 0}, RowID{ChunkID{0}, 0}});
+  auto reference_segment = std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list);
+  auto reference_chunk = std::make_shared<Chunk>(Segments({reference_segment}));
+  EXPECT_EQ(reference_chunk->home_node_id(), NodeID{2});
+
+  reference_chunk->set_home_node_id(NodeID{3});
+  EXPECT_EQ(reference_chunk->home_node_id(), NodeID{3});
+}
+
 }  // namespace opossum
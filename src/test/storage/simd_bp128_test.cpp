@@ -2,8 +2,11 @@
 #include <boost/hana/map.hpp>
 #include <boost/hana/pair.hpp>
 
+#include <algorithm>
+#include <array>
 #include <bitset>
 #include <iostream>
+#include <limits>
 #include <memory>
 
 #include "base_test.hpp"
@@ -11,6 +14,7 @@
 
 #include "storage/vector_compression/simd_bp128/simd_bp128_compressor.hpp"
 #include "storage/vector_compression/simd_bp128/simd_bp128_decompressor.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
 #include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 
@@ -103,4 +107,28 @@ TEST_P(SimdBp128Test, DecodeSequenceUsingDecoder) {
   }
 }
 
+TEST_P(SimdBp128Test, MatchBlocksWithoutUnpacking) {
+  const auto sequence = generate_sequence(4'200);
+  const auto encoded_sequence_base = encode(sequence);
+  const auto& data = static_cast<const SimdBp128Vector&>(*encoded_sequence_base).data();
+
+  // All values of the sequence have the highest bit set, so the first block has the full bit size
+  const auto bit_size = GetParam();
+  const auto min = uint64_t{1} << (bit_size - 1u);
+  const auto max = (uint64_t{1} << bit_size) - 1u;
+
+  // Matches the upper half of the values. With 32 bits, the largest value is excluded, as the upper bound is exclusive.
+  const auto lower = static_cast<uint32_t>(min + (max - min) / 2u);
+  const auto upper = static_cast<uint32_t>(std::min(max + 1u, uint64_t{std::numeric_limits<uint32_t>::max()}));
+
+  // The first block follows the meta info of the first meta block
+  auto matches = std::array<uint64_t, 2>{};
+  SimdBp128Packing::match_block(data.data() + 1u, bit_size, lower, upper, matches.data());
+
+  for (auto index = 0u; index < SimdBp128Packing::block_size; ++index) {
+    const auto is_match = ((matches[index / 64u] >> (index % 64u)) & 1u) != 0u;
+    EXPECT_EQ(is_match, sequence[index] >= lower && sequence[index] < upper) << "at index " << index;
+  }
+}
+
 }  // namespace opossum
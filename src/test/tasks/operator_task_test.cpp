@@ -8,6 +8,7 @@
 #include "operators/abstract_join_operator.hpp"
 #include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/operator_pipeline.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/union_positions.hpp"
 #include "scheduler/operator_task.hpp"
@@ -120,4 +121,52 @@ TEST_F(OperatorTaskTest, MakeDiamondShape) {
   EXPECT_EQ(scan_b->get_output(), nullptr);
   EXPECT_EQ(scan_c->get_output(), nullptr);
 }
+
+TEST_F(OperatorTaskTest, PipelinedTasksFromOperatorTest) {
+  auto gt = std::make_shared<GetTable>("table_a");
+  auto scan_a =
+      std::make_shared<TableScan>(gt, OperatorScanPredicate{ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234});
+  auto scan_b =
+      std::make_shared<TableScan>(scan_a, OperatorScanPredicate{ColumnID{1}, PredicateCondition::LessThan, 458.0f});
+
+  auto tasks = OperatorTask::make_tasks_from_operator(scan_b, CleanupTemporaries::Yes, UsePipelining::Yes);
+
+  // Both scans are executed by one task
+  ASSERT_EQ(tasks.size(), 2u);
+  EXPECT_EQ(tasks[0]->get_operator(), gt);
+  EXPECT_EQ(tasks[0]->get_pipeline(), nullptr);
+  EXPECT_EQ(tasks[1]->get_operator(), scan_b);
+  ASSERT_NE(tasks[1]->get_pipeline(), nullptr);
+  EXPECT_EQ(tasks[1]->get_pipeline()->operators(), (std::vector<std::shared_ptr<AbstractOperator>>{scan_a, scan_b}));
+
+  for (auto& task : tasks) {
+    task->schedule();
+    // We don't have to wait here, because we are running the task tests without a scheduler
+  }
+
+  auto expected_result = std::make_shared<Table>(_test_table_a->column_definitions(), TableType::Data);
+  expected_result->append({1234, 457.7f});
+  EXPECT_TABLE_EQ_UNORDERED(expected_result, tasks.back()->get_operator()->get_output());
+
+  EXPECT_EQ(gt->get_output(), nullptr);
+  EXPECT_EQ(scan_a->get_output(), nullptr);
+}
+
+TEST_F(OperatorTaskTest, PipelinesEndAtOperatorsWithMultipleConsumers) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto scan_a = std::make_shared<TableScan>(
+      gt_a, OperatorScanPredicate{ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234});
+  auto scan_b =
+      std::make_shared<TableScan>(scan_a, OperatorScanPredicate{ColumnID{1}, PredicateCondition::LessThan, 1000});
+  auto scan_c =
+      std::make_shared<TableScan>(scan_a, OperatorScanPredicate{ColumnID{1}, PredicateCondition::GreaterThan, 2000});
+  auto union_positions = std::make_shared<UnionPositions>(scan_b, scan_c);
+
+  auto tasks = OperatorTask::make_tasks_from_operator(union_positions, CleanupTemporaries::Yes, UsePipelining::Yes);
+
+  ASSERT_EQ(tasks.size(), 5u);
+  for (const auto& task : tasks) {
+    EXPECT_EQ(task->get_pipeline(), nullptr);
+  }
+}
 }  // namespace opossum
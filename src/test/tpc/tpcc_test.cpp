@@ -0,0 +1,125 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "type_cast.hpp"
+
+#include "tpcc/constants.hpp"
+#include "tpcc/tpcc_driver.hpp"
+#include "tpcc/tpcc_table_generator.hpp"
+#include "tpcc/tpcc_transactions.hpp"
+
+namespace opossum {
+
+class TPCCTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto tables = TpccTableGenerator{10'000, 1}.generate_all_tables();
+    for (const auto& [table_name, table] : tables) {
+      StorageManager::get().add_table(table_name, table);
+    }
+  }
+
+  // Executes a single-value query in its own transaction
+  template <typename T>
+  T query_value(const std::string& sql) {
+    auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto table = sql_pipeline.get_result_table();
+    EXPECT_EQ(table->row_count(), 1u);
+    return type_cast<T>(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})->operator[](0));
+  }
+
+  TpccRandomGenerator random_generator;
+};
+
+TEST_F(TPCCTest, NewOrder) {
+  auto new_order = TpccNewOrder{random_generator, 1, 0};
+  new_order.d_id = 3;
+  new_order.order_lines.resize(5);
+  for (auto ol_number = size_t{0}; ol_number < new_order.order_lines.size(); ++ol_number) {
+    new_order.order_lines[ol_number].ol_i_id = static_cast<int32_t>(42 + ol_number);
+  }
+
+  const auto district_predicate = std::string{" FROM DISTRICT WHERE D_W_ID = 0 AND D_ID = 3"};
+  EXPECT_EQ(query_value<int32_t>("SELECT D_NEXT_O_ID" + district_predicate), NUM_ORDERS);
+
+  EXPECT_EQ(new_order.execute(), TpccTransactionResult::Committed);
+
+  EXPECT_EQ(query_value<int32_t>("SELECT D_NEXT_O_ID" + district_predicate), NUM_ORDERS + 1);
+  EXPECT_EQ(query_value<int64_t>("SELECT COUNT(*) FROM \"ORDER\" WHERE O_W_ID = 0 AND O_D_ID = 3 AND O_ID = " +
+                                 std::to_string(NUM_ORDERS)),
+            1);
+  EXPECT_EQ(query_value<int64_t>("SELECT COUNT(*) FROM ORDER_LINE WHERE OL_W_ID = 0 AND OL_D_ID = 3 AND OL_O_ID = " +
+                                 std::to_string(NUM_ORDERS)),
+            5);
+  EXPECT_EQ(query_value<int64_t>("SELECT COUNT(*) FROM NEW_ORDER WHERE NO_W_ID = 0 AND NO_D_ID = 3"),
+            NUM_NEW_ORDERS + 1);
+}
+
+TEST_F(TPCCTest, NewOrderRollback) {
+  auto new_order = TpccNewOrder{random_generator, 1, 0};
+  new_order.d_id = 3;
+  new_order.order_lines.back().ol_i_id = NUM_ITEMS;
+
+  EXPECT_EQ(new_order.execute(), TpccTransactionResult::RolledBack);
+
+  EXPECT_EQ(query_value<int32_t>("SELECT D_NEXT_O_ID FROM DISTRICT WHERE D_W_ID = 0 AND D_ID = 3"), NUM_ORDERS);
+  EXPECT_EQ(query_value<int64_t>("SELECT COUNT(*) FROM NEW_ORDER WHERE NO_W_ID = 0 AND NO_D_ID = 3"), NUM_NEW_ORDERS);
+}
+
+TEST_F(TPCCTest, Payment) {
+  const auto w_ytd = query_value<float>("SELECT W_YTD FROM WAREHOUSE WHERE W_ID = 0");
+
+  auto payment = TpccPayment{random_generator, 1, 0};
+  payment.h_amount = 100.0f;
+
+  EXPECT_EQ(payment.execute(), TpccTransactionResult::Committed);
+
+  EXPECT_FLOAT_EQ(query_value<float>("SELECT W_YTD FROM WAREHOUSE WHERE W_ID = 0"), w_ytd + 100.0f);
+  EXPECT_EQ(query_value<int64_t>("SELECT COUNT(*) FROM HISTORY"),
+            NUM_DISTRICTS_PER_WAREHOUSE * NUM_CUSTOMERS_PER_DISTRICT * NUM_HISTORY_ENTRIES + 1);
+}
+
+TEST_F(TPCCTest, OrderStatusAndStockLevel) {
+  auto order_status = TpccOrderStatus{random_generator, 1, 0};
+  EXPECT_EQ(order_status.execute(), TpccTransactionResult::Committed);
+
+  auto stock_level = TpccStockLevel{random_generator, 1, 0};
+  EXPECT_EQ(stock_level.execute(), TpccTransactionResult::Committed);
+  EXPECT_GE(stock_level.low_stock_count, 0);
+}
+
+TEST_F(TPCCTest, Delivery) {
+  auto delivery = TpccDelivery{random_generator, 1, 0};
+  EXPECT_EQ(delivery.execute(), TpccTransactionResult::Committed);
+
+  // The oldest undelivered order of each district was delivered
+  EXPECT_EQ(query_value<int64_t>("SELECT COUNT(*) FROM NEW_ORDER"),
+            NUM_DISTRICTS_PER_WAREHOUSE * (NUM_NEW_ORDERS - 1));
+  EXPECT_EQ(query_value<int64_t>("SELECT COUNT(*) FROM \"ORDER\" WHERE O_CARRIER_ID = " +
+                                 std::to_string(delivery.o_carrier_id) + " AND O_ID = " +
+                                 std::to_string(NUM_ORDERS - NUM_NEW_ORDERS)),
+            NUM_DISTRICTS_PER_WAREHOUSE);
+}
+
+TEST_F(TPCCTest, Driver) {
+  auto driver = TpccDriver{1, 2};
+  driver.run(std::chrono::seconds{60}, 20);
+
+  auto transaction_count = size_t{0};
+  for (const auto& [type, statistics] : driver.statistics()) {
+    transaction_count += statistics.committed + statistics.rolled_back + statistics.aborted;
+    EXPECT_EQ(statistics.latencies.size(), statistics.committed + statistics.rolled_back + statistics.aborted);
+  }
+  EXPECT_EQ(transaction_count, 20u);
+
+  const auto report = driver.report();
+  EXPECT_EQ(report["terminals"], 2);
+  EXPECT_TRUE(report.count("tpmC"));
+}
+
+}  // namespace opossum
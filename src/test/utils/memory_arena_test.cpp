@@ -0,0 +1,109 @@
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/abstract_read_only_operator.hpp"
+#include "scheduler/job_task.hpp"
+#include "types.hpp"
+#include "utils/memory_arena.hpp"
+#include "utils/memory_tracker.hpp"
+
+namespace opossum {
+
+class MemoryArenaTest : public BaseTest {};
+
+// Remembers the arena that it is executed with
+class MemoryArenaRecordingOperator : public AbstractReadOnlyOperator {
+ public:
+  MemoryArenaRecordingOperator() : AbstractReadOnlyOperator(OperatorType::Mock) {}
+
+  const std::string name() const override { return "MemoryArenaRecordingOperator"; }
+
+  std::weak_ptr<MemoryArena> memory_arena;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override {
+    memory_arena = MemoryArena::current()->shared_from_this();
+    return nullptr;
+  }
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override {
+    return std::make_shared<MemoryArenaRecordingOperator>();
+  }
+
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override {}
+};
+
+TEST_F(MemoryArenaTest, TransientResourceOfScope) {
+  EXPECT_EQ(MemoryArena::current(), nullptr);
+  EXPECT_EQ(MemoryArena::transient_resource(), boost::container::pmr::get_default_resource());
+
+  const auto memory_arena = std::make_shared<MemoryArena>();
+  {
+    const auto scoped_memory_arena = ScopedMemoryArena{memory_arena};
+    EXPECT_EQ(MemoryArena::current(), memory_arena.get());
+    EXPECT_EQ(MemoryArena::transient_resource(), memory_arena.get());
+
+    // Scopes can be nested, e.g., when a Task is executed inline by another one
+    {
+      const auto scoped_no_memory_arena = ScopedMemoryArena{nullptr};
+      EXPECT_EQ(MemoryArena::transient_resource(), boost::container::pmr::get_default_resource());
+    }
+    EXPECT_EQ(MemoryArena::current(), memory_arena.get());
+  }
+
+  EXPECT_EQ(MemoryArena::current(), nullptr);
+}
+
+TEST_F(MemoryArenaTest, ReleasesMemoryWithArena) {
+  const auto memory_tracker = MemoryTracker::create();
+  const auto scoped_memory_tracker = ScopedMemoryTracker{memory_tracker};
+
+  auto memory_arena = std::make_shared<MemoryArena>();
+  {
+    auto values = pmr_vector<int32_t>(1'000, PolymorphicAllocator<int32_t>{memory_arena.get()});
+    values.resize(10'000);
+    EXPECT_GE(memory_tracker->current_bytes(), 10'000 * sizeof(int32_t));
+  }
+
+  // Deallocations are no-ops, the memory is released once the arena is destroyed
+  EXPECT_GE(memory_tracker->current_bytes(), 10'000 * sizeof(int32_t));
+  memory_arena.reset();
+  EXPECT_EQ(memory_tracker->current_bytes(), 0u);
+}
+
+TEST_F(MemoryArenaTest, InheritedByTasks) {
+  const auto memory_arena = std::make_shared<MemoryArena>();
+  const auto scoped_memory_arena = ScopedMemoryArena{memory_arena};
+
+  auto task_memory_arena = static_cast<MemoryArena*>(nullptr);
+  const auto task = std::make_shared<JobTask>([&]() { task_memory_arena = MemoryArena::current(); });
+  EXPECT_EQ(task->memory_arena(), memory_arena);
+
+  task->schedule();
+  task->join();
+  EXPECT_EQ(task_memory_arena, memory_arena.get());
+
+  // The Task does not keep the arena alive after it has been executed
+  EXPECT_EQ(task->memory_arena(), nullptr);
+}
+
+TEST_F(MemoryArenaTest, ReleasedWithOperator) {
+  // Each operator has its own arena, which it releases once it has been executed
+  const auto memory_arena = std::make_shared<MemoryArena>();
+  const auto scoped_memory_arena = ScopedMemoryArena{memory_arena};
+
+  const auto recording_operator = std::make_shared<MemoryArenaRecordingOperator>();
+  recording_operator->execute();
+
+  EXPECT_NE(recording_operator->memory_arena.lock(), memory_arena);
+  EXPECT_TRUE(recording_operator->memory_arena.expired());
+  EXPECT_EQ(MemoryArena::current(), memory_arena.get());
+}
+
+}  // namespace opossum
@@ -0,0 +1,72 @@
+#include <memory>
+#include <utility>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "types.hpp"
+#include "utils/memory_limit_exceeded_exception.hpp"
+#include "utils/memory_tracker.hpp"
+
+namespace opossum {
+
+class MemoryTrackerTest : public BaseTest {};
+
+TEST_F(MemoryTrackerTest, TracksAllocationsOfScope) {
+  const auto memory_tracker = MemoryTracker::create();
+
+  {
+    const auto scoped_memory_tracker = ScopedMemoryTracker{memory_tracker};
+    EXPECT_EQ(MemoryTracker::current(), memory_tracker.get());
+
+    const auto values = pmr_vector<int32_t>(1'000);
+    EXPECT_GE(memory_tracker->current_bytes(), 1'000 * sizeof(int32_t));
+  }
+
+  EXPECT_EQ(MemoryTracker::current(), nullptr);
+  EXPECT_EQ(memory_tracker->current_bytes(), 0u);
+  EXPECT_GE(memory_tracker->peak_bytes(), 1'000 * sizeof(int32_t));
+
+  // Allocations outside of the scope are not tracked
+  const auto values = pmr_vector<int32_t>(1'000);
+  EXPECT_EQ(memory_tracker->current_bytes(), 0u);
+}
+
+TEST_F(MemoryTrackerTest, NestedTrackers) {
+  const auto outer_memory_tracker = MemoryTracker::create();
+  const auto scoped_outer_memory_tracker = ScopedMemoryTracker{outer_memory_tracker};
+
+  auto values = pmr_vector<int32_t>{};
+  {
+    const auto inner_memory_tracker = MemoryTracker::create();
+    const auto scoped_inner_memory_tracker = ScopedMemoryTracker{inner_memory_tracker};
+
+    values.resize(1'000);
+    EXPECT_GE(inner_memory_tracker->current_bytes(), 1'000 * sizeof(int32_t));
+    EXPECT_EQ(outer_memory_tracker->current_bytes(), inner_memory_tracker->current_bytes());
+  }
+
+  // The inner tracker is kept alive until the memory accounted to it is freed, regardless of the current scope
+  EXPECT_GE(outer_memory_tracker->current_bytes(), 1'000 * sizeof(int32_t));
+  values = pmr_vector<int32_t>{};
+  EXPECT_EQ(outer_memory_tracker->current_bytes(), 0u);
+}
+
+TEST_F(MemoryTrackerTest, Limit) {
+  const auto outer_memory_tracker = MemoryTracker::create(1'000);
+  const auto scoped_outer_memory_tracker = ScopedMemoryTracker{outer_memory_tracker};
+
+  // The limit of the outer tracker applies to the allocations of the inner one as well
+  const auto inner_memory_tracker = MemoryTracker::create();
+  const auto scoped_inner_memory_tracker = ScopedMemoryTracker{inner_memory_tracker};
+
+  auto small_values = pmr_vector<int32_t>(100);
+  EXPECT_THROW(pmr_vector<int32_t>(1'000), MemoryLimitExceededException);
+
+  // Failed allocations are not accounted
+  EXPECT_EQ(outer_memory_tracker->current_bytes(), inner_memory_tracker->current_bytes());
+  EXPECT_LE(outer_memory_tracker->current_bytes(), 1'000u);
+  EXPECT_EQ(outer_memory_tracker->limit(), 1'000u);
+}
+
+}  // namespace opossum